@@ -0,0 +1,134 @@
+//
+//  AllocationCounter.cpp
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#include "AllocationCounter.h"
+
+#include "Exceptions.h"
+
+#include <cstdlib>
+#include <exception>
+#include <new>
+
+CODATIME_BEGIN
+
+thread_local int64_t AllocationCounter::cAllocations = 0;
+thread_local int64_t AllocationCounter::cBytes = 0;
+
+bool AllocationCounter::isEnabled() {
+#ifdef CODATIME_COUNT_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif
+}
+
+int64_t AllocationCounter::getAllocations() {
+    return cAllocations;
+}
+
+int64_t AllocationCounter::getBytes() {
+    return cBytes;
+}
+
+void AllocationCounter::recordAllocation(size_t size) {
+    cAllocations++;
+    cBytes += (int64_t) size;
+}
+
+//-----------------------------------------------------------------------
+/**
+ * Gets the number of exceptions in flight on the calling thread. Before
+ * C++17 only whether there are any is known, so this is at most one.
+ */
+static int uncaughtExceptions() {
+#if __cplusplus >= 201703L
+    return uncaught_exceptions();
+#else
+    return (uncaught_exception() ? 1 : 0);
+#endif
+}
+
+AssertNoAllocations::AssertNoAllocations(string name) : iName(name), iBudget(0) {
+    iStart = AllocationCounter::getAllocations();
+    iUncaughtExceptions = uncaughtExceptions();
+}
+
+AssertNoAllocations::AssertNoAllocations(string name, int64_t budget) : iName(name), iBudget(budget) {
+    if (budget < 0) {
+        string err("Allocation budget must not be negative: ");
+        err.append(to_string(budget));
+        throw IllegalArgumentException(err);
+    }
+    iStart = AllocationCounter::getAllocations();
+    iUncaughtExceptions = uncaughtExceptions();
+}
+
+AssertNoAllocations::~AssertNoAllocations() noexcept(false) {
+#if __cplusplus >= 201703L
+    // a scope opened while unwinding is still checked as it closes
+    bool unwinding = (uncaughtExceptions() > iUncaughtExceptions);
+#else
+    bool unwinding = (uncaughtExceptions() > 0);
+#endif
+    if (unwinding == false) {
+        check();
+    }
+}
+
+int64_t AssertNoAllocations::getAllocations() const {
+    return AllocationCounter::getAllocations() - iStart;
+}
+
+void AssertNoAllocations::check() const {
+    int64_t allocations = getAllocations();
+    if (allocations > iBudget) {
+        string err(iName);
+        err.append(" made ");
+        err.append(to_string(allocations));
+        err.append(" allocations, the budget is ");
+        err.append(to_string(iBudget));
+        throw IllegalStateException(err);
+    }
+}
+
+CODATIME_END
+
+#ifdef CODATIME_COUNT_ALLOCATIONS
+
+// The replaceable global allocation functions. The sized deletes are
+// replaced too, as the default ones need not call these.
+void *operator new(size_t size) {
+    codatime::AllocationCounter::recordAllocation(size);
+    void *ptr = malloc(size == 0 ? 1 : size);
+    if (ptr == NULL) {
+        throw bad_alloc();
+    }
+    return ptr;
+}
+
+void *operator new[](size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void *ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept {
+    operator delete(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept {
+    operator delete(ptr);
+}
+
+void operator delete[](void *ptr, size_t) noexcept {
+    operator delete(ptr);
+}
+
+#endif
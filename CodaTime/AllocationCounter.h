@@ -0,0 +1,151 @@
+//
+//  AllocationCounter.h
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#ifndef __CodaTime__AllocationCounter__
+#define __CodaTime__AllocationCounter__
+
+#include "CodaTimeMacros.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+using namespace std;
+
+CODATIME_BEGIN
+
+/**
+ * AllocationCounter counts the heap allocations made by the calling thread.
+ * <p>
+ * Counting is opt-in. When the library is compiled with
+ * <code>CODATIME_COUNT_ALLOCATIONS</code> defined, AllocationCounter.cpp
+ * replaces the global <code>operator new</code> and <code>operator delete</code>
+ * with versions that count each allocation before calling <code>malloc</code>.
+ * This is meant for test and benchmark builds only. Without the define
+ * nothing is replaced and the counts are always zero.
+ * <p>
+ * The counts are per thread, so work on other threads does not disturb a
+ * measurement.
+ */
+class AllocationCounter {
+    
+private:
+    
+    /** The number of allocations made by this thread. */
+    static thread_local int64_t cAllocations;
+    /** The number of bytes allocated by this thread. */
+    static thread_local int64_t cBytes;
+    
+    AllocationCounter();
+    
+public:
+    
+    /**
+     * Checks whether allocations are being counted in this build.
+     *
+     * @return true if compiled with CODATIME_COUNT_ALLOCATIONS
+     */
+    static bool isEnabled();
+    
+    /**
+     * Gets the number of allocations made by the calling thread.
+     *
+     * @return the allocation count, zero if counting is not enabled
+     */
+    static int64_t getAllocations();
+    
+    /**
+     * Gets the number of bytes allocated by the calling thread.
+     *
+     * @return the byte count, zero if counting is not enabled
+     */
+    static int64_t getBytes();
+    
+    /**
+     * Records an allocation on the calling thread, called by the replaced
+     * <code>operator new</code>.
+     *
+     * @param size  the size of the allocation in bytes
+     */
+    static void recordAllocation(size_t size);
+};
+
+/**
+ * Asserts that a scope makes no more heap allocations than a budget.
+ * <p>
+ * The allocations made by the calling thread are counted from construction.
+ * {@link #check()} throws if the budget has been exceeded, and the destructor
+ * does the same unless the scope is already being left by an exception.
+ * The budget is zero unless specified, so that hot paths such as field
+ * access can be pinned to no allocation at all.
+ * <p>
+ * When counting is not enabled, see {@link AllocationCounter}, this does
+ * nothing.
+ */
+class AssertNoAllocations {
+    
+private:
+    
+    /** The name of the scope, used in the message. */
+    string iName;
+    /** The number of allocations allowed. */
+    int64_t iBudget;
+    /** The allocation count of the thread when the scope started. */
+    int64_t iStart;
+    /** The number of exceptions in flight when the scope started. */
+    int iUncaughtExceptions;
+    
+    AssertNoAllocations(const AssertNoAllocations &other);
+    AssertNoAllocations &operator=(const AssertNoAllocations &other);
+    
+public:
+    
+    /**
+     * Constructor, allowing no allocations.
+     *
+     * @param name  the name of the scope, used in the message
+     */
+    AssertNoAllocations(string name);
+    
+    /**
+     * Constructor, allowing up to a number of allocations.
+     *
+     * @param name  the name of the scope, used in the message
+     * @param budget  the number of allocations allowed, not negative
+     * @throws IllegalArgumentException if the budget is negative
+     */
+    AssertNoAllocations(string name, int64_t budget);
+    
+    /**
+     * Destructor, checking the budget unless the scope is being left by an
+     * exception. Before C++17 the budget is not checked while any exception
+     * is in flight, even one thrown before the scope started.
+     *
+     * @throws IllegalStateException if the budget was exceeded
+     */
+    ~AssertNoAllocations() noexcept(false);
+    
+    /**
+     * Gets the number of allocations made by the calling thread since this
+     * scope started.
+     *
+     * @return the allocation count
+     */
+    int64_t getAllocations() const;
+    
+    /**
+     * Checks the allocations made so far against the budget.
+     *
+     * @throws IllegalStateException if the budget was exceeded
+     */
+    void check() const;
+};
+
+CODATIME_END
+
+#endif /* defined(__CodaTime__AllocationCounter__) */
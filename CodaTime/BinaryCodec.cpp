@@ -0,0 +1,396 @@
+//
+//  BinaryCodec.cpp
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#include "BinaryCodec.h"
+
+#include "base/BaseLocal.h"
+#include "chrono/GregorianChronology.h"
+#include "chrono/ISOChronology.h"
+#include "DateTime.h"
+#include "DateTimeConstants.h"
+#include "DateTimeZone.h"
+#include "Duration.h"
+#include "Exceptions.h"
+#include "Interval.h"
+#include "LocalDateTime.h"
+#include "LocalTime.h"
+#include "Period.h"
+#include "PeriodBatch.h"
+#include "ReadableDuration.h"
+#include "ReadableInstant.h"
+#include "ReadableInterval.h"
+#include "ReadablePeriod.h"
+
+#include <climits>
+
+CODATIME_BEGIN
+
+/** Chronology kinds, written before the zone id of a new chronology */
+static const uint8_t CHRONO_ISO = 0;
+static const uint8_t CHRONO_GREGORIAN = 1;
+
+/** The longest varint, enough for 64 bits at seven bits per byte */
+static const int MAX_VARINT_BYTES = 10;
+
+static uint64_t zigzag(int64_t value) {
+    return ((uint64_t) value << 1) ^ (uint64_t) (value >> 63);
+}
+
+static int64_t unzigzag(uint64_t value) {
+    return (int64_t) (value >> 1) ^ -(int64_t) (value & 1);
+}
+
+BinaryEncoder::BinaryEncoder() {
+}
+
+const vector<uint8_t> &BinaryEncoder::getBytes() const {
+    return iBytes;
+}
+
+size_t BinaryEncoder::size() const {
+    return iBytes.size();
+}
+
+void BinaryEncoder::clear() {
+    iBytes.clear();
+    iChronologyIds.clear();
+}
+
+//-----------------------------------------------------------------------
+void BinaryEncoder::writeVarint(uint64_t value) {
+    while (value >= 0x80) {
+        iBytes.push_back((uint8_t) (value | 0x80));
+        value >>= 7;
+    }
+    iBytes.push_back((uint8_t) value);
+}
+
+void BinaryEncoder::writeSignedVarint(int64_t value) {
+    writeVarint(zigzag(value));
+}
+
+void BinaryEncoder::writeChronology(Chronology *chrono) {
+    if (chrono == NULL) {
+        throw IllegalArgumentException("The Chronology must not be null");
+    }
+    map<Chronology*, uint64_t>::iterator it = iChronologyIds.find(chrono);
+    if (it != iChronologyIds.end()) {
+        writeVarint(it->second + 1);
+        return;
+    }
+    
+    // zero introduces a new chronology, which takes the next id
+    if (dynamic_cast<ISOChronology*>(chrono) != 0) {
+        writeVarint(0);
+        iBytes.push_back(CHRONO_ISO);
+    } else if (GregorianChronology *gregorian = dynamic_cast<GregorianChronology*>(chrono)) {
+        writeVarint(0);
+        iBytes.push_back(CHRONO_GREGORIAN);
+        iBytes.push_back((uint8_t) gregorian->getMinimumDaysInFirstWeek());
+    } else {
+        string err("Chronology not supported by the binary format: ");
+        err.append(chrono->toString());
+        throw IllegalArgumentException(err);
+    }
+    string id = chrono->getZone()->getID();
+    writeVarint(id.size());
+    iBytes.insert(iBytes.end(), id.begin(), id.end());
+    uint64_t next = iChronologyIds.size();
+    iChronologyIds[chrono] = next;
+}
+
+//-----------------------------------------------------------------------
+void BinaryEncoder::writeInstant(ReadableInstant *instant) {
+    if (instant == NULL) {
+        throw IllegalArgumentException("The instant must not be null");
+    }
+    writeChronology(instant->getChronology());
+    writeSignedVarint(instant->getMillis());
+}
+
+void BinaryEncoder::writeLocalDateTime(LocalDateTime *dateTime) {
+    if (dateTime == NULL) {
+        throw IllegalArgumentException("The LocalDateTime must not be null");
+    }
+    const BaseLocal *local = dateTime;
+    writeChronology(dateTime->getChronology());
+    writeSignedVarint(local->getLocalMillis());
+}
+
+void BinaryEncoder::writeLocalTime(LocalTime *time) {
+    if (time == NULL) {
+        throw IllegalArgumentException("The LocalTime must not be null");
+    }
+    // a LocalTime holds the millis of the day as its local millis
+    const BaseLocal *local = time;
+    writeChronology(time->getChronology());
+    writeVarint((uint64_t) local->getLocalMillis());
+}
+
+void BinaryEncoder::writePackedLocalDate(PackedLocalDate date) {
+    writeSignedVarint(date.getEpochDay());
+}
+
+void BinaryEncoder::writePackedLocalTime(PackedLocalTime time) {
+    writeVarint((uint64_t) time.getMillisOfDay());
+}
+
+void BinaryEncoder::writeDuration(ReadableDuration *duration) {
+    if (duration == NULL) {
+        throw IllegalArgumentException("The duration must not be null");
+    }
+    writeSignedVarint(duration->getMillis());
+}
+
+void BinaryEncoder::writePeriodValues(int typeMask, const PeriodType::Values &values) {
+    int mask = 0;
+    for (int i = 0; i < PeriodType::FIELD_COUNT; i++) {
+        if (values[i] != 0) {
+            mask |= 1 << i;
+        }
+    }
+    if (typeMask >= 0) {
+        iBytes.push_back((uint8_t) typeMask);
+    }
+    iBytes.push_back((uint8_t) mask);
+    for (int i = 0; i < PeriodType::FIELD_COUNT; i++) {
+        if (values[i] != 0) {
+            writeSignedVarint(values[i]);
+        }
+    }
+}
+
+void BinaryEncoder::writePeriod(ReadablePeriod *period) {
+    if (period == NULL) {
+        throw IllegalArgumentException("The period must not be null");
+    }
+    PeriodType::Values values;
+    PeriodBatch::expand(&period, 1, &values);
+    writePeriodValues(period->getPeriodType()->iMask, values);
+}
+
+void BinaryEncoder::writeInterval(ReadableInterval *interval) {
+    if (interval == NULL) {
+        throw IllegalArgumentException("The interval must not be null");
+    }
+    int64_t start = interval->getStartMillis();
+    writeChronology(interval->getChronology());
+    writeSignedVarint(start);
+    writeVarint((uint64_t) interval->getEndMillis() - (uint64_t) start);
+}
+
+//-----------------------------------------------------------------------
+void BinaryEncoder::writeMillisColumn(const int64_t *millis, size_t count) {
+    writeVarint(count);
+    uint64_t previous = 0;
+    for (size_t i = 0; i < count; i++) {
+        // the difference wraps around rather than overflowing, and unwraps the same way
+        writeSignedVarint((int64_t) ((uint64_t) millis[i] - previous));
+        previous = (uint64_t) millis[i];
+    }
+}
+
+void BinaryEncoder::writePeriodColumn(const PeriodType::Values *values, size_t count) {
+    writeVarint(count);
+    for (size_t i = 0; i < count; i++) {
+        writePeriodValues(-1, values[i]);
+    }
+}
+
+//-----------------------------------------------------------------------
+BinaryDecoder::BinaryDecoder(const uint8_t *data, size_t size) {
+    if (data == NULL && size > 0) {
+        throw IllegalArgumentException("The data must not be null");
+    }
+    iData = data;
+    iSize = size;
+    iPosition = 0;
+}
+
+BinaryDecoder::BinaryDecoder(const vector<uint8_t> &bytes) {
+    iData = bytes.data();
+    iSize = bytes.size();
+    iPosition = 0;
+}
+
+size_t BinaryDecoder::getPosition() const {
+    return iPosition;
+}
+
+bool BinaryDecoder::hasRemaining() const {
+    return iPosition < iSize;
+}
+
+uint8_t BinaryDecoder::readByte() {
+    if (iPosition >= iSize) {
+        throw IllegalArgumentException("Binary input is truncated");
+    }
+    return iData[iPosition++];
+}
+
+//-----------------------------------------------------------------------
+uint64_t BinaryDecoder::readVarint() {
+    uint64_t value = 0;
+    for (int i = 0; i < MAX_VARINT_BYTES; i++) {
+        uint8_t b = readByte();
+        if (i == MAX_VARINT_BYTES - 1 && b > 1) {
+            break;
+        }
+        value |= (uint64_t) (b & 0x7F) << (7 * i);
+        if ((b & 0x80) == 0) {
+            return value;
+        }
+    }
+    throw IllegalArgumentException("Binary input has a malformed varint");
+}
+
+int64_t BinaryDecoder::readSignedVarint() {
+    return unzigzag(readVarint());
+}
+
+Chronology *BinaryDecoder::readChronology() {
+    uint64_t ref = readVarint();
+    if (ref > 0) {
+        if (ref > iChronologies.size()) {
+            string err("Binary input refers to an unknown chronology: ");
+            err.append(to_string(ref - 1));
+            throw IllegalArgumentException(err);
+        }
+        return iChronologies[ref - 1];
+    }
+    
+    uint8_t kind = readByte();
+    int minDays = 0;
+    if (kind == CHRONO_GREGORIAN) {
+        minDays = readByte();
+    } else if (kind != CHRONO_ISO) {
+        string err("Binary input has an unknown chronology kind: ");
+        err.append(to_string(kind));
+        throw IllegalArgumentException(err);
+    }
+    uint64_t length = readVarint();
+    if (length > iSize - iPosition) {
+        throw IllegalArgumentException("Binary input is truncated");
+    }
+    string id((const char *) iData + iPosition, (size_t) length);
+    iPosition += (size_t) length;
+    DateTimeZone *zone = DateTimeZone::forID(id);
+    
+    Chronology *chrono;
+    if (kind == CHRONO_GREGORIAN) {
+        chrono = GregorianChronology::getInstance(zone, minDays);
+    } else {
+        chrono = ISOChronology::getInstance(zone);
+    }
+    iChronologies.push_back(chrono);
+    return chrono;
+}
+
+//-----------------------------------------------------------------------
+DateTime *BinaryDecoder::readDateTime() {
+    Chronology *chrono = readChronology();
+    return new DateTime(readSignedVarint(), chrono);
+}
+
+LocalDateTime *BinaryDecoder::readLocalDateTime() {
+    // local chronologies are always in UTC, where local millis and instant millis are the same
+    Chronology *chrono = readChronology();
+    return new LocalDateTime(readSignedVarint(), chrono);
+}
+
+LocalTime *BinaryDecoder::readLocalTime() {
+    Chronology *chrono = readChronology();
+    uint64_t millisOfDay = readVarint();
+    if (millisOfDay >= (uint64_t) DateTimeConstants::MILLIS_PER_DAY) {
+        throw IllegalArgumentException("Binary input has an invalid millis of day");
+    }
+    return new LocalTime((int64_t) millisOfDay, chrono);
+}
+
+PackedLocalDate BinaryDecoder::readPackedLocalDate() {
+    int64_t epochDay = readSignedVarint();
+    if (epochDay != (int32_t) epochDay) {
+        throw IllegalArgumentException("Binary input has an invalid epoch day");
+    }
+    return PackedLocalDate::fromEpochDay((int32_t) epochDay);
+}
+
+PackedLocalTime BinaryDecoder::readPackedLocalTime() {
+    uint64_t millisOfDay = readVarint();
+    if (millisOfDay >= (uint64_t) DateTimeConstants::MILLIS_PER_DAY) {
+        throw IllegalArgumentException("Binary input has an invalid millis of day");
+    }
+    return PackedLocalTime::fromMillisOfDay((int) millisOfDay);
+}
+
+Duration *BinaryDecoder::readDuration() {
+    return new Duration(readSignedVarint());
+}
+
+PeriodType::Values BinaryDecoder::readPeriodValues(int typeMask) {
+    int mask = readByte();
+    if ((mask & ~typeMask) != 0) {
+        throw IllegalArgumentException("Binary input has period values outside the period type");
+    }
+    PeriodType::Values values = PeriodType::Values();
+    for (int i = 0; i < PeriodType::FIELD_COUNT; i++) {
+        if ((mask & (1 << i)) != 0) {
+            int64_t value = readSignedVarint();
+            if (value != (int) value) {
+                throw IllegalArgumentException("Binary input has a period value out of range");
+            }
+            values[i] = (int) value;
+        }
+    }
+    return values;
+}
+
+Period *BinaryDecoder::readPeriod() {
+    int typeMask = readByte();
+    PeriodType::Values v = readPeriodValues(typeMask);
+    return new Period(v[0], v[1], v[2], v[3], v[4], v[5], v[6], v[7], PeriodType::forFieldMask(typeMask));
+}
+
+Interval *BinaryDecoder::readInterval() {
+    Chronology *chrono = readChronology();
+    int64_t start = readSignedVarint();
+    uint64_t length = readVarint();
+    // the distance from the start to the largest instant, which never wraps
+    if (length > (uint64_t) INT64_MAX - (uint64_t) start) {
+        throw IllegalArgumentException("Binary input has an interval end out of range");
+    }
+    return new Interval(start, (int64_t) ((uint64_t) start + length), chrono);
+}
+
+//-----------------------------------------------------------------------
+void BinaryDecoder::readMillisColumn(vector<int64_t> &millis) {
+    uint64_t count = readVarint();
+    // every element takes at least one byte, which bounds the allocation by the input
+    if (count > iSize - iPosition) {
+        throw IllegalArgumentException("Binary input is truncated");
+    }
+    millis.resize((size_t) count);
+    uint64_t previous = 0;
+    for (size_t i = 0; i < millis.size(); i++) {
+        previous += (uint64_t) readSignedVarint();
+        millis[i] = (int64_t) previous;
+    }
+}
+
+void BinaryDecoder::readPeriodColumn(vector<PeriodType::Values> &values) {
+    uint64_t count = readVarint();
+    if (count > iSize - iPosition) {
+        throw IllegalArgumentException("Binary input is truncated");
+    }
+    values.resize((size_t) count);
+    for (size_t i = 0; i < values.size(); i++) {
+        values[i] = readPeriodValues(PeriodType::STANDARD_MASK);
+    }
+}
+
+CODATIME_END
@@ -0,0 +1,264 @@
+//
+//  BinaryCodec.h
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#ifndef __CodaTime__BinaryCodec__
+#define __CodaTime__BinaryCodec__
+
+#include "CodaTimeMacros.h"
+
+#include "PackedLocalDate.h"
+#include "PackedLocalTime.h"
+#include "PeriodType.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+using namespace std;
+
+CODATIME_BEGIN
+
+class Chronology;
+class DateTime;
+class Duration;
+class Interval;
+class LocalDateTime;
+class LocalTime;
+class Period;
+class ReadableDuration;
+class ReadableInstant;
+class ReadableInterval;
+class ReadablePeriod;
+
+/**
+ * BinaryEncoder writes temporal values in a compact binary form.
+ * <p>
+ * The format is built from two primitives:
+ * <ul>
+ * <li>varints, seven bits per byte with the high bit set on every byte but the last
+ * <li>signed varints, which zigzag encode the value first so that small
+ *  negative numbers stay short
+ * </ul>
+ * Millisecond instants and durations are written as signed varints.
+ * A chronology is written in full the first time it is seen, and as a small
+ * id afterwards, so a stream of values in the same zone costs one byte per
+ * value for the chronology. A period is written as its type mask, a mask of
+ * its non-zero fields and one signed varint for each non-zero field.
+ * <p>
+ * Columns of values are written with a count followed by the values, with
+ * instants delta encoded against the previous instant. Sorted timestamps
+ * then take one or two bytes each.
+ * <p>
+ * The output is read back with a {@link BinaryDecoder} that starts at the
+ * same point, since both sides must see the chronologies in the same order.
+ * <p>
+ * BinaryEncoder is mutable and not thread-safe.
+ */
+class BinaryEncoder {
+    
+private:
+    
+    vector<uint8_t> iBytes;
+    map<Chronology*, uint64_t> iChronologyIds;
+    
+    void writePeriodValues(int typeMask, const PeriodType::Values &values);
+    
+public:
+    
+    BinaryEncoder();
+    
+    /**
+     * Gets the bytes written so far.
+     *
+     * @return the encoded bytes
+     */
+    const vector<uint8_t> &getBytes() const;
+    
+    /**
+     * Gets the number of bytes written so far.
+     *
+     * @return the encoded size
+     */
+    size_t size() const;
+    
+    /**
+     * Discards the bytes written and the chronologies seen, so that the
+     * encoder can start a new independent stream.
+     */
+    void clear();
+    
+    //-----------------------------------------------------------------------
+    void writeVarint(uint64_t value);
+    
+    void writeSignedVarint(int64_t value);
+    
+    /**
+     * Writes a chronology, in full the first time and as an id after that.
+     * <p>
+     * The ISO and Gregorian chronologies in any zone are supported.
+     *
+     * @param chrono  the chronology to write, not null
+     * @throws IllegalArgumentException if the chronology is null or not supported
+     */
+    void writeChronology(Chronology *chrono);
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Writes an instant with its chronology, to be read back as a <code>DateTime</code>.
+     *
+     * @param instant  the instant to write, not null
+     * @throws IllegalArgumentException if the instant is null
+     */
+    void writeInstant(ReadableInstant *instant);
+    
+    void writeLocalDateTime(LocalDateTime *dateTime);
+    
+    void writeLocalTime(LocalTime *time);
+    
+    void writePackedLocalDate(PackedLocalDate date);
+    
+    void writePackedLocalTime(PackedLocalTime time);
+    
+    void writeDuration(ReadableDuration *duration);
+    
+    void writePeriod(ReadablePeriod *period);
+    
+    /**
+     * Writes an interval with its chronology.
+     * <p>
+     * The end is written as the duration from the start, which is always
+     * positive and usually much shorter than the end instant.
+     *
+     * @param interval  the interval to write, not null
+     * @throws IllegalArgumentException if the interval is null
+     */
+    void writeInterval(ReadableInterval *interval);
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Writes a column of millisecond instants.
+     * <p>
+     * Each instant is written as the difference from the one before, so the
+     * column is smallest when the instants are sorted or close together.
+     *
+     * @param millis  the instants, not null
+     * @param count  the number of instants
+     */
+    void writeMillisColumn(const int64_t *millis, size_t count);
+    
+    /**
+     * Writes a column of period values in the standard order used by
+     * <code>PeriodBatch</code>.
+     * <p>
+     * Each element takes one byte for its mask of non-zero fields, plus a
+     * signed varint for each non-zero field.
+     *
+     * @param values  the period values, not null
+     * @param count  the number of elements
+     */
+    void writePeriodColumn(const PeriodType::Values *values, size_t count);
+    
+};
+
+/**
+ * BinaryDecoder reads temporal values written by a {@link BinaryEncoder}.
+ * <p>
+ * The decoder reads directly from the caller's bytes, which are not copied
+ * and must stay valid while the decoder is used. Only the ids of new
+ * chronologies are copied out, once per stream.
+ * <p>
+ * Malformed or truncated input is reported with an
+ * <code>IllegalArgumentException</code>, and the decoder never reads past the
+ * end of the bytes it was given.
+ * <p>
+ * BinaryDecoder is mutable and not thread-safe.
+ */
+class BinaryDecoder {
+    
+private:
+    
+    const uint8_t *iData;
+    size_t iSize;
+    size_t iPosition;
+    vector<Chronology*> iChronologies;
+    
+    uint8_t readByte();
+    
+    PeriodType::Values readPeriodValues(int typeMask);
+    
+public:
+    
+    /**
+     * Creates a decoder over a span of bytes.
+     *
+     * @param data  the bytes to read, not copied, may be null if size is zero
+     * @param size  the number of bytes
+     */
+    BinaryDecoder(const uint8_t *data, size_t size);
+    
+    BinaryDecoder(const vector<uint8_t> &bytes);
+    
+    /**
+     * Gets the number of bytes read so far.
+     *
+     * @return the position in the span
+     */
+    size_t getPosition() const;
+    
+    /**
+     * Checks whether there are bytes left to read.
+     *
+     * @return true if the whole span has not been read
+     */
+    bool hasRemaining() const;
+    
+    //-----------------------------------------------------------------------
+    uint64_t readVarint();
+    
+    int64_t readSignedVarint();
+    
+    Chronology *readChronology();
+    
+    //-----------------------------------------------------------------------
+    DateTime *readDateTime();
+    
+    LocalDateTime *readLocalDateTime();
+    
+    LocalTime *readLocalTime();
+    
+    PackedLocalDate readPackedLocalDate();
+    
+    PackedLocalTime readPackedLocalTime();
+    
+    Duration *readDuration();
+    
+    Period *readPeriod();
+    
+    Interval *readInterval();
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Reads a column of millisecond instants, replacing the contents of the vector.
+     *
+     * @param millis  the vector to populate
+     */
+    void readMillisColumn(vector<int64_t> &millis);
+    
+    /**
+     * Reads a column of period values, replacing the contents of the vector.
+     *
+     * @param values  the vector to populate, in standard order
+     */
+    void readPeriodColumn(vector<PeriodType::Values> &values);
+    
+};
+
+CODATIME_END
+
+#endif /* defined(__CodaTime__BinaryCodec__) */
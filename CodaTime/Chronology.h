@@ -12,6 +12,7 @@
 #include "CodaTimeMacros.h"
 
 #include "Object.h"
+#include "PeriodType.h"
 
 #include <vector>
 #include <string>
@@ -201,7 +202,7 @@ public:
      * @param endInstant  the start instant of an interval to query
      * @return the values of the period extracted from the interval
      */
-    virtual vector<int> get(ReadablePeriod *period, int64_t startInstant, int64_t endInstant) = 0;
+    virtual PeriodType::Values get(ReadablePeriod *period, int64_t startInstant, int64_t endInstant) = 0;
     
     /**
      * Gets the values of a period from an interval.
@@ -210,7 +211,7 @@ public:
      * @param duration  the duration to query
      * @return the values of the period extracted from the duration
      */
-    virtual vector<int> get(ReadablePeriod *period, int64_t duration) = 0;
+    virtual PeriodType::Values get(ReadablePeriod *period, int64_t duration) = 0;
     
     /**
      * Adds the period to the instant, specifying the number of times to add.
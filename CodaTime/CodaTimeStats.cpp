@@ -0,0 +1,175 @@
+//
+//  CodaTimeStats.cpp
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#include "CodaTimeStats.h"
+
+#include "Exceptions.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+CODATIME_BEGIN
+
+/**
+ * The counters of one thread. Only the owning thread writes them, so they
+ * are relaxed atomics purely so that readers on other threads are safe.
+ */
+struct CodaTimeStats::Counters {
+    
+    atomic<int64_t> iValues[COUNTER_COUNT];
+    
+    Counters();
+    ~Counters();
+};
+
+/** The counters of the live threads, and the totals of the threads that have exited. */
+struct StatsRegistry {
+    mutex iLock;
+    vector<const atomic<int64_t>*> iLive;
+    vector<int64_t> iRetired;
+};
+
+// never destroyed, as the counters of threads still running at exit retire into it
+static StatsRegistry &getRegistry() {
+    static StatsRegistry *const cRegistry = new StatsRegistry();
+    return *cRegistry;
+}
+
+CodaTimeStats::Counters::Counters() {
+    for (int i = 0; i < COUNTER_COUNT; i++) {
+        iValues[i].store(0, memory_order_relaxed);
+    }
+    StatsRegistry &registry = getRegistry();
+    lock_guard<mutex> lock(registry.iLock);
+    if (registry.iRetired.empty()) {
+        registry.iRetired.resize(COUNTER_COUNT);
+    }
+    registry.iLive.push_back(iValues);
+}
+
+CodaTimeStats::Counters::~Counters() {
+    StatsRegistry &registry = getRegistry();
+    lock_guard<mutex> lock(registry.iLock);
+    for (int i = 0; i < COUNTER_COUNT; i++) {
+        registry.iRetired[i] += iValues[i].load(memory_order_relaxed);
+    }
+    registry.iLive.erase(find(registry.iLive.begin(), registry.iLive.end(), iValues));
+}
+
+CodaTimeStats::Counters &CodaTimeStats::getCounters() {
+    static thread_local Counters cCounters;
+    return cCounters;
+}
+
+void CodaTimeStats::add(int counter, int64_t amount) {
+    atomic<int64_t> &value = getCounters().iValues[counter];
+    value.store(value.load(memory_order_relaxed) + amount, memory_order_relaxed);
+}
+
+void CodaTimeStats::sum(int first, int count, int64_t *totals) {
+    StatsRegistry &registry = getRegistry();
+    lock_guard<mutex> lock(registry.iLock);
+    for (int c = 0; c < count; c++) {
+        totals[c] = (registry.iRetired.empty() ? 0 : registry.iRetired[first + c]);
+        for (size_t i = 0; i < registry.iLive.size(); i++) {
+            totals[c] += registry.iLive[i][first + c].load(memory_order_relaxed);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------
+bool CodaTimeStats::isEnabled() {
+#ifdef CODATIME_ENABLE_STATS
+    return true;
+#else
+    return false;
+#endif
+}
+
+void CodaTimeStats::recordHit(Cache cache) {
+    add(cache * CACHE_FIELDS + HITS, 1);
+}
+
+void CodaTimeStats::recordMiss(Cache cache, int64_t bytes) {
+    add(cache * CACHE_FIELDS + MISSES, 1);
+    add(cache * CACHE_FIELDS + ENTRIES, 1);
+    add(cache * CACHE_FIELDS + BYTES, bytes);
+}
+
+void CodaTimeStats::recordEviction(Cache cache, int64_t bytes) {
+    add(cache * CACHE_FIELDS + EVICTIONS, 1);
+    add(cache * CACHE_FIELDS + ENTRIES, -1);
+    add(cache * CACHE_FIELDS + BYTES, -bytes);
+}
+
+void CodaTimeStats::recordZoneLoad() {
+    add(ZONE_LOADS, 1);
+}
+
+void CodaTimeStats::recordFormatterCompilation() {
+    add(FORMATTER_COMPILATIONS, 1);
+}
+
+//-----------------------------------------------------------------------
+CodaTimeStats::CacheStats CodaTimeStats::getCacheStats(Cache cache) {
+    if (cache < 0 || cache >= CACHE_COUNT) {
+        string err("Invalid cache: ");
+        err.append(to_string(cache));
+        throw IllegalArgumentException(err);
+    }
+    int64_t totals[CACHE_FIELDS];
+    sum(cache * CACHE_FIELDS, CACHE_FIELDS, totals);
+    CacheStats stats;
+    stats.hits = totals[HITS];
+    stats.misses = totals[MISSES];
+    stats.evictions = totals[EVICTIONS];
+    stats.entries = totals[ENTRIES];
+    stats.bytes = totals[BYTES];
+    return stats;
+}
+
+int64_t CodaTimeStats::getZoneLoads() {
+    int64_t total;
+    sum(ZONE_LOADS, 1, &total);
+    return total;
+}
+
+int64_t CodaTimeStats::getFormatterCompilations() {
+    int64_t total;
+    sum(FORMATTER_COMPILATIONS, 1, &total);
+    return total;
+}
+
+string CodaTimeStats::getCacheName(Cache cache) {
+    switch (cache) {
+        case YEAR_INFO:
+            return "yearInfo";
+        case ISO_CHRONOLOGY:
+            return "isoChronology";
+        case GREGORIAN_CHRONOLOGY:
+            return "gregorianChronology";
+        case FIXED_OFFSET_ZONE:
+            return "fixedOffsetZone";
+        case PATTERN_FORMATTER:
+            return "patternFormatter";
+        case STYLE_FORMATTER:
+            return "styleFormatter";
+        case LOCALE_STYLE_FORMATTER:
+            return "localeStyleFormatter";
+        case LOCALE_SYMBOLS:
+            return "localeSymbols";
+        default:
+            string err("Invalid cache: ");
+            err.append(to_string(cache));
+            throw IllegalArgumentException(err);
+    }
+}
+
+CODATIME_END
@@ -0,0 +1,193 @@
+//
+//  CodaTimeStats.h
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#ifndef __CodaTime__CodaTimeStats__
+#define __CodaTime__CodaTimeStats__
+
+#include "CodaTimeMacros.h"
+
+#include <cstdint>
+#include <string>
+
+using namespace std;
+
+/**
+ * Recording points, compiled in only when CODATIME_ENABLE_STATS is defined.
+ * Otherwise they expand to nothing and their arguments are not evaluated,
+ * so a cache hit costs no more than the lookup itself.
+ */
+#ifdef CODATIME_ENABLE_STATS
+#define CODATIME_STATS_HIT(cache)               codatime::CodaTimeStats::recordHit(codatime::CodaTimeStats::cache)
+#define CODATIME_STATS_MISS(cache, bytes)       codatime::CodaTimeStats::recordMiss(codatime::CodaTimeStats::cache, bytes)
+#define CODATIME_STATS_EVICTION(cache, bytes)   codatime::CodaTimeStats::recordEviction(codatime::CodaTimeStats::cache, bytes)
+#define CODATIME_STATS_ZONE_LOAD()              codatime::CodaTimeStats::recordZoneLoad()
+#define CODATIME_STATS_FORMATTER_COMPILATION()  codatime::CodaTimeStats::recordFormatterCompilation()
+#else
+#define CODATIME_STATS_HIT(cache)               ((void) 0)
+#define CODATIME_STATS_MISS(cache, bytes)       ((void) 0)
+#define CODATIME_STATS_EVICTION(cache, bytes)   ((void) 0)
+#define CODATIME_STATS_ZONE_LOAD()              ((void) 0)
+#define CODATIME_STATS_FORMATTER_COMPILATION()  ((void) 0)
+#endif
+
+CODATIME_BEGIN
+
+/**
+ * CodaTimeStats reports the activity of the internal caches.
+ * <p>
+ * Each cache counts its hits, misses and evictions, together with the
+ * number of entries it holds and an estimate of their size in bytes. The
+ * number of zones loaded from the provider and of formatter patterns
+ * compiled are counted as well.
+ * <p>
+ * Every thread counts into its own block of counters, which only that thread
+ * writes, so recording is a plain increment without contention. A read sums
+ * the blocks of the live threads and the totals left by threads that have
+ * exited. The counters of one cache are read together, but a thread may
+ * be part way through recording a lookup.
+ * <p>
+ * The caches record through the CODATIME_STATS macros, which are compiled
+ * in only when the library is built with CODATIME_ENABLE_STATS. Without it
+ * every counter reads as zero.
+ * <p>
+ * CodaTimeStats is thread-safe.
+ */
+class CodaTimeStats {
+    
+public:
+    
+    /** The caches that are counted. */
+    enum Cache {
+        /** The year info cache of each Gregorian/Julian chronology. */
+        YEAR_INFO,
+        /** The cache of ISOChronology by zone. */
+        ISO_CHRONOLOGY,
+        /** The cache of GregorianChronology by zone and min days in first week. */
+        GREGORIAN_CHRONOLOGY,
+        /** The cache of fixed offset zones by id. */
+        FIXED_OFFSET_ZONE,
+        /** The cache of formatters by pattern. */
+        PATTERN_FORMATTER,
+        /** The cache of formatters by date and time style. */
+        STYLE_FORMATTER,
+        /** The cache of the formatters of style formatters by style and locale. */
+        LOCALE_STYLE_FORMATTER,
+        /** The cache of GJLocaleSymbols by locale. */
+        LOCALE_SYMBOLS,
+        CACHE_COUNT
+    };
+    
+    /** A snapshot of the counters of one cache. */
+    struct CacheStats {
+        int64_t hits;
+        int64_t misses;
+        int64_t evictions;
+        int64_t entries;
+        int64_t bytes;
+    };
+    
+private:
+    
+    static const int HITS = 0;
+    static const int MISSES = 1;
+    static const int EVICTIONS = 2;
+    static const int ENTRIES = 3;
+    static const int BYTES = 4;
+    static const int CACHE_FIELDS = 5;
+    
+    static const int ZONE_LOADS = CACHE_COUNT * CACHE_FIELDS;
+    static const int FORMATTER_COMPILATIONS = ZONE_LOADS + 1;
+    static const int COUNTER_COUNT = FORMATTER_COMPILATIONS + 1;
+    
+    struct Counters;
+    
+    static Counters &getCounters();
+    static void add(int counter, int64_t amount);
+    static void sum(int first, int count, int64_t *totals);
+    
+    CodaTimeStats();
+    
+public:
+    
+    /**
+     * Checks whether the caches record their activity.
+     *
+     * @return true if compiled with CODATIME_ENABLE_STATS
+     */
+    static bool isEnabled();
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Records a lookup that found its entry.
+     *
+     * @param cache  the cache
+     */
+    static void recordHit(Cache cache);
+    
+    /**
+     * Records a lookup that did not find its entry, and so created one.
+     *
+     * @param cache  the cache
+     * @param bytes  the estimated size of the new entry
+     */
+    static void recordMiss(Cache cache, int64_t bytes);
+    
+    /**
+     * Records an entry being replaced or removed.
+     *
+     * @param cache  the cache
+     * @param bytes  the estimated size of the entry
+     */
+    static void recordEviction(Cache cache, int64_t bytes);
+    
+    /**
+     * Records a zone being loaded from the zone provider.
+     */
+    static void recordZoneLoad();
+    
+    /**
+     * Records a formatter being compiled from a pattern.
+     */
+    static void recordFormatterCompilation();
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Gets the counters of a cache, summed over all threads.
+     *
+     * @param cache  the cache
+     * @return the counters
+     */
+    static CacheStats getCacheStats(Cache cache);
+    
+    /**
+     * Gets the number of zones loaded from the zone provider.
+     *
+     * @return the count over all threads
+     */
+    static int64_t getZoneLoads();
+    
+    /**
+     * Gets the number of formatters compiled from a pattern.
+     *
+     * @return the count over all threads
+     */
+    static int64_t getFormatterCompilations();
+    
+    /**
+     * Gets the name of a cache, suitable as a metric name.
+     *
+     * @param cache  the cache
+     * @return the name, such as "yearInfo"
+     */
+    static string getCacheName(Cache cache);
+    
+};
+
+CODATIME_END
+
+#endif /* defined(__CodaTime__CodaTimeStats__) */
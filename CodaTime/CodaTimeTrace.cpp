@@ -0,0 +1,213 @@
+//
+//  CodaTimeTrace.cpp
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#include "CodaTimeTrace.h"
+
+#include "Exceptions.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <sstream>
+
+CODATIME_BEGIN
+
+/**
+ * One record of a ring. The fields are relaxed atomics guarded by a sequence
+ * number, which is odd while the owning thread writes the record and is
+ * otherwise twice the number of the record plus two.
+ */
+struct TraceSlot {
+    atomic<uint64_t> iSequence;
+    atomic<int64_t> iEvent;
+    atomic<int64_t> iStart;
+    atomic<int64_t> iDuration;
+    atomic<int64_t> iValue;
+    atomic<uint64_t> iText[2];
+};
+
+/**
+ * The ring of one thread.
+ */
+struct CodaTimeTrace::Ring {
+    
+    int iThread;
+    /** The number of records written, only accessed by the owning thread. */
+    uint64_t iCount;
+    TraceSlot iSlots[CAPACITY];
+    
+    Ring();
+    ~Ring();
+};
+
+/**
+ * The rings of the live threads.
+ */
+struct CodaTimeTrace::Registry {
+    
+    mutex iLock;
+    vector<const Ring*> iRings;
+    int iNextThread;
+};
+
+CodaTimeTrace::Ring::Ring() {
+    iCount = 0;
+    for (int i = 0; i < CAPACITY; i++) {
+        iSlots[i].iSequence.store(0, memory_order_relaxed);
+    }
+    Registry &registry = getRegistry();
+    lock_guard<mutex> lock(registry.iLock);
+    iThread = registry.iNextThread++;
+    registry.iRings.push_back(this);
+}
+
+CodaTimeTrace::Ring::~Ring() {
+    Registry &registry = getRegistry();
+    lock_guard<mutex> lock(registry.iLock);
+    registry.iRings.erase(find(registry.iRings.begin(), registry.iRings.end(), this));
+}
+
+static bool compareEntries(const CodaTimeTrace::Entry &a, const CodaTimeTrace::Entry &b) {
+    return a.startNanos < b.startNanos;
+}
+
+//-----------------------------------------------------------------------
+CodaTimeTrace::Span::Span(Event event, int64_t value, const string &text) {
+    iEvent = event;
+    iValue = value;
+    pack(text, iText);
+    iStart = nanoTime();
+}
+
+CodaTimeTrace::Span::~Span() {
+    write(iEvent, iStart, nanoTime() - iStart, iValue, iText);
+}
+
+//-----------------------------------------------------------------------
+// never destroyed, as the rings of threads still running at exit remove themselves from it
+CodaTimeTrace::Registry &CodaTimeTrace::getRegistry() {
+    static Registry *const cRegistry = new Registry();
+    return *cRegistry;
+}
+
+CodaTimeTrace::Ring *CodaTimeTrace::getRing() {
+    static thread_local Ring cRing;
+    return &cRing;
+}
+
+int64_t CodaTimeTrace::nanoTime() {
+    return chrono::steady_clock::now().time_since_epoch() / chrono::nanoseconds(1);
+}
+
+void CodaTimeTrace::pack(const string &text, uint64_t *packed) {
+    char chars[TEXT_LENGTH];
+    memset(chars, 0, TEXT_LENGTH);
+    memcpy(chars, text.data(), min(text.size(), (size_t) TEXT_LENGTH));
+    memcpy(packed, chars, TEXT_LENGTH);
+}
+
+void CodaTimeTrace::write(Event event, int64_t start, int64_t duration, int64_t value, const uint64_t *text) {
+    Ring *ring = getRing();
+    uint64_t number = ring->iCount++;
+    TraceSlot &slot = ring->iSlots[number % CAPACITY];
+    slot.iSequence.store(2 * number + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    slot.iEvent.store(event, memory_order_relaxed);
+    slot.iStart.store(start, memory_order_relaxed);
+    slot.iDuration.store(duration, memory_order_relaxed);
+    slot.iValue.store(value, memory_order_relaxed);
+    slot.iText[0].store(text[0], memory_order_relaxed);
+    slot.iText[1].store(text[1], memory_order_relaxed);
+    slot.iSequence.store(2 * number + 2, memory_order_release);
+}
+
+//-----------------------------------------------------------------------
+bool CodaTimeTrace::isEnabled() {
+#ifdef CODATIME_ENABLE_TRACE
+    return true;
+#else
+    return false;
+#endif
+}
+
+void CodaTimeTrace::record(Event event, int64_t value, const string &text) {
+    uint64_t packed[2];
+    pack(text, packed);
+    write(event, nanoTime(), 0, value, packed);
+}
+
+vector<CodaTimeTrace::Entry> CodaTimeTrace::snapshot() {
+    vector<Entry> entries;
+    Registry &registry = getRegistry();
+    lock_guard<mutex> lock(registry.iLock);
+    for (size_t r = 0; r < registry.iRings.size(); r++) {
+        const Ring *ring = registry.iRings[r];
+        for (int i = 0; i < CAPACITY; i++) {
+            const TraceSlot &slot = ring->iSlots[i];
+            uint64_t sequence = slot.iSequence.load(memory_order_acquire);
+            if (sequence == 0 || (sequence & 1) != 0) {
+                continue;
+            }
+            Entry entry;
+            entry.thread = ring->iThread;
+            entry.event = (Event) slot.iEvent.load(memory_order_relaxed);
+            entry.startNanos = slot.iStart.load(memory_order_relaxed);
+            entry.durationNanos = slot.iDuration.load(memory_order_relaxed);
+            entry.value = slot.iValue.load(memory_order_relaxed);
+            uint64_t text[2];
+            text[0] = slot.iText[0].load(memory_order_relaxed);
+            text[1] = slot.iText[1].load(memory_order_relaxed);
+            atomic_thread_fence(memory_order_acquire);
+            if (slot.iSequence.load(memory_order_relaxed) != sequence) {
+                continue;
+            }
+            char chars[TEXT_LENGTH];
+            memcpy(chars, text, TEXT_LENGTH);
+            entry.text.assign(chars, strnlen(chars, TEXT_LENGTH));
+            entries.push_back(entry);
+        }
+    }
+    stable_sort(entries.begin(), entries.end(), compareEntries);
+    return entries;
+}
+
+string CodaTimeTrace::dump() {
+    vector<Entry> entries = snapshot();
+    ostringstream out;
+    for (size_t i = 0; i < entries.size(); i++) {
+        const Entry &entry = entries[i];
+        out << entry.startNanos << " thread=" << entry.thread << " " << getEventName(entry.event);
+        out << " duration=" << entry.durationNanos << "ns value=" << entry.value;
+        if (!entry.text.empty()) {
+            out << " text=\"" << entry.text << "\"";
+        }
+        out << "\n";
+    }
+    return out.str();
+}
+
+string CodaTimeTrace::getEventName(Event event) {
+    switch (event) {
+        case ZONE_FOR_ID:
+            return "zoneForId";
+        case PATTERN_COMPILE:
+            return "patternCompile";
+        case PARSE_FAILURE:
+            return "parseFailure";
+        case YEAR_INFO_MISS:
+            return "yearInfoMiss";
+        default:
+            string err("Invalid event: ");
+            err.append(to_string(event));
+            throw IllegalArgumentException(err);
+    }
+}
+
+CODATIME_END
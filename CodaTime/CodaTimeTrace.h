@@ -0,0 +1,163 @@
+//
+//  CodaTimeTrace.h
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#ifndef __CodaTime__CodaTimeTrace__
+#define __CodaTime__CodaTimeTrace__
+
+#include "CodaTimeMacros.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/**
+ * Trace points, compiled in only when CODATIME_ENABLE_TRACE is defined.
+ * Otherwise they expand to nothing and their arguments are not evaluated.
+ */
+#ifdef CODATIME_ENABLE_TRACE
+#define CODATIME_TRACE_EVENT(event, value, text)     codatime::CodaTimeTrace::record(codatime::CodaTimeTrace::event, value, text)
+#define CODATIME_TRACE_SPAN(name, event, value, text) codatime::CodaTimeTrace::Span name(codatime::CodaTimeTrace::event, value, text)
+#else
+#define CODATIME_TRACE_EVENT(event, value, text)     ((void) 0)
+#define CODATIME_TRACE_SPAN(name, event, value, text) ((void) 0)
+#endif
+
+CODATIME_BEGIN
+
+/**
+ * CodaTimeTrace records what the library was doing on each thread, to find
+ * where the time went in a latency spike.
+ * <p>
+ * Trace points are placed with the CODATIME_TRACE_EVENT and
+ * CODATIME_TRACE_SPAN macros, which only record when the library is built
+ * with CODATIME_ENABLE_TRACE. A span records how long its scope took.
+ * <p>
+ * Each thread writes into its own ring buffer of the most recent
+ * {@link #CAPACITY} records, without locks or allocation. The rings can be
+ * read from any thread with {@link #snapshot()} or {@link #dump()}; a record
+ * that is being overwritten while it is read is skipped. The ring of a
+ * thread is discarded when the thread exits.
+ */
+class CodaTimeTrace {
+    
+public:
+    
+    /** The trace points. */
+    enum Event {
+        /** A zone looked up by id, the text is the id. */
+        ZONE_FOR_ID,
+        /** A formatter compiled on a pattern cache miss, the text is the pattern. */
+        PATTERN_COMPILE,
+        /** A parse that failed on a field value or offset transition, the text is the input. */
+        PARSE_FAILURE,
+        /** A year info cache miss, the value is the year. */
+        YEAR_INFO_MISS,
+        EVENT_COUNT
+    };
+    
+    /** The number of records kept per thread. */
+    static const int CAPACITY = 1024;
+    
+    /** The number of characters of text kept per record. */
+    static const int TEXT_LENGTH = 16;
+    
+    /** A record read from a ring. */
+    struct Entry {
+        /** The number of the thread, in order of first trace. */
+        int thread;
+        Event event;
+        /** The start time from a monotonic clock. */
+        int64_t startNanos;
+        /** The time taken by a span, zero for an event. */
+        int64_t durationNanos;
+        int64_t value;
+        /** The start of the text. */
+        string text;
+    };
+    
+    /**
+     * Records the time taken by its scope as one trace record.
+     */
+    class Span {
+        
+    private:
+        
+        Event iEvent;
+        int64_t iValue;
+        uint64_t iText[2];
+        int64_t iStart;
+        
+        Span(const Span &other);
+        Span &operator=(const Span &other);
+        
+    public:
+        
+        Span(Event event, int64_t value, const string &text);
+        ~Span();
+    };
+    
+private:
+    
+    struct Ring;
+    struct Registry;
+    
+    static Registry &getRegistry();
+    static Ring *getRing();
+    static int64_t nanoTime();
+    static void pack(const string &text, uint64_t *packed);
+    static void write(Event event, int64_t start, int64_t duration, int64_t value, const uint64_t *text);
+    
+    CodaTimeTrace();
+    
+public:
+    
+    /**
+     * Checks whether the trace points are compiled in.
+     *
+     * @return true if compiled with CODATIME_ENABLE_TRACE
+     */
+    static bool isEnabled();
+    
+    /**
+     * Records an event on the calling thread.
+     *
+     * @param event  the trace point
+     * @param value  a value for the event, such as a year
+     * @param text  a text for the event, truncated to {@link #TEXT_LENGTH}
+     */
+    static void record(Event event, int64_t value, const string &text);
+    
+    /**
+     * Reads the records of all threads, oldest first.
+     *
+     * @return the records
+     */
+    static vector<Entry> snapshot();
+    
+    /**
+     * Reads the records of all threads, one per line, oldest first.
+     *
+     * @return the records as text
+     */
+    static string dump();
+    
+    /**
+     * Gets the name of a trace point.
+     *
+     * @param event  the trace point
+     * @return the name, such as "zoneForId"
+     */
+    static string getEventName(Event event);
+    
+};
+
+CODATIME_END
+
+#endif /* defined(__CodaTime__CodaTimeTrace__) */
@@ -235,7 +235,7 @@ DateTime *DateTime::withLaterOffsetAtOverlap() {
  * <p>
  * To set a single field use the properties, for example:
  * <pre>
- * DateTime *set = monthOfYear()->setCopy(6);
+ * DateTime *set = monthOfYear().setCopy(6);
  * </pre>
  * <p>
  * This instance is immutable and unaffected by this method call.
@@ -262,7 +262,7 @@ DateTime *DateTime::withDate(int year, int monthOfYear, int dayOfMonth) {
  * <p>
  * To set a single field use the properties, for example:
  * <pre>
- * DateTime *set = dt.hourOfDay()->setCopy(6);
+ * DateTime *set = dt.hourOfDay().setCopy(6);
  * </pre>
  * <p>
  * This instance is immutable and unaffected by this method call.
@@ -330,7 +330,7 @@ DateTime *DateTime::withFields(ReadablePartial *partial) {
  * These three lines are equivalent:
  * <pre>
  * DateTime *updated = dt.withField(DateTimeFieldType.dayOfMonth(), 6);
- * DateTime *updated = dt.dayOfMonth()->setCopy(6);
+ * DateTime *updated = dt.dayOfMonth().setCopy(6);
  * DateTime *updated = dt.property(DateTimeFieldType.dayOfMonth()).setCopy(6);
  * </pre>
  *
@@ -1022,7 +1022,7 @@ DateTime *DateTime::minusMillis(int millis) {
  * @return the property object
  * @throws IllegalArgumentException if the field is null or unsupported
  */
-DateTime::Property *DateTime::property(DateTimeFieldType *type) {
+DateTime::Property DateTime::property(DateTimeFieldType *type) {
     if (type == NULL) {
         throw IllegalArgumentException("The DateTimeFieldType must not be null");
     }
@@ -1033,7 +1033,7 @@ DateTime::Property *DateTime::property(DateTimeFieldType *type) {
         err.append("' is not supported");
         throw IllegalArgumentException(err);
     }
-    return new Property(this, field);
+    return Property(this, field);
 }
 
 /**
@@ -1345,8 +1345,8 @@ DateTime *DateTime::withMillisOfDay(int millis) {
  *
  * @return the era property
  */
-DateTime::Property *DateTime::era() {
-    return new Property(this, getChronology()->era());
+DateTime::Property DateTime::era() {
+    return Property(this, getChronology()->era());
 }
 
 /**
@@ -1354,8 +1354,8 @@ DateTime::Property *DateTime::era() {
  *
  * @return the year of era property
  */
-DateTime::Property *DateTime::centuryOfEra() {
-    return new Property(this, getChronology()->centuryOfEra());
+DateTime::Property DateTime::centuryOfEra() {
+    return Property(this, getChronology()->centuryOfEra());
 }
 
 /**
@@ -1363,8 +1363,8 @@ DateTime::Property *DateTime::centuryOfEra() {
  *
  * @return the year of era property
  */
-DateTime::Property *DateTime::yearOfCentury() {
-    return new Property(this, getChronology()->yearOfCentury());
+DateTime::Property DateTime::yearOfCentury() {
+    return Property(this, getChronology()->yearOfCentury());
 }
 
 /**
@@ -1372,8 +1372,8 @@ DateTime::Property *DateTime::yearOfCentury() {
  *
  * @return the year of era property
  */
-DateTime::Property *DateTime::yearOfEra() {
-    return new Property(this, getChronology()->yearOfEra());
+DateTime::Property DateTime::yearOfEra() {
+    return Property(this, getChronology()->yearOfEra());
 }
 
 /**
@@ -1381,8 +1381,8 @@ DateTime::Property *DateTime::yearOfEra() {
  *
  * @return the year property
  */
-DateTime::Property *DateTime::year() {
-    return new Property(this, getChronology()->year());
+DateTime::Property DateTime::year() {
+    return Property(this, getChronology()->year());
 }
 
 /**
@@ -1390,8 +1390,8 @@ DateTime::Property *DateTime::year() {
  *
  * @return the year of a week based year property
  */
-DateTime::Property *DateTime::weekyear() {
-    return new Property(this, getChronology()->weekyear());
+DateTime::Property DateTime::weekyear() {
+    return Property(this, getChronology()->weekyear());
 }
 
 /**
@@ -1399,8 +1399,8 @@ DateTime::Property *DateTime::weekyear() {
  *
  * @return the month of year property
  */
-DateTime::Property *DateTime::monthOfYear() {
-    return new Property(this, getChronology()->monthOfYear());
+DateTime::Property DateTime::monthOfYear() {
+    return Property(this, getChronology()->monthOfYear());
 }
 
 /**
@@ -1408,8 +1408,8 @@ DateTime::Property *DateTime::monthOfYear() {
  *
  * @return the week of a week based year property
  */
-DateTime::Property *DateTime::weekOfWeekyear() {
-    return new Property(this, getChronology()->weekOfWeekyear());
+DateTime::Property DateTime::weekOfWeekyear() {
+    return Property(this, getChronology()->weekOfWeekyear());
 }
 
 /**
@@ -1417,8 +1417,8 @@ DateTime::Property *DateTime::weekOfWeekyear() {
  *
  * @return the day of year property
  */
-DateTime::Property *DateTime::dayOfYear() {
-    return new Property(this, getChronology()->dayOfYear());
+DateTime::Property DateTime::dayOfYear() {
+    return Property(this, getChronology()->dayOfYear());
 }
 
 /**
@@ -1426,8 +1426,8 @@ DateTime::Property *DateTime::dayOfYear() {
  *
  * @return the day of month property
  */
-DateTime::Property *DateTime::dayOfMonth() {
-    return new Property(this, getChronology()->dayOfMonth());
+DateTime::Property DateTime::dayOfMonth() {
+    return Property(this, getChronology()->dayOfMonth());
 }
 
 /**
@@ -1435,8 +1435,8 @@ DateTime::Property *DateTime::dayOfMonth() {
  *
  * @return the day of week property
  */
-DateTime::Property *DateTime::dayOfWeek() {
-    return new Property(this, getChronology()->dayOfWeek());
+DateTime::Property DateTime::dayOfWeek() {
+    return Property(this, getChronology()->dayOfWeek());
 }
 
 // Time properties
@@ -1446,8 +1446,8 @@ DateTime::Property *DateTime::dayOfWeek() {
  *
  * @return the hour of day property
  */
-DateTime::Property *DateTime::hourOfDay() {
-    return new Property(this, getChronology()->hourOfDay());
+DateTime::Property DateTime::hourOfDay() {
+    return Property(this, getChronology()->hourOfDay());
 }
 
 /**
@@ -1455,8 +1455,8 @@ DateTime::Property *DateTime::hourOfDay() {
  *
  * @return the minute of day property
  */
-DateTime::Property *DateTime::minuteOfDay() {
-    return new Property(this, getChronology()->minuteOfDay());
+DateTime::Property DateTime::minuteOfDay() {
+    return Property(this, getChronology()->minuteOfDay());
 }
 
 /**
@@ -1464,8 +1464,8 @@ DateTime::Property *DateTime::minuteOfDay() {
  *
  * @return the minute of hour property
  */
-DateTime::Property *DateTime::minuteOfHour() {
-    return new Property(this, getChronology()->minuteOfHour());
+DateTime::Property DateTime::minuteOfHour() {
+    return Property(this, getChronology()->minuteOfHour());
 }
 
 /**
@@ -1473,8 +1473,8 @@ DateTime::Property *DateTime::minuteOfHour() {
  *
  * @return the second of day property
  */
-DateTime::Property *DateTime::secondOfDay() {
-    return new Property(this, getChronology()->secondOfDay());
+DateTime::Property DateTime::secondOfDay() {
+    return Property(this, getChronology()->secondOfDay());
 }
 
 /**
@@ -1482,8 +1482,8 @@ DateTime::Property *DateTime::secondOfDay() {
  *
  * @return the second of minute property
  */
-DateTime::Property *DateTime::secondOfMinute() {
-    return new Property(this, getChronology()->secondOfMinute());
+DateTime::Property DateTime::secondOfMinute() {
+    return Property(this, getChronology()->secondOfMinute());
 }
 
 /**
@@ -1491,8 +1491,8 @@ DateTime::Property *DateTime::secondOfMinute() {
  *
  * @return the millis of day property
  */
-DateTime::Property *DateTime::millisOfDay() {
-    return new Property(this, getChronology()->millisOfDay());
+DateTime::Property DateTime::millisOfDay() {
+    return Property(this, getChronology()->millisOfDay());
 }
 
 /**
@@ -1500,8 +1500,8 @@ DateTime::Property *DateTime::millisOfDay() {
  *
  * @return the millis of second property
  */
-DateTime::Property *DateTime::millisOfSecond() {
-    return new Property(this, getChronology()->millisOfSecond());
+DateTime::Property DateTime::millisOfSecond() {
+    return Property(this, getChronology()->millisOfSecond());
 }
 
 CODATIME_END
\ No newline at end of file
@@ -101,6 +101,10 @@ public:
      * Serious modification of dates (ie. more than just changing one or two fields)
      * should use the {@link org.joda.time.MutableDateTime MutableDateTime} class.
      * <p>
+     * A property only holds a pointer to the DateTime and to the field, and
+     * is returned by value, so that obtaining and using one does not allocate.
+     * It must not be used after the DateTime it came from is deleted.
+     * <p>
      * DateTime.Propery itself is thread-safe and immutable, as well as the
      * DateTime being operated on.
      *
@@ -808,7 +812,7 @@ public:
     DateTime *minusSeconds(int seconds);
     DateTime *minusMillis(int millis);
     
-    Property *property(DateTimeFieldType *type);
+    Property property(DateTimeFieldType *type);
     
     LocalDateTime *toLocalDateTime();
     LocalDate *toLocalDate();
@@ -831,24 +835,24 @@ public:
     DateTime *withMillisOfSecond(int millis);
     DateTime *withMillisOfDay(int millis);
     
-    Property *era();
-    Property *centuryOfEra();
-    Property *yearOfCentury();
-    Property *yearOfEra();
-    Property *year();
-    Property *weekyear();
-    Property *monthOfYear();
-    Property *weekOfWeekyear();
-    Property *dayOfYear();
-    Property *dayOfMonth();
-    Property *dayOfWeek();
-    Property *hourOfDay();
-    Property *minuteOfDay();
-    Property *minuteOfHour();
-    Property *secondOfDay();
-    Property *secondOfMinute();
-    Property *millisOfDay();
-    Property *millisOfSecond();
+    Property era();
+    Property centuryOfEra();
+    Property yearOfCentury();
+    Property yearOfEra();
+    Property year();
+    Property weekyear();
+    Property monthOfYear();
+    Property weekOfWeekyear();
+    Property dayOfYear();
+    Property dayOfMonth();
+    Property dayOfWeek();
+    Property hourOfDay();
+    Property minuteOfDay();
+    Property minuteOfHour();
+    Property secondOfDay();
+    Property secondOfMinute();
+    Property millisOfDay();
+    Property millisOfSecond();
 };
 
 CODATIME_END
@@ -0,0 +1,294 @@
+//
+//  DateTimeColumn.cpp
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#include "DateTimeColumn.h"
+
+#include "Chronology.h"
+#include "DateTime.h"
+#include "DateTimeField.h"
+#include "DateTimeFieldType.h"
+#include "DateTimeUtils.h"
+#include "DateTimeZone.h"
+#include "DurationField.h"
+#include "DurationFieldType.h"
+#include "Exceptions.h"
+#include "field/FieldUtils.h"
+#include "field/PreciseDateTimeField.h"
+#include "field/PreciseDurationDateTimeField.h"
+#include "ReadableInstant.h"
+
+#include <algorithm>
+
+CODATIME_BEGIN
+
+DateTimeColumn::DateTimeColumn(vector<int64_t> &millis, Chronology *chrono, bool sorted) {
+    iMillis.swap(millis);
+    iChronology = chrono;
+    iSorted = sorted;
+    iLocalMillisValid = false;
+}
+
+DateTimeColumn::DateTimeColumn(Chronology *chrono) {
+    iChronology = DateTimeUtils::getChronology(chrono);
+    iSorted = true;
+    iLocalMillisValid = false;
+}
+
+DateTimeColumn::DateTimeColumn(const int64_t *millis, size_t count, Chronology *chrono) {
+    iMillis.assign(millis, millis + count);
+    iChronology = DateTimeUtils::getChronology(chrono);
+    iSorted = is_sorted(iMillis.begin(), iMillis.end());
+    iLocalMillisValid = false;
+}
+
+DateTimeColumn::DateTimeColumn(ReadableInstant *const *instants, size_t count, Chronology *chrono) {
+    iMillis.resize(count);
+    for (size_t i = 0; i < count; i++) {
+        iMillis[i] = DateTimeUtils::getInstantMillis(instants[i]);
+    }
+    iChronology = DateTimeUtils::getChronology(chrono);
+    iSorted = is_sorted(iMillis.begin(), iMillis.end());
+    iLocalMillisValid = false;
+}
+
+//-----------------------------------------------------------------------
+size_t DateTimeColumn::size() const {
+    return iMillis.size();
+}
+
+bool DateTimeColumn::isEmpty() const {
+    return iMillis.empty();
+}
+
+Chronology *DateTimeColumn::getChronology() const {
+    return iChronology;
+}
+
+DateTimeZone *DateTimeColumn::getZone() const {
+    return iChronology->getZone();
+}
+
+bool DateTimeColumn::isSorted() const {
+    return iSorted;
+}
+
+const vector<int64_t> &DateTimeColumn::getMillis() const {
+    return iMillis;
+}
+
+int64_t DateTimeColumn::getMillis(size_t index) const {
+    if (index >= iMillis.size()) {
+        string err("Invalid index: ");
+        err.append(to_string(index));
+        throw IndexOutOfBoundsException(err);
+    }
+    return iMillis[index];
+}
+
+const vector<int64_t> &DateTimeColumn::getLocalMillis() const {
+    if (iLocalMillisValid) {
+        return iLocalMillis;
+    }
+    DateTimeZone *zone = getZone();
+    if (zone->isFixed()) {
+        int64_t offset = zone->getOffset((int64_t) 0);
+        if (offset == 0) {
+            return iMillis;
+        }
+        iLocalMillis.resize(iMillis.size());
+        for (size_t i = 0; i < iMillis.size(); i++) {
+            iLocalMillis[i] = FieldUtils::safeAdd(iMillis[i], offset);
+        }
+    } else {
+        iLocalMillis.resize(iMillis.size());
+        for (size_t i = 0; i < iMillis.size(); i++) {
+            iLocalMillis[i] = zone->convertUTCToLocal(iMillis[i]);
+        }
+    }
+    iLocalMillisValid = true;
+    return iLocalMillis;
+}
+
+DateTime *DateTimeColumn::getDateTime(size_t index) const {
+    return new DateTime(getMillis(index), iChronology);
+}
+
+//-----------------------------------------------------------------------
+const vector<int> &DateTimeColumn::get(const DateTimeFieldType *type) const {
+    if (type == NULL) {
+        throw IllegalArgumentException("The DateTimeFieldType must not be null");
+    }
+    map<const DateTimeFieldType*, vector<int>>::iterator it = iFields.find(type);
+    if (it != iFields.end()) {
+        return it->second;
+    }
+    
+    // fields are read from the local millis in UTC, as a zoned chronology would do row by row
+    const vector<int64_t> &local = getLocalMillis();
+    const DateTimeField *field = type->getField(iChronology->withUTC());
+    vector<int> values = vector<int>(local.size());
+    const PreciseDateTimeField *precise = dynamic_cast<const PreciseDateTimeField*>(field);
+    if (precise != NULL) {
+        int64_t unit = precise->getUnitMillis();
+        int range = precise->getMaximumValue() + 1;
+        for (size_t i = 0; i < local.size(); i++) {
+            int64_t instant = local[i];
+            values[i] = (instant >= 0 ? (int) ((instant / unit) % range) :
+                         range - 1 + (int) (((instant + 1) / unit) % range));
+        }
+    } else {
+        for (size_t i = 0; i < local.size(); i++) {
+            values[i] = field->get(local[i]);
+        }
+    }
+    vector<int> &cached = iFields[type];
+    cached.swap(values);
+    return cached;
+}
+
+//-----------------------------------------------------------------------
+DateTimeColumn DateTimeColumn::plus(const DurationFieldType *type, int amount) const {
+    if (type == NULL) {
+        throw IllegalArgumentException("The DurationFieldType must not be null");
+    }
+    vector<int64_t> millis = iMillis;
+    if (amount == 0) {
+        return DateTimeColumn(millis, iChronology, iSorted);
+    }
+    const DurationField *field = type->getField(iChronology);
+    if (field->isPrecise()) {
+        int64_t delta = FieldUtils::safeMultiply(field->getUnitMillis(), amount);
+        for (size_t i = 0; i < millis.size(); i++) {
+            millis[i] = FieldUtils::safeAdd(millis[i], delta);
+        }
+        return DateTimeColumn(millis, iChronology, iSorted);
+    }
+    for (size_t i = 0; i < millis.size(); i++) {
+        millis[i] = field->add(millis[i], amount);
+    }
+    bool sorted = is_sorted(millis.begin(), millis.end());
+    return DateTimeColumn(millis, iChronology, sorted);
+}
+
+DateTimeColumn DateTimeColumn::plusYears(int years) const {
+    return plus(DurationFieldType::years(), years);
+}
+
+DateTimeColumn DateTimeColumn::plusMonths(int months) const {
+    return plus(DurationFieldType::months(), months);
+}
+
+DateTimeColumn DateTimeColumn::plusWeeks(int weeks) const {
+    return plus(DurationFieldType::weeks(), weeks);
+}
+
+DateTimeColumn DateTimeColumn::plusDays(int days) const {
+    return plus(DurationFieldType::days(), days);
+}
+
+DateTimeColumn DateTimeColumn::plusHours(int hours) const {
+    return plus(DurationFieldType::hours(), hours);
+}
+
+DateTimeColumn DateTimeColumn::plusMinutes(int minutes) const {
+    return plus(DurationFieldType::minutes(), minutes);
+}
+
+DateTimeColumn DateTimeColumn::plusSeconds(int seconds) const {
+    return plus(DurationFieldType::seconds(), seconds);
+}
+
+DateTimeColumn DateTimeColumn::plusMillis(int millis) const {
+    return plus(DurationFieldType::millis(), millis);
+}
+
+//-----------------------------------------------------------------------
+DateTimeColumn DateTimeColumn::select(const vector<size_t> &indices) const {
+    vector<int64_t> millis = vector<int64_t>(indices.size());
+    for (size_t i = 0; i < indices.size(); i++) {
+        millis[i] = getMillis(indices[i]);
+    }
+    bool sorted = is_sorted(millis.begin(), millis.end());
+    return DateTimeColumn(millis, iChronology, sorted);
+}
+
+DateTimeColumn DateTimeColumn::filter(int64_t startInstant, int64_t endInstant) const {
+    if (endInstant < startInstant) {
+        throw IllegalArgumentException("The end instant must be greater or equal to the start");
+    }
+    vector<int64_t> millis;
+    if (iSorted) {
+        vector<int64_t>::const_iterator first = lower_bound(iMillis.begin(), iMillis.end(), startInstant);
+        vector<int64_t>::const_iterator last = lower_bound(first, iMillis.end(), endInstant);
+        millis.assign(first, last);
+    } else {
+        for (size_t i = 0; i < iMillis.size(); i++) {
+            if (iMillis[i] >= startInstant && iMillis[i] < endInstant) {
+                millis.push_back(iMillis[i]);
+            }
+        }
+    }
+    return DateTimeColumn(millis, iChronology, iSorted);
+}
+
+DateTimeColumn DateTimeColumn::filter(const DateTimeFieldType *type, int value) const {
+    const vector<int> &values = get(type);
+    vector<int64_t> millis;
+    for (size_t i = 0; i < iMillis.size(); i++) {
+        if (values[i] == value) {
+            millis.push_back(iMillis[i]);
+        }
+    }
+    return DateTimeColumn(millis, iChronology, iSorted);
+}
+
+//-----------------------------------------------------------------------
+DateTimeColumn DateTimeColumn::sorted() const {
+    vector<int64_t> millis = iMillis;
+    if (iSorted == false) {
+        sort(millis.begin(), millis.end());
+    }
+    return DateTimeColumn(millis, iChronology, true);
+}
+
+DateTimeColumn DateTimeColumn::distinct() const {
+    vector<int64_t> millis = iMillis;
+    if (iSorted == false) {
+        sort(millis.begin(), millis.end());
+    }
+    millis.erase(unique(millis.begin(), millis.end()), millis.end());
+    return DateTimeColumn(millis, iChronology, true);
+}
+
+DateTimeColumn DateTimeColumn::roundFloor(const DateTimeFieldType *type) const {
+    if (type == NULL) {
+        throw IllegalArgumentException("The DateTimeFieldType must not be null");
+    }
+    const DateTimeField *field = type->getField(iChronology);
+    vector<int64_t> millis = iMillis;
+    const PreciseDurationDateTimeField *precise = dynamic_cast<const PreciseDurationDateTimeField*>(field);
+    if (precise != NULL) {
+        int64_t unit = precise->getUnitMillis();
+        for (size_t i = 0; i < millis.size(); i++) {
+            int64_t instant = millis[i];
+            if (instant >= 0) {
+                millis[i] = instant - instant % unit;
+            } else {
+                instant += 1;
+                millis[i] = instant - instant % unit - unit;
+            }
+        }
+    } else {
+        for (size_t i = 0; i < millis.size(); i++) {
+            millis[i] = field->roundFloor(millis[i]);
+        }
+    }
+    return DateTimeColumn(millis, iChronology, iSorted);
+}
+
+CODATIME_END
@@ -0,0 +1,245 @@
+//
+//  DateTimeColumn.h
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#ifndef __CodaTime__DateTimeColumn__
+#define __CodaTime__DateTimeColumn__
+
+#include "CodaTimeMacros.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+using namespace std;
+
+CODATIME_BEGIN
+
+class Chronology;
+class DateTime;
+class DateTimeFieldType;
+class DateTimeZone;
+class DurationFieldType;
+class ReadableInstant;
+
+/**
+ * DateTimeColumn holds many date-times that share one chronology.
+ * <p>
+ * The instants are held as a plain array of millis with a single chronology,
+ * instead of one <code>DateTime</code> object each. Operations work on the
+ * whole column at once:
+ * <ul>
+ * <li>{@link #get} reads a field for every row, from the local millis of
+ *  each row, so the zone is applied once per row rather than once per field
+ * <li>{@link #plus} and its shortcuts add an amount to every row
+ * <li>{@link #filter} and {@link #select} keep a subset of the rows
+ * <li>{@link #sorted}, {@link #distinct} and {@link #roundFloor} transform
+ *  the column, and a sorted column is filtered by binary search
+ * </ul>
+ * Where a field or duration is precise, such as hours in UTC, the work is a
+ * simple loop over the array. Otherwise each row goes through the chronology
+ * as a <code>DateTime</code> would.
+ * <p>
+ * The local millis and each field that is read are cached as derived
+ * columns, so DateTimeColumn is not thread-safe. It is otherwise immutable,
+ * each operation returning a new column.
+ */
+class DateTimeColumn {
+    
+private:
+    
+    vector<int64_t> iMillis;
+    Chronology *iChronology;
+    bool iSorted;
+    
+    mutable vector<int64_t> iLocalMillis;
+    mutable bool iLocalMillisValid;
+    mutable map<const DateTimeFieldType*, vector<int>> iFields;
+    
+    DateTimeColumn(vector<int64_t> &millis, Chronology *chrono, bool sorted);
+    
+public:
+    
+    /**
+     * Creates an empty column.
+     *
+     * @param chrono  the chronology, null means ISO in the default zone
+     */
+    DateTimeColumn(Chronology *chrono);
+    
+    /**
+     * Creates a column from millisecond instants.
+     *
+     * @param millis  the instants, not null
+     * @param count  the number of instants
+     * @param chrono  the chronology, null means ISO in the default zone
+     */
+    DateTimeColumn(const int64_t *millis, size_t count, Chronology *chrono);
+    
+    /**
+     * Creates a column from instants, which are all read in one chronology.
+     *
+     * @param instants  the instants, null elements mean now
+     * @param count  the number of instants
+     * @param chrono  the chronology, null means ISO in the default zone
+     */
+    DateTimeColumn(ReadableInstant *const *instants, size_t count, Chronology *chrono);
+    
+    //-----------------------------------------------------------------------
+    size_t size() const;
+    
+    bool isEmpty() const;
+    
+    Chronology *getChronology() const;
+    
+    DateTimeZone *getZone() const;
+    
+    /**
+     * Checks whether the rows are in ascending order.
+     *
+     * @return true if sorted
+     */
+    bool isSorted() const;
+    
+    /**
+     * Gets the millisecond instants of the rows.
+     *
+     * @return the millis, one per row
+     */
+    const vector<int64_t> &getMillis() const;
+    
+    int64_t getMillis(size_t index) const;
+    
+    /**
+     * Gets the local millis of the rows, which are the instants with the zone
+     * offset applied.
+     * <p>
+     * They are calculated on first use and cached. In a fixed zone this is a
+     * single addition per row, and in UTC no work at all.
+     *
+     * @return the local millis, one per row
+     */
+    const vector<int64_t> &getLocalMillis() const;
+    
+    /**
+     * Gets a row as a date-time.
+     *
+     * @param index  the row
+     * @return the date-time, owned by the caller
+     * @throws IndexOutOfBoundsException if the index is invalid
+     */
+    DateTime *getDateTime(size_t index) const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Gets the value of a field for every row.
+     * <p>
+     * The column is calculated on first use and cached.
+     *
+     * @param type  the field type, not null
+     * @return the values, one per row
+     * @throws IllegalArgumentException if the field type is null
+     */
+    const vector<int> &get(const DateTimeFieldType *type) const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Returns a copy of this column with an amount of a duration field added
+     * to every row.
+     *
+     * @param type  the duration field type, not null
+     * @param amount  the amount to add, may be negative
+     * @return the new column
+     * @throws IllegalArgumentException if the field type is null
+     * @throws ArithmeticException if any result overflows
+     */
+    DateTimeColumn plus(const DurationFieldType *type, int amount) const;
+    
+    DateTimeColumn plusYears(int years) const;
+    
+    DateTimeColumn plusMonths(int months) const;
+    
+    DateTimeColumn plusWeeks(int weeks) const;
+    
+    DateTimeColumn plusDays(int days) const;
+    
+    DateTimeColumn plusHours(int hours) const;
+    
+    DateTimeColumn plusMinutes(int minutes) const;
+    
+    DateTimeColumn plusSeconds(int seconds) const;
+    
+    DateTimeColumn plusMillis(int millis) const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Returns the rows at the specified indices, in the order given.
+     *
+     * @param indices  the rows to keep
+     * @return the new column
+     * @throws IndexOutOfBoundsException if any index is invalid
+     */
+    DateTimeColumn select(const vector<size_t> &indices) const;
+    
+    /**
+     * Returns the rows from the start instant inclusive to the end instant
+     * exclusive, in their current order.
+     * <p>
+     * A sorted column is searched, so the cost depends on the number of rows
+     * returned rather than the size of the column.
+     *
+     * @param startInstant  the first instant to keep
+     * @param endInstant  the instant to stop at
+     * @return the new column
+     * @throws IllegalArgumentException if the end is before the start
+     */
+    DateTimeColumn filter(int64_t startInstant, int64_t endInstant) const;
+    
+    /**
+     * Returns the rows where a field has the specified value.
+     *
+     * @param type  the field type, not null
+     * @param value  the value to match
+     * @return the new column
+     * @throws IllegalArgumentException if the field type is null
+     */
+    DateTimeColumn filter(const DateTimeFieldType *type, int value) const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Returns the rows in ascending order.
+     *
+     * @return the sorted column
+     */
+    DateTimeColumn sorted() const;
+    
+    /**
+     * Returns the distinct rows in ascending order.
+     *
+     * @return the sorted column without duplicates
+     */
+    DateTimeColumn distinct() const;
+    
+    /**
+     * Returns every row rounded down to the start of a field, such as the
+     * start of the hour or the day.
+     * <p>
+     * Rounding down keeps the order of the rows, so a sorted column stays
+     * sorted and may be passed to {@link #distinct} to find the buckets.
+     *
+     * @param type  the field type, not null
+     * @return the new column
+     * @throws IllegalArgumentException if the field type is null
+     */
+    DateTimeColumn roundFloor(const DateTimeFieldType *type) const;
+    
+};
+
+CODATIME_END
+
+#endif /* defined(__CodaTime__DateTimeColumn__) */
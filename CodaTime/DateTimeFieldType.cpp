@@ -15,29 +15,124 @@
 
 CODATIME_BEGIN
 
-const DateTimeFieldType *DateTimeFieldType::ERA_TYPE = new StandardDateTimeFieldType("era", DateTimeFieldType::ERA, DurationFieldType::eras(), NULL);
-const DateTimeFieldType *DateTimeFieldType::YEAR_OF_ERA_TYPE = new StandardDateTimeFieldType("yearOfEra", DateTimeFieldType::YEAR_OF_ERA, DurationFieldType::years(), DurationFieldType::eras());
-const DateTimeFieldType *DateTimeFieldType::CENTURY_OF_ERA_TYPE = new StandardDateTimeFieldType("centuryOfEra", DateTimeFieldType::CENTURY_OF_ERA, DurationFieldType::centuries(), DurationFieldType::eras());
-const DateTimeFieldType *DateTimeFieldType::YEAR_OF_CENTURY_TYPE = new StandardDateTimeFieldType("yearOfCentury", DateTimeFieldType::YEAR_OF_CENTURY, DurationFieldType::years(), DurationFieldType::centuries());
-const DateTimeFieldType *DateTimeFieldType::YEAR_TYPE = new StandardDateTimeFieldType("year", DateTimeFieldType::YEAR, DurationFieldType::years(), NULL);
-const DateTimeFieldType *DateTimeFieldType::DAY_OF_YEAR_TYPE = new StandardDateTimeFieldType("dayOfYear", DateTimeFieldType::DAY_OF_YEAR, DurationFieldType::days(), DurationFieldType::years());
-const DateTimeFieldType *DateTimeFieldType::MONTH_OF_YEAR_TYPE = new StandardDateTimeFieldType("monthOfYear", DateTimeFieldType::MONTH_OF_YEAR, DurationFieldType::months(), DurationFieldType::years());
-const DateTimeFieldType *DateTimeFieldType::DAY_OF_MONTH_TYPE = new StandardDateTimeFieldType("dayOfMonth", DateTimeFieldType::DAY_OF_MONTH, DurationFieldType::days(), DurationFieldType::months());
-const DateTimeFieldType *DateTimeFieldType::WEEKYEAR_OF_CENTURY_TYPE = new StandardDateTimeFieldType("weekyearOfCentury", DateTimeFieldType::WEEKYEAR_OF_CENTURY, DurationFieldType::weekyears(), DurationFieldType::centuries());
-const DateTimeFieldType *DateTimeFieldType::WEEKYEAR_TYPE = new StandardDateTimeFieldType("weekyear", DateTimeFieldType::WEEKYEAR, DurationFieldType::weekyears(), NULL);
-const DateTimeFieldType *DateTimeFieldType::WEEK_OF_WEEKYEAR_TYPE = new StandardDateTimeFieldType("weekOfWeekyear", DateTimeFieldType::WEEK_OF_WEEKYEAR, DurationFieldType::weeks(), DurationFieldType::weekyears());
-const DateTimeFieldType *DateTimeFieldType::DAY_OF_WEEK_TYPE = new StandardDateTimeFieldType("dayOfWeek", DateTimeFieldType::DAY_OF_WEEK, DurationFieldType::days(), DurationFieldType::weeks());
-const DateTimeFieldType *DateTimeFieldType::HALFDAY_OF_DAY_TYPE = new StandardDateTimeFieldType("halfdayOfDay", DateTimeFieldType::HALFDAY_OF_DAY, DurationFieldType::halfdays(), DurationFieldType::days());
-const DateTimeFieldType *DateTimeFieldType::HOUR_OF_HALFDAY_TYPE = new StandardDateTimeFieldType("hourOfHalfday", DateTimeFieldType::HOUR_OF_HALFDAY, DurationFieldType::hours(), DurationFieldType::halfdays());
-const DateTimeFieldType *DateTimeFieldType::CLOCKHOUR_OF_HALFDAY_TYPE = new StandardDateTimeFieldType("clockhourOfHalfday", DateTimeFieldType::CLOCKHOUR_OF_HALFDAY, DurationFieldType::hours(), DurationFieldType::halfdays());
-const DateTimeFieldType *DateTimeFieldType::CLOCKHOUR_OF_DAY_TYPE = new StandardDateTimeFieldType("clockhourOfDay", DateTimeFieldType::CLOCKHOUR_OF_DAY, DurationFieldType::hours(), DurationFieldType::days());
-const DateTimeFieldType *DateTimeFieldType::HOUR_OF_DAY_TYPE = new StandardDateTimeFieldType("hourOfDay", DateTimeFieldType::HOUR_OF_DAY, DurationFieldType::hours(), DurationFieldType::days());
-const DateTimeFieldType *DateTimeFieldType::MINUTE_OF_DAY_TYPE = new StandardDateTimeFieldType("minuteOfDay", DateTimeFieldType::MINUTE_OF_DAY, DurationFieldType::minutes(), DurationFieldType::days());
-const DateTimeFieldType *DateTimeFieldType::MINUTE_OF_HOUR_TYPE = new StandardDateTimeFieldType("minuteOfHour", DateTimeFieldType::MINUTE_OF_HOUR, DurationFieldType::minutes(), DurationFieldType::hours());
-const DateTimeFieldType *DateTimeFieldType::SECOND_OF_DAY_TYPE = new StandardDateTimeFieldType("secondOfDay", DateTimeFieldType::SECOND_OF_DAY, DurationFieldType::seconds(), DurationFieldType::days());
-const DateTimeFieldType *DateTimeFieldType::SECOND_OF_MINUTE_TYPE = new StandardDateTimeFieldType("secondOfMinute", DateTimeFieldType::SECOND_OF_MINUTE, DurationFieldType::seconds(), DurationFieldType::minutes());
-const DateTimeFieldType *DateTimeFieldType::MILLIS_OF_DAY_TYPE = new StandardDateTimeFieldType("millisOfDay", DateTimeFieldType::MILLIS_OF_DAY, DurationFieldType::millis(), DurationFieldType::days());
-const DateTimeFieldType *DateTimeFieldType::MILLIS_OF_SECOND_TYPE = new StandardDateTimeFieldType("millisOfSecond", DateTimeFieldType::MILLIS_OF_SECOND, DurationFieldType::millis(), DurationFieldType::seconds());
+// the standard types are built on first use, so loading the library runs no
+// initializer for them, and the duration types they refer to, built the same
+// way, are always ready
+
+const DateTimeFieldType *DateTimeFieldType::era() {
+    static const DateTimeFieldType *const cType = new StandardDateTimeFieldType("era", ERA, DurationFieldType::eras(), NULL);
+    return cType;
+}
+
+const DateTimeFieldType *DateTimeFieldType::yearOfEra() {
+    static const DateTimeFieldType *const cType = new StandardDateTimeFieldType("yearOfEra", YEAR_OF_ERA, DurationFieldType::years(), DurationFieldType::eras());
+    return cType;
+}
+
+const DateTimeFieldType *DateTimeFieldType::centuryOfEra() {
+    static const DateTimeFieldType *const cType = new StandardDateTimeFieldType("centuryOfEra", CENTURY_OF_ERA, DurationFieldType::centuries(), DurationFieldType::eras());
+    return cType;
+}
+
+const DateTimeFieldType *DateTimeFieldType::yearOfCentury() {
+    static const DateTimeFieldType *const cType = new StandardDateTimeFieldType("yearOfCentury", YEAR_OF_CENTURY, DurationFieldType::years(), DurationFieldType::centuries());
+    return cType;
+}
+
+const DateTimeFieldType *DateTimeFieldType::year() {
+    static const DateTimeFieldType *const cType = new StandardDateTimeFieldType("year", YEAR, DurationFieldType::years(), NULL);
+    return cType;
+}
+
+const DateTimeFieldType *DateTimeFieldType::dayOfYear() {
+    static const DateTimeFieldType *const cType = new StandardDateTimeFieldType("dayOfYear", DAY_OF_YEAR, DurationFieldType::days(), DurationFieldType::years());
+    return cType;
+}
+
+const DateTimeFieldType *DateTimeFieldType::monthOfYear() {
+    static const DateTimeFieldType *const cType = new StandardDateTimeFieldType("monthOfYear", MONTH_OF_YEAR, DurationFieldType::months(), DurationFieldType::years());
+    return cType;
+}
+
+const DateTimeFieldType *DateTimeFieldType::dayOfMonth() {
+    static const DateTimeFieldType *const cType = new StandardDateTimeFieldType("dayOfMonth", DAY_OF_MONTH, DurationFieldType::days(), DurationFieldType::months());
+    return cType;
+}
+
+const DateTimeFieldType *DateTimeFieldType::weekyearOfCentury() {
+    static const DateTimeFieldType *const cType = new StandardDateTimeFieldType("weekyearOfCentury", WEEKYEAR_OF_CENTURY, DurationFieldType::weekyears(), DurationFieldType::centuries());
+    return cType;
+}
+
+const DateTimeFieldType *DateTimeFieldType::weekyear() {
+    static const DateTimeFieldType *const cType = new StandardDateTimeFieldType("weekyear", WEEKYEAR, DurationFieldType::weekyears(), NULL);
+    return cType;
+}
+
+const DateTimeFieldType *DateTimeFieldType::weekOfWeekyear() {
+    static const DateTimeFieldType *const cType = new StandardDateTimeFieldType("weekOfWeekyear", WEEK_OF_WEEKYEAR, DurationFieldType::weeks(), DurationFieldType::weekyears());
+    return cType;
+}
+
+const DateTimeFieldType *DateTimeFieldType::dayOfWeek() {
+    static const DateTimeFieldType *const cType = new StandardDateTimeFieldType("dayOfWeek", DAY_OF_WEEK, DurationFieldType::days(), DurationFieldType::weeks());
+    return cType;
+}
+
+const DateTimeFieldType *DateTimeFieldType::halfdayOfDay() {
+    static const DateTimeFieldType *const cType = new StandardDateTimeFieldType("halfdayOfDay", HALFDAY_OF_DAY, DurationFieldType::halfdays(), DurationFieldType::days());
+    return cType;
+}
+
+const DateTimeFieldType *DateTimeFieldType::hourOfHalfday() {
+    static const DateTimeFieldType *const cType = new StandardDateTimeFieldType("hourOfHalfday", HOUR_OF_HALFDAY, DurationFieldType::hours(), DurationFieldType::halfdays());
+    return cType;
+}
+
+const DateTimeFieldType *DateTimeFieldType::clockhourOfHalfday() {
+    static const DateTimeFieldType *const cType = new StandardDateTimeFieldType("clockhourOfHalfday", CLOCKHOUR_OF_HALFDAY, DurationFieldType::hours(), DurationFieldType::halfdays());
+    return cType;
+}
+
+const DateTimeFieldType *DateTimeFieldType::clockhourOfDay() {
+    static const DateTimeFieldType *const cType = new StandardDateTimeFieldType("clockhourOfDay", CLOCKHOUR_OF_DAY, DurationFieldType::hours(), DurationFieldType::days());
+    return cType;
+}
+
+const DateTimeFieldType *DateTimeFieldType::hourOfDay() {
+    static const DateTimeFieldType *const cType = new StandardDateTimeFieldType("hourOfDay", HOUR_OF_DAY, DurationFieldType::hours(), DurationFieldType::days());
+    return cType;
+}
+
+const DateTimeFieldType *DateTimeFieldType::minuteOfDay() {
+    static const DateTimeFieldType *const cType = new StandardDateTimeFieldType("minuteOfDay", MINUTE_OF_DAY, DurationFieldType::minutes(), DurationFieldType::days());
+    return cType;
+}
+
+const DateTimeFieldType *DateTimeFieldType::minuteOfHour() {
+    static const DateTimeFieldType *const cType = new StandardDateTimeFieldType("minuteOfHour", MINUTE_OF_HOUR, DurationFieldType::minutes(), DurationFieldType::hours());
+    return cType;
+}
+
+const DateTimeFieldType *DateTimeFieldType::secondOfDay() {
+    static const DateTimeFieldType *const cType = new StandardDateTimeFieldType("secondOfDay", SECOND_OF_DAY, DurationFieldType::seconds(), DurationFieldType::days());
+    return cType;
+}
+
+const DateTimeFieldType *DateTimeFieldType::secondOfMinute() {
+    static const DateTimeFieldType *const cType = new StandardDateTimeFieldType("secondOfMinute", SECOND_OF_MINUTE, DurationFieldType::seconds(), DurationFieldType::minutes());
+    return cType;
+}
+
+const DateTimeFieldType *DateTimeFieldType::millisOfDay() {
+    static const DateTimeFieldType *const cType = new StandardDateTimeFieldType("millisOfDay", MILLIS_OF_DAY, DurationFieldType::millis(), DurationFieldType::days());
+    return cType;
+}
+
+const DateTimeFieldType *DateTimeFieldType::millisOfSecond() {
+    static const DateTimeFieldType *const cType = new StandardDateTimeFieldType("millisOfSecond", MILLIS_OF_SECOND, DurationFieldType::millis(), DurationFieldType::seconds());
+    return cType;
+}
 
 bool DateTimeFieldType::isSupported(Chronology *chronology) {
     return getField(chronology)->isSupported();
@@ -151,51 +246,51 @@ const DateTimeField *StandardDateTimeFieldType::getField(Chronology *chronology)
 const void *StandardDateTimeFieldType::readResolve() {
     switch (iOrdinal) {
         case ERA:
-            return ERA_TYPE;
+            return era();
         case YEAR_OF_ERA:
-            return YEAR_OF_ERA_TYPE;
+            return yearOfEra();
         case CENTURY_OF_ERA:
-            return CENTURY_OF_ERA_TYPE;
+            return centuryOfEra();
         case YEAR_OF_CENTURY:
-            return YEAR_OF_CENTURY_TYPE;
+            return yearOfCentury();
         case YEAR:
-            return YEAR_TYPE;
+            return year();
         case DAY_OF_YEAR:
-            return DAY_OF_YEAR_TYPE;
+            return dayOfYear();
         case MONTH_OF_YEAR:
-            return MONTH_OF_YEAR_TYPE;
+            return monthOfYear();
         case DAY_OF_MONTH:
-            return DAY_OF_MONTH_TYPE;
+            return dayOfMonth();
         case WEEKYEAR_OF_CENTURY:
-            return WEEKYEAR_OF_CENTURY_TYPE;
+            return weekyearOfCentury();
         case WEEKYEAR:
-            return WEEKYEAR_TYPE;
+            return weekyear();
         case WEEK_OF_WEEKYEAR:
-            return WEEK_OF_WEEKYEAR_TYPE;
+            return weekOfWeekyear();
         case DAY_OF_WEEK:
-            return DAY_OF_WEEK_TYPE;
+            return dayOfWeek();
         case HALFDAY_OF_DAY:
-            return HALFDAY_OF_DAY_TYPE;
+            return halfdayOfDay();
         case HOUR_OF_HALFDAY:
-            return HOUR_OF_HALFDAY_TYPE;
+            return hourOfHalfday();
         case CLOCKHOUR_OF_HALFDAY:
-            return CLOCKHOUR_OF_HALFDAY_TYPE;
+            return clockhourOfHalfday();
         case CLOCKHOUR_OF_DAY:
-            return CLOCKHOUR_OF_DAY_TYPE;
+            return clockhourOfDay();
         case HOUR_OF_DAY:
-            return HOUR_OF_DAY_TYPE;
+            return hourOfDay();
         case MINUTE_OF_DAY:
-            return MINUTE_OF_DAY_TYPE;
+            return minuteOfDay();
         case MINUTE_OF_HOUR:
-            return MINUTE_OF_HOUR_TYPE;
+            return minuteOfHour();
         case SECOND_OF_DAY:
-            return SECOND_OF_DAY_TYPE;
+            return secondOfDay();
         case SECOND_OF_MINUTE:
-            return SECOND_OF_MINUTE_TYPE;
+            return secondOfMinute();
         case MILLIS_OF_DAY:
-            return MILLIS_OF_DAY_TYPE;
+            return millisOfDay();
         case MILLIS_OF_SECOND:
-            return MILLIS_OF_SECOND_TYPE;
+            return millisOfSecond();
         default:
             // Shouldn't happen.
             return this;
@@ -58,54 +58,6 @@ private:
     
 protected:
     
-    /** The era field type. */
-    static const DateTimeFieldType *ERA_TYPE;
-    /** The yearOfEra field type. */
-    static const DateTimeFieldType *YEAR_OF_ERA_TYPE;
-    /** The centuryOfEra field type. */
-    static const DateTimeFieldType *CENTURY_OF_ERA_TYPE;
-    /** The yearOfCentury field type. */
-    static const DateTimeFieldType *YEAR_OF_CENTURY_TYPE;
-    /** The year field type. */
-    static const DateTimeFieldType *YEAR_TYPE;
-    /** The dayOfYear field type. */
-    static const DateTimeFieldType *DAY_OF_YEAR_TYPE;
-    /** The monthOfYear field type. */
-    static const DateTimeFieldType *MONTH_OF_YEAR_TYPE;
-    /** The dayOfMonth field type. */
-    static const DateTimeFieldType *DAY_OF_MONTH_TYPE;
-    /** The weekyearOfCentury field type. */
-    static const DateTimeFieldType *WEEKYEAR_OF_CENTURY_TYPE;
-    /** The weekyear field type. */
-    static const DateTimeFieldType *WEEKYEAR_TYPE;
-    /** The weekOfWeekyear field type. */
-    static const DateTimeFieldType *WEEK_OF_WEEKYEAR_TYPE;
-    /** The dayOfWeek field type. */
-    static const DateTimeFieldType *DAY_OF_WEEK_TYPE;
-    
-    /** The halfday field type. */
-    static const DateTimeFieldType *HALFDAY_OF_DAY_TYPE;
-    /** The hourOfHalfday field type. */
-    static const DateTimeFieldType *HOUR_OF_HALFDAY_TYPE;
-    /** The clockhourOfHalfday field type. */
-    static const DateTimeFieldType *CLOCKHOUR_OF_HALFDAY_TYPE;
-    /** The clockhourOfDay field type. */
-    static const DateTimeFieldType *CLOCKHOUR_OF_DAY_TYPE;
-    /** The hourOfDay field type. */
-    static const DateTimeFieldType *HOUR_OF_DAY_TYPE;
-    /** The minuteOfDay field type. */
-    static const DateTimeFieldType *MINUTE_OF_DAY_TYPE;
-    /** The minuteOfHour field type. */
-    static const DateTimeFieldType *MINUTE_OF_HOUR_TYPE;
-    /** The secondOfDay field type. */
-    static const DateTimeFieldType *SECOND_OF_DAY_TYPE;
-    /** The secondOfMinute field type. */
-    static const DateTimeFieldType *SECOND_OF_MINUTE_TYPE;
-    /** The millisOfDay field type. */
-    static const DateTimeFieldType *MILLIS_OF_DAY_TYPE;
-    /** The millisOfSecond field type. */
-    static const DateTimeFieldType *MILLIS_OF_SECOND_TYPE;
-    
     //-----------------------------------------------------------------------
     /**
      * Constructor.
@@ -150,99 +102,77 @@ public:
      *
      * @return the DateTimeFieldType constant
      */
-    static const DateTimeFieldType *millisOfSecond() {
-        return MILLIS_OF_SECOND_TYPE;
-    }
+    static const DateTimeFieldType *millisOfSecond();
     
     /**
      * Get the millis of day field type.
      *
      * @return the DateTimeFieldType *constant
      */
-    static const DateTimeFieldType *millisOfDay() {
-        return MILLIS_OF_DAY_TYPE;
-    }
+    static const DateTimeFieldType *millisOfDay();
     
     /**
      * Get the second of minute field type.
      *
      * @return the DateTimeFieldType *constant
      */
-    static const DateTimeFieldType *secondOfMinute() {
-        return SECOND_OF_MINUTE_TYPE;
-    }
+    static const DateTimeFieldType *secondOfMinute();
     
     /**
      * Get the second of day field type.
      *
      * @return the DateTimeFieldType *constant
      */
-    static const DateTimeFieldType *secondOfDay() {
-        return SECOND_OF_DAY_TYPE;
-    }
+    static const DateTimeFieldType *secondOfDay();
     
     /**
      * Get the minute of hour field type.
      *
      * @return the DateTimeFieldType *constant
      */
-    static const DateTimeFieldType *minuteOfHour() {
-        return MINUTE_OF_HOUR_TYPE;
-    }
+    static const DateTimeFieldType *minuteOfHour();
     
     /**
      * Get the minute of day field type.
      *
      * @return the DateTimeFieldType *constant
      */
-    static const DateTimeFieldType *minuteOfDay() {
-        return MINUTE_OF_DAY_TYPE;
-    }
+    static const DateTimeFieldType *minuteOfDay();
     
     /**
      * Get the hour of day (0-23) field type.
      *
      * @return the DateTimeFieldType *constant
      */
-    static const DateTimeFieldType *hourOfDay() {
-        return HOUR_OF_DAY_TYPE;
-    }
+    static const DateTimeFieldType *hourOfDay();
     
     /**
      * Get the hour of day (offset to 1-24) field type.
      *
      * @return the DateTimeFieldType *constant
      */
-    static const DateTimeFieldType *clockhourOfDay() {
-        return CLOCKHOUR_OF_DAY_TYPE;
-    }
+    static const DateTimeFieldType *clockhourOfDay();
     
     /**
      * Get the hour of am/pm (0-11) field type.
      *
      * @return the DateTimeFieldType *constant
      */
-    static const DateTimeFieldType *hourOfHalfday() {
-        return HOUR_OF_HALFDAY_TYPE;
-    }
+    static const DateTimeFieldType *hourOfHalfday();
     
     /**
      * Get the hour of am/pm (offset to 1-12) field type.
      *
      * @return the DateTimeFieldType *constant
      */
-    static const DateTimeFieldType *clockhourOfHalfday() {
-        return CLOCKHOUR_OF_HALFDAY_TYPE;
-    }
+    static const DateTimeFieldType *clockhourOfHalfday();
     
     /**
      * Get the AM(0) PM(1) field type.
      *
      * @return the DateTimeFieldType *constant
      */
-    static const DateTimeFieldType *halfdayOfDay() {
-        return HALFDAY_OF_DAY_TYPE;
-    }
+    static const DateTimeFieldType *halfdayOfDay();
     
     //-----------------------------------------------------------------------
     /**
@@ -250,108 +180,84 @@ public:
      *
      * @return the DateTimeFieldType *constant
      */
-    static const DateTimeFieldType *dayOfWeek() {
-        return DAY_OF_WEEK_TYPE;
-    }
+    static const DateTimeFieldType *dayOfWeek();
     
     /**
      * Get the day of month field type.
      *
      * @return the DateTimeFieldType *constant
      */
-    static const DateTimeFieldType *dayOfMonth() {
-        return DAY_OF_MONTH_TYPE;
-    }
+    static const DateTimeFieldType *dayOfMonth();
     
     /**
      * Get the day of year field type.
      *
      * @return the DateTimeFieldType *constant
      */
-    static const DateTimeFieldType *dayOfYear() {
-        return DAY_OF_YEAR_TYPE;
-    }
+    static const DateTimeFieldType *dayOfYear();
     
     /**
      * Get the week of a week based year field type.
      *
      * @return the DateTimeFieldType *constant
      */
-    static const DateTimeFieldType *weekOfWeekyear() {
-        return WEEK_OF_WEEKYEAR_TYPE;
-    }
+    static const DateTimeFieldType *weekOfWeekyear();
     
     /**
      * Get the year of a week based year field type.
      *
      * @return the DateTimeFieldType *constant
      */
-    static const DateTimeFieldType *weekyear() {
-        return WEEKYEAR_TYPE;
-    }
+    static const DateTimeFieldType *weekyear();
     
     /**
      * Get the year of a week based year within a century field type.
      *
      * @return the DateTimeFieldType *constant
      */
-    static const DateTimeFieldType *weekyearOfCentury() {
-        return WEEKYEAR_OF_CENTURY_TYPE;
-    }
+    static const DateTimeFieldType *weekyearOfCentury();
     
     /**
      * Get the month of year field type.
      *
      * @return the DateTimeFieldType *constant
      */
-    static const DateTimeFieldType *monthOfYear() {
-        return MONTH_OF_YEAR_TYPE;
-    }
+    static const DateTimeFieldType *monthOfYear();
     
     /**
      * Get the year field type.
      *
      * @return the DateTimeFieldType *constant
      */
-    static const DateTimeFieldType *year() {
-        return YEAR_TYPE;
-    }
+    static const DateTimeFieldType *year();
     
     /**
      * Get the year of era field type.
      *
      * @return the DateTimeFieldType *constant
      */
-    static const DateTimeFieldType *yearOfEra() {
-        return YEAR_OF_ERA_TYPE;
-    }
+    static const DateTimeFieldType *yearOfEra();
     
     /**
      * Get the year of century field type.
      *
      * @return the DateTimeFieldType *constant
      */
-    static const DateTimeFieldType *yearOfCentury() {
-        return YEAR_OF_CENTURY_TYPE;
-    }
+    static const DateTimeFieldType *yearOfCentury();
     
     /**
      * Get the century of era field type.
      *
      * @return the DateTimeFieldType *constant
      */
-    static const DateTimeFieldType *centuryOfEra() {
-        return CENTURY_OF_ERA_TYPE;
-    }
+    static const DateTimeFieldType *centuryOfEra();
     
     /**
      * Get the era field type.
      *
      * @return the DateTimeFieldType *constant
      */
-    static const DateTimeFieldType *era() {
-        return ERA_TYPE;
-    }
+    static const DateTimeFieldType *era();
     
     //-----------------------------------------------------------------------
     /**
@@ -14,23 +14,112 @@
 #include "PeriodType.h"
 
 #include <math.h>
+#include <time.h>
 
 CODATIME_BEGIN
 
-SystemMillisProvider *DateTimeUtils::SYSTEM_MILLIS_PROVIDER = new SystemMillisProvider();
-MillisProvider *DateTimeUtils::cMillisProvider = SYSTEM_MILLIS_PROVIDER;
+// the providers have no state and trivial destructors, and every pointer here
+// is initialized from an address constant, so all of these are constant
+// initialized and can be used by the static initializers of other units
+static SystemMillisProvider cSystemMillisProvider;
+static CoarseMillisProvider cCoarseMillisProvider;
+
+SystemMillisProvider *DateTimeUtils::SYSTEM_MILLIS_PROVIDER = &cSystemMillisProvider;
+CoarseMillisProvider *DateTimeUtils::COARSE_MILLIS_PROVIDER = &cCoarseMillisProvider;
+atomic<MillisProvider*> DateTimeUtils::cMillisProvider(&cSystemMillisProvider);
+thread_local MillisProvider *DateTimeUtils::cThreadMillisProvider = NULL;
+
+//-----------------------------------------------------------------------
+int64_t CoarseMillisProvider::getMillis() const {
+#ifdef CLOCK_REALTIME_COARSE
+    struct timespec now;
+    clock_gettime(CLOCK_REALTIME_COARSE, &now);
+    return (int64_t) now.tv_sec * 1000 + now.tv_nsec / 1000000;
+#else
+    return chrono::system_clock::now().time_since_epoch() / chrono::milliseconds(1);
+#endif
+}
+
+int64_t CoarseMillisProvider::getNanos() const {
+#ifdef CLOCK_REALTIME_COARSE
+    struct timespec now;
+    clock_gettime(CLOCK_REALTIME_COARSE, &now);
+    return (int64_t) now.tv_sec * 1000000000 + now.tv_nsec;
+#else
+    return chrono::system_clock::now().time_since_epoch() / chrono::nanoseconds(1);
+#endif
+}
+
+//-----------------------------------------------------------------------
+ScopedMillisProvider::ScopedMillisProvider(MillisProvider *millisProvider) {
+    if (millisProvider == NULL) {
+        throw IllegalArgumentException("The MillisProvider must not be NULL");
+    }
+    iPrevious = DateTimeUtils::cThreadMillisProvider;
+    DateTimeUtils::cThreadMillisProvider = millisProvider;
+}
+
+ScopedMillisProvider::~ScopedMillisProvider() {
+    DateTimeUtils::cThreadMillisProvider = iPrevious;
+}
+
+//-----------------------------------------------------------------------
+TickerMillisProvider::TickerMillisProvider(int intervalMillis) : iInterval(intervalMillis), iStopped(false) {
+    if (intervalMillis <= 0) {
+        throw IllegalArgumentException("The tick interval must be positive");
+    }
+    iMillis.store(chrono::system_clock::now().time_since_epoch() / chrono::milliseconds(1), memory_order_relaxed);
+    iThread = thread(&TickerMillisProvider::run, this);
+}
+
+TickerMillisProvider::~TickerMillisProvider() {
+    {
+        lock_guard<mutex> lock(iMutex);
+        iStopped = true;
+    }
+    iStopCondition.notify_all();
+    iThread.join();
+}
+
+void TickerMillisProvider::run() {
+    unique_lock<mutex> lock(iMutex);
+    while (iStopCondition.wait_for(lock, iInterval, [this] { return iStopped; }) == false) {
+        iMillis.store(chrono::system_clock::now().time_since_epoch() / chrono::milliseconds(1), memory_order_relaxed);
+    }
+}
 
 //-----------------------------------------------------------------------
 /**
  * Gets the current time in milliseconds.
  * <p>
  * By default this returns <code>System.currentTimeMillis()</code>.
- * This may be changed using other methods in this class.
+ * This may be changed using other methods in this class, or for the
+ * calling thread only using a <code>ScopedMillisProvider</code>.
  *
  * @return the current time in milliseconds from 1970-01-01T00:00:00Z
  */
 const int64_t DateTimeUtils::currentTimeMillis() {
-    return cMillisProvider->getMillis();
+    MillisProvider *threadProvider = cThreadMillisProvider;
+    if (threadProvider != NULL) {
+        return threadProvider->getMillis();
+    }
+    return cMillisProvider.load(memory_order_acquire)->getMillis();
+}
+
+/**
+ * Gets the current time in nanoseconds.
+ * <p>
+ * This reads the same provider as {@link #currentTimeMillis()}, including
+ * any override on the calling thread, at the precision the provider has.
+ *
+ * @return the current time in nanoseconds from 1970-01-01T00:00:00Z
+ */
+const int64_t DateTimeUtils::currentTimeNanos() {
+    MillisProvider *threadProvider = cThreadMillisProvider;
+    if (threadProvider != NULL) {
+        return threadProvider->getNanos();
+    }
+    return cMillisProvider.load(memory_order_acquire)->getNanos();
 }
 
 /**
@@ -38,13 +127,22 @@ const int64_t DateTimeUtils::currentTimeMillis() {
  * <p>
  * This method changes the behaviour of {@link #currentTimeMillis()}.
  * Whenever the current time is queried, {@link System#currentTimeMillis()} is used.
- *
- * @throws SecurityException if the application does not have sufficient security rights
  */
-//public static const void setCurrentMillisSystem() throws SecurityException {
-//    checkPermission();
-//    cMillisProvider = SYSTEM_MILLIS_PROVIDER;
-//}
+void DateTimeUtils::setCurrentMillisSystem() {
+    cMillisProvider.store(SYSTEM_MILLIS_PROVIDER, memory_order_release);
+}
+
+/**
+ * Sets the current time to return the coarse system time.
+ * <p>
+ * This method changes the behaviour of {@link #currentTimeMillis()}.
+ * Whenever the current time is queried, the kernel's coarse realtime clock
+ * is used. This is cheaper to read than the system clock but may lag it by
+ * a few milliseconds.
+ */
+void DateTimeUtils::setCurrentMillisCoarse() {
+    cMillisProvider.store(COARSE_MILLIS_PROVIDER, memory_order_release);
+}
 
 /**
  * Sets the current time to return a fixed millisecond time.
@@ -84,18 +182,22 @@ const int64_t DateTimeUtils::currentTimeMillis() {
  * <p>
  * This method changes the behaviour of {@link #currentTimeMillis()}.
  * Whenever the current time is queried, the specified class will be called.
+ * <p>
+ * The provider is not owned by this class. It must outlive its use, which
+ * includes any reads already in progress on other threads when it is replaced.
+ * A <code>TickerMillisProvider</code> may be used here to make reading the
+ * current time a single atomic load.
  *
  * @param millisProvider  the provider of the current time to use, not NULL
- * @throws SecurityException if the application does not have sufficient security rights
+ * @throws IllegalArgumentException if the provider is NULL
  * @since 2.0
  */
-//public static const void setCurrentMillisProvider(MillisProvider millisProvider) throws SecurityException {
-//    if (millisProvider == NULL) {
-//        throw new IllegalArgumentException("The MillisProvider must not be NULL");
-//    }
-//    checkPermission();
-//    cMillisProvider = millisProvider;
-//}
+void DateTimeUtils::setCurrentMillisProvider(MillisProvider *millisProvider) {
+    if (millisProvider == NULL) {
+        throw IllegalArgumentException("The MillisProvider must not be NULL");
+    }
+    cMillisProvider.store(millisProvider, memory_order_release);
+}
 
 /**
  * Checks whether the provider may be changed using permission 'CurrentTime.setProvider'.
@@ -16,9 +16,13 @@
 #include "ReadableInterval.h"
 #include "ReadableDuration.h"
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <map>
+#include <mutex>
 #include <string>
-#include <chrono>
+#include <thread>
 
 using namespace std;
 
@@ -33,7 +37,17 @@ CODATIME_BEGIN
  */
 class MillisProvider {
     
+protected:
+    
+    /**
+     * Destructor, trivial so that the stateless system providers need no
+     * static initializer or exit-time destructor. Providers are not deleted
+     * through this base class.
+     */
+    ~MillisProvider() = default;
+    
 public:
+    
     /**
      * Gets the current time.
      * <p>
@@ -42,6 +56,19 @@ public:
      * @return the current time in milliseconds
      */
     virtual int64_t getMillis() const = 0;
+    
+    /**
+     * Gets the current time in nanoseconds.
+     * <p>
+     * Implementations of this method must be thread-safe. By default this
+     * is the current time in milliseconds scaled up, so providers with no
+     * finer clock stay consistent with {@link #getMillis()}.
+     *
+     * @return the current time in nanoseconds
+     */
+    virtual int64_t getNanos() const {
+        return getMillis() * 1000000;
+    }
 };
 
 /**
@@ -58,6 +85,14 @@ public:
     virtual int64_t getMillis() const {
         return chrono::system_clock::now().time_since_epoch() / chrono::milliseconds(1);
     }
+    
+    /**
+     * Gets the current time in nanoseconds.
+     * @return the current time in nanos, to the precision of the system clock
+     */
+    virtual int64_t getNanos() const {
+        return chrono::system_clock::now().time_since_epoch() / chrono::nanoseconds(1);
+    }
 };
 
 /**
@@ -116,13 +151,143 @@ public:
     virtual int64_t getMillis() const {
         return chrono::system_clock::now().time_since_epoch() / chrono::milliseconds(1) + iMillis;
     }
+    
+    /**
+     * Gets the current time in nanoseconds.
+     * @return the current time in nanos
+     */
+    virtual int64_t getNanos() const {
+        return chrono::system_clock::now().time_since_epoch() / chrono::nanoseconds(1) + iMillis * 1000000;
+    }
+};
+
+/**
+ * Coarse system millis provider.
+ * <p>
+ * This reads the kernel's coarse realtime clock where there is one, which
+ * avoids a full clock read at the cost of precision, typically a few
+ * milliseconds. Elsewhere it falls back to the system clock.
+ */
+class CoarseMillisProvider : public MillisProvider {
+    
+public:
+    
+    /**
+     * Gets the current time.
+     * @return the current time in millis
+     */
+    virtual int64_t getMillis() const;
+    
+    /**
+     * Gets the current time in nanoseconds.
+     * @return the current time in nanos, to the precision of the coarse clock
+     */
+    virtual int64_t getNanos() const;
+};
+
+/**
+ * Ticker millis provider.
+ * <p>
+ * A background thread reads the system clock every interval and publishes
+ * it, so getting the time is a single atomic load. The time returned lags
+ * the system clock by up to the interval. The thread is stopped when the
+ * provider is destroyed.
+ */
+class TickerMillisProvider : public MillisProvider {
+    
+private:
+    
+    /** The last published time. */
+    atomic<int64_t> iMillis;
+    /** The interval between ticks. */
+    chrono::milliseconds iInterval;
+    /** Whether the ticker thread should stop. */
+    bool iStopped;
+    /** Guards iStopped. */
+    mutex iMutex;
+    /** Wakes the ticker thread when stopping. */
+    condition_variable iStopCondition;
+    /** The ticker thread. */
+    thread iThread;
+    
+    void run();
+    
+    TickerMillisProvider(const TickerMillisProvider &other);
+    TickerMillisProvider &operator=(const TickerMillisProvider &other);
+    
+public:
+    
+    /**
+     * Constructor, starting the ticker thread.
+     * @param intervalMillis  the millis between ticks, must be positive
+     * @throws IllegalArgumentException if the interval is not positive
+     */
+    TickerMillisProvider(int intervalMillis);
+    
+    /**
+     * Destructor, stopping the ticker thread.
+     */
+    virtual ~TickerMillisProvider();
+    
+    /**
+     * Gets the current time.
+     * @return the time at the last tick in millis
+     */
+    virtual int64_t getMillis() const {
+        return iMillis.load(memory_order_relaxed);
+    }
+};
+
+/**
+ * Overrides the current time on the calling thread while in scope.
+ * <p>
+ * While an instance exists, {@link DateTimeUtils#currentTimeMillis()} on the
+ * thread that created it returns the time from its provider, and other
+ * threads are unaffected. Scopes nest, and destroying one restores the
+ * override that was in effect when it was created. An instance must be
+ * destroyed on the thread that created it, in reverse order of creation,
+ * which holds naturally when it is a local variable.
+ * <p>
+ * This allows each worker thread to replay recorded traffic at its own
+ * time, for example with a <code>FixedMillisProvider</code> per request.
+ */
+class ScopedMillisProvider {
+    
+private:
+    
+    /** The override to restore when this scope ends. */
+    MillisProvider *iPrevious;
+    
+    ScopedMillisProvider(const ScopedMillisProvider &other);
+    ScopedMillisProvider &operator=(const ScopedMillisProvider &other);
+    
+public:
+    
+    /**
+     * Constructor, installing the provider on the calling thread.
+     * @param millisProvider  the provider of the current time to use, not NULL, not owned
+     * @throws IllegalArgumentException if the provider is NULL
+     */
+    ScopedMillisProvider(MillisProvider *millisProvider);
+    
+    /**
+     * Destructor, restoring the previous override of the calling thread.
+     */
+    ~ScopedMillisProvider();
 };
 
 class DateTimeUtils {
     
+    friend class ScopedMillisProvider;
+    
 public:
     
     static const int64_t currentTimeMillis();
+    static const int64_t currentTimeNanos();
+    static void setCurrentMillisSystem();
+    static void setCurrentMillisCoarse();
+    static void setCurrentMillisProvider(MillisProvider *millisProvider);
+    
     static const int64_t getInstantMillis(ReadableInstant *instant);
     static Chronology *getInstantChronology(ReadableInstant *instant);
     static Chronology *getIntervalChronology(ReadableInstant *start, ReadableInstant *end);
@@ -151,19 +316,15 @@ private:
     
     /** The singleton instance of the system millisecond provider. */
     static SystemMillisProvider *SYSTEM_MILLIS_PROVIDER;
+    /** The singleton instance of the coarse millisecond provider. */
+    static CoarseMillisProvider *COARSE_MILLIS_PROVIDER;
     /** The millisecond provider currently in use. */
-    static MillisProvider *cMillisProvider;
+    static atomic<MillisProvider*> cMillisProvider;
+    /** The millisecond provider overriding cMillisProvider on this thread, NULL if none. */
+    static thread_local MillisProvider *cThreadMillisProvider;
     /** The millisecond provider currently in use. */
     static map<string, DateTimeZone*> cZoneNames;
     
-    struct StaticBlock {
-        StaticBlock() {
-            
-        }
-    };
-    
-    static StaticBlock staticBlock;
-    
 };
 
 CODATIME_END
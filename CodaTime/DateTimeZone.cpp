@@ -8,6 +8,8 @@
 
 #include "DateTimeZone.h"
 
+#include "CodaTimeStats.h"
+#include "CodaTimeTrace.h"
 #include "DateTimeConstants.h"
 #include "DateTimeUtils.h"
 #include "Exceptions.h"
@@ -20,25 +22,38 @@
 
 CODATIME_BEGIN
 
-DateTimeZone *DateTimeZone::UTC = new FixedDateTimeZone("UTC", "UTC", 0, 0);
 Provider *DateTimeZone::cProvider = NULL;
 NameProvider *DateTimeZone::cNameProvider = NULL;
 
-// TODO: synchronized
+// the zone and the lock are built on first use, and never destroyed, so that
+// loading the library runs no initializer and exiting runs no destructor
+DateTimeZone *DateTimeZone::UTC() {
+    static DateTimeZone *const cUTC = new FixedDateTimeZone("UTC", "UTC", 0, 0);
+    return cUTC;
+}
+
+mutex &DateTimeZone::getLock() {
+    static mutex *const cLock = new mutex();
+    return *cLock;
+}
+
 DateTimeZone *DateTimeZone::fixedOffsetZone(string id, int offset) {
     if (offset == 0) {
-        return DateTimeZone::UTC;
+        return DateTimeZone::UTC();
     }
+    lock_guard<mutex> lock(getLock());
     DateTimeZone *zone = NULL;
     DateTimeZone *ref = iFixedOffsetCache[id];
     if (ref != NULL) {
         zone = ref;
         if (zone != NULL) {
+            CODATIME_STATS_HIT(FIXED_OFFSET_ZONE);
             return zone;
         }
     }
     zone = new FixedDateTimeZone(id, NULL, offset, offset);
     iFixedOffsetCache[id] = zone;
+    CODATIME_STATS_MISS(FIXED_OFFSET_ZONE, sizeof(FixedDateTimeZone) + id.size());
     return zone;
 }
 
@@ -61,7 +76,7 @@ void DateTimeZone::setProvider0(Provider *provider) {
     if (ids.find(string("UTC")) == ids.end()) {
         throw new IllegalArgumentException("The provider doesn't support UTC");
     }
-    if (!UTC->equals(provider->getZone("UTC"))) {
+    if (!UTC()->equals(provider->getZone("UTC"))) {
         throw new IllegalArgumentException("Invalid UTC zone provided");
     }
     cProvider = provider;
@@ -134,8 +149,8 @@ NameProvider *DateTimeZone::getDefaultNameProvider() {
  * @param id  the old style id
  * @return the new style id, NULL if not found
  */
-// TODO: synchronized
 string DateTimeZone::getConvertedId(string id) {
+    lock_guard<mutex> lock(getLock());
     map<string, string> &map = cZoneIdConversion;
     if (map.empty()) {
         // Backwards compatibility with TimeZone.
@@ -234,8 +249,8 @@ string DateTimeZone::printOffset(int offset) {
  *
  * @return the formatter
  */
-// TODO: synchronized
 DateTimeFormatter *DateTimeZone::offsetFormatter() {
+    lock_guard<mutex> lock(getLock());
     if (cOffsetFormatter == NULL) {
         cOffsetFormatter = new DateTimeFormatterBuilder()
         .appendTimeZoneOffset(NULL, true, 2, 4)
@@ -269,7 +284,7 @@ DateTimeZone *DateTimeZone::getDefault() {
             //                        // ignored
             //                    }
             if (temp == NULL) {
-                temp = UTC;
+                temp = UTC();
             }
             cDefault = zone = temp;
         }
@@ -318,20 +333,22 @@ DateTimeZone *DateTimeZone::getDefault() {
  * @throws IllegalArgumentException if the ID is not recognised
  */
 DateTimeZone *DateTimeZone::forID(string id) {
+    CODATIME_TRACE_SPAN(span, ZONE_FOR_ID, 0, id);
     if (id.empty()) {
         return getDefault();
     }
     if (id.compare("UTC") == 0) {
-        return DateTimeZone::UTC;
+        return DateTimeZone::UTC();
     }
     DateTimeZone *zone = cProvider->getZone(id);
     if (zone != NULL) {
+        CODATIME_STATS_ZONE_LOAD();
         return zone;
     }
     if (id.at(0) == '+' || id.at(0) == '-') {
         int offset = parseOffset(id);
         if (offset == 0L) {
-            return DateTimeZone::UTC;
+            return DateTimeZone::UTC();
         } else {
             id = printOffset(offset);
             return fixedOffsetZone(id, offset);
@@ -392,7 +409,7 @@ DateTimeZone *DateTimeZone::forOffsetHours(int hoursOffset) {
  */
 DateTimeZone *DateTimeZone::forOffsetHoursMinutes(int hoursOffset, int minutesOffset) {
     if (hoursOffset == 0 && minutesOffset == 0) {
-        return DateTimeZone::UTC;
+        return DateTimeZone::UTC();
     }
     if (hoursOffset < -23 || hoursOffset > 23) {
         string err("Hours out of range: ");
@@ -461,7 +478,7 @@ DateTimeZone *DateTimeZone::forOffsetMillis(int millisOffset) {
 //        }
 //        const string id = zone.getID();
 //        if (id.compare("UTC") == 0) {
-//            return DateTimeZone::UTC;
+//            return DateTimeZone::UTC();
 //        }
 //
 //        // Convert from old alias before consulting provider since they may differ.
@@ -484,7 +501,7 @@ DateTimeZone *DateTimeZone::forOffsetMillis(int millisOffset) {
 //                convId = convId.substr(3);
 //                int offset = parseOffset(convId);
 //                if (offset == 0L) {
-//                    return DateTimeZone::UTC;
+//                    return DateTimeZone::UTC();
 //                } else {
 //                    convId = printOffset(offset);
 //                    return fixedOffsetZone(convId, offset);
@@ -15,6 +15,7 @@
 #include "Object.h"
 
 #include <map>
+#include <mutex>
 #include <set>
 #include <string>
 #include <cmath>
@@ -101,6 +102,14 @@ private:
     /** Cache of old zone IDs to new zone IDs */
     static map<string, string> cZoneIdConversion;
     
+    /**
+     * Gets the lock for the fixed offset cache, the id conversions and the
+     * offset formatter.
+     *
+     * @return the lock, built on first use
+     */
+    static mutex &getLock();
+    
     string iID;
     
     //-----------------------------------------------------------------------
@@ -111,7 +120,6 @@ private:
      * @param offset  the offset in millis
      * @return the zone
      */
-    // TODO: synchronized
     static DateTimeZone *fixedOffsetZone(string id, int offset);
     
     /**
@@ -158,7 +166,6 @@ private:
      * @param id  the old style id
      * @return the new style id, NULL if not found
      */
-    // TODO: synchronized
     static string getConvertedId(string id);
     
     class UnrealChrono : public BaseChronology {
@@ -201,13 +208,16 @@ private:
      *
      * @return the formatter
      */
-    // TODO: synchronized
     static DateTimeFormatter *offsetFormatter();
     
 public:
     
-    /** The time zone for Universal Coordinated Time */
-    static DateTimeZone *UTC;
+    /**
+     * Gets the time zone for Universal Coordinated Time.
+     *
+     * @return the UTC zone, built on first use
+     */
+    static DateTimeZone *UTC();
     
     //-----------------------------------------------------------------------
     /**
@@ -0,0 +1,137 @@
+//
+//  Days.cpp
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#include "Days.h"
+
+#include "DateTimeConstants.h"
+#include "Duration.h"
+#include "DurationFieldType.h"
+#include "Hours.h"
+#include "Minutes.h"
+#include "Period.h"
+#include "PeriodType.h"
+#include "Seconds.h"
+#include "Weeks.h"
+#include "field/FieldUtils.h"
+
+#include <climits>
+
+CODATIME_BEGIN
+
+const Days Days::ZERO = Days(0);
+const Days Days::ONE = Days(1);
+const Days Days::TWO = Days(2);
+const Days Days::THREE = Days(3);
+const Days Days::FOUR = Days(4);
+const Days Days::FIVE = Days(5);
+const Days Days::SIX = Days(6);
+const Days Days::SEVEN = Days(7);
+const Days Days::MAX_VALUE = Days(INT_MAX);
+const Days Days::MIN_VALUE = Days(INT_MIN);
+
+//-----------------------------------------------------------------------
+Days Days::daysBetween(ReadableInstant *start, ReadableInstant *end) {
+    return Days(BaseSingleFieldPeriod::between(start, end, DurationFieldType::days()));
+}
+
+Days Days::daysBetween(ReadablePartial *start, ReadablePartial *end) {
+    return Days(BaseSingleFieldPeriod::between(start, end, DurationFieldType::days()));
+}
+
+Days Days::daysIn(ReadableInterval *interval) {
+    return Days(BaseSingleFieldPeriod::between(interval, DurationFieldType::days()));
+}
+
+Days Days::standardDaysIn(ReadablePeriod *period) {
+    return Days(BaseSingleFieldPeriod::standardPeriodIn(period, DateTimeConstants::MILLIS_PER_DAY));
+}
+
+//-----------------------------------------------------------------------
+const DurationFieldType *Days::getFieldType() const {
+    return DurationFieldType::days();
+}
+
+PeriodType *Days::getPeriodType() const {
+    return PeriodType::days();
+}
+
+//-----------------------------------------------------------------------
+Weeks Days::toStandardWeeks() const {
+    return Weeks::weeks(getValue() / DateTimeConstants::DAYS_PER_WEEK);
+}
+
+Hours Days::toStandardHours() const {
+    return Hours::hours(FieldUtils::safeMultiply(getValue(), DateTimeConstants::HOURS_PER_DAY));
+}
+
+Minutes Days::toStandardMinutes() const {
+    return Minutes::minutes(FieldUtils::safeMultiply(getValue(), DateTimeConstants::MINUTES_PER_DAY));
+}
+
+Seconds Days::toStandardSeconds() const {
+    return Seconds::seconds(FieldUtils::safeMultiply(getValue(), DateTimeConstants::SECONDS_PER_DAY));
+}
+
+Duration *Days::toStandardDuration() const {
+    int64_t days = getValue();  // assign to a int64_t
+    return new Duration(days * DateTimeConstants::MILLIS_PER_DAY);
+}
+
+Period *Days::toPeriod() const {
+    return Period::days(getValue());
+}
+
+//-----------------------------------------------------------------------
+Days Days::plus(int days) const {
+    if (days == 0) {
+        return *this;
+    }
+    return Days::days(FieldUtils::safeAdd(getValue(), days));
+}
+
+Days Days::plus(const Days &days) const {
+    return plus(days.getValue());
+}
+
+Days Days::minus(int days) const {
+    return plus(FieldUtils::safeNegate(days));
+}
+
+Days Days::minus(const Days &days) const {
+    return minus(days.getValue());
+}
+
+//-----------------------------------------------------------------------
+Days Days::multipliedBy(int scalar) const {
+    return Days::days(multipliedValue(scalar));
+}
+
+Days Days::dividedBy(int divisor) const {
+    if (divisor == 1) {
+        return *this;
+    }
+    return Days::days(dividedValue(divisor));
+}
+
+Days Days::negated() const {
+    return Days::days(FieldUtils::safeNegate(getValue()));
+}
+
+int Days::hashCode() const {
+    int total = 17;
+    total = 27 * total + getValue();
+    total = 27 * total + getFieldType()->hashCode();
+    return total;
+}
+
+//-----------------------------------------------------------------------
+string Days::toString() const {
+    return BaseSingleFieldPeriod::toString("P", 'D');
+}
+
+CODATIME_END
@@ -0,0 +1,354 @@
+//
+//  Days.h
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#ifndef __CodaTime__Days__
+#define __CodaTime__Days__
+
+#include "CodaTimeMacros.h"
+
+#include "base/BaseSingleFieldPeriod.h"
+
+#include <string>
+
+using namespace std;
+
+CODATIME_BEGIN
+
+class Duration;
+class DurationFieldType;
+class Hours;
+class Minutes;
+class Period;
+class PeriodType;
+class ReadableInstant;
+class ReadableInterval;
+class ReadablePartial;
+class ReadablePeriod;
+class Seconds;
+class Weeks;
+
+/**
+ * An immutable time period representing a number of days.
+ * <p>
+ * <code>Days</code> is an immutable period that can only store days.
+ * It does not store years, months or hours for example. As such it is a
+ * type-safe way of representing a number of days in an application.
+ * <p>
+ * The number of days is set in the constructor, and may be queried using
+ * <code>getDays()</code>. Basic mathematical operations are provided -
+ * <code>plus()</code>, <code>minus()</code>, <code>multipliedBy()</code> and
+ * <code>dividedBy()</code>.
+ * <p>
+ * <code>Days</code> is a value type holding a single int. It should be passed
+ * and returned by value rather than allocated.
+ * <p>
+ * Days is thread-safe and immutable.
+ *
+ * @author Stephen Colebourne
+ * @since 1.4
+ */
+class Days : public BaseSingleFieldPeriod {
+    
+public:
+    
+    /** Constant representing zero days. */
+    static const Days ZERO;
+    /** Constant representing one day. */
+    static const Days ONE;
+    /** Constant representing two days. */
+    static const Days TWO;
+    /** Constant representing three days. */
+    static const Days THREE;
+    /** Constant representing four days. */
+    static const Days FOUR;
+    /** Constant representing five days. */
+    static const Days FIVE;
+    /** Constant representing six days. */
+    static const Days SIX;
+    /** Constant representing seven days. */
+    static const Days SEVEN;
+    /** Constant representing the maximum number of days that can be stored in this object. */
+    static const Days MAX_VALUE;
+    /** Constant representing the minimum number of days that can be stored in this object. */
+    static const Days MIN_VALUE;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Creates a new instance representing the specified number of days.
+     *
+     * @param days  the number of days to represent
+     */
+    constexpr Days(int days) : BaseSingleFieldPeriod(days) {
+    }
+    
+    /**
+     * Obtains an instance of <code>Days</code>.
+     *
+     * @param days  the number of days to obtain an instance for
+     * @return the instance of Days
+     */
+    static constexpr Days days(int days) {
+        return Days(days);
+    }
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Creates a <code>Days</code> representing the number of whole days
+     * between the two specified datetimes. This method correctly handles
+     * any daylight savings time changes that may occur during the interval.
+     * <p>
+     * The difference is read directly from the days field of the start's
+     * chronology, no intermediate <code>Period</code> is created.
+     *
+     * @param start  the start instant, must not be null
+     * @param end  the end instant, must not be null
+     * @return the period in days
+     * @throws IllegalArgumentException if the instants are null or invalid
+     */
+    static Days daysBetween(ReadableInstant *start, ReadableInstant *end);
+    
+    /**
+     * Creates a <code>Days</code> representing the number of whole days
+     * between the two specified partial datetimes.
+     * <p>
+     * The two partials must contain the same fields, for example you can specify
+     * two <code>LocalDate</code> objects.
+     *
+     * @param start  the start partial date, must not be null
+     * @param end  the end partial date, must not be null
+     * @return the period in days
+     * @throws IllegalArgumentException if the partials are null or invalid
+     */
+    static Days daysBetween(ReadablePartial *start, ReadablePartial *end);
+    
+    /**
+     * Creates a <code>Days</code> representing the number of whole days
+     * in the specified interval.
+     *
+     * @param interval  the interval to extract days from, null returns zero
+     * @return the period in days
+     * @throws IllegalArgumentException if the partials are null or invalid
+     */
+    static Days daysIn(ReadableInterval *interval);
+    
+    /**
+     * Creates a new <code>Days</code> representing the number of complete
+     * standard length days in the specified period.
+     * <p>
+     * This factory method converts all fields from the period to days using standardised
+     * durations for each field. Only those fields which have a precise duration in
+     * the ISO UTC chronology can be converted.
+     *
+     * @param period  the period to get the number of days from, null returns zero
+     * @return the period in days
+     * @throws IllegalArgumentException if the period contains imprecise duration values
+     */
+    static Days standardDaysIn(ReadablePeriod *period);
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Gets the duration field type, which is <code>days</code>.
+     *
+     * @return the period type
+     */
+    const DurationFieldType *getFieldType() const;
+    
+    /**
+     * Gets the period type, which is <code>days</code>.
+     *
+     * @return the period type
+     */
+    PeriodType *getPeriodType() const;
+    
+    /**
+     * Gets the number of days that this period represents.
+     *
+     * @return the number of days in the period
+     */
+    constexpr int getDays() const {
+        return getValue();
+    }
+    
+    /**
+     * Converts this period in days to a period in weeks assuming a
+     * days per week standard.
+     * <p>
+     * The result is the number of whole weeks, truncated towards zero.
+     *
+     * @return a period representing the number of whole weeks for this number of days
+     */
+    Weeks toStandardWeeks() const;
+    
+    /**
+     * Converts this period in days to a period in hours assuming a
+     * hours per day standard.
+     *
+     * @return a period representing the number of hours for this number of days
+     * @throws ArithmeticException if the number of hours is too large to be represented
+     */
+    Hours toStandardHours() const;
+    
+    /**
+     * Converts this period in days to a period in minutes assuming a
+     * minutes per day standard.
+     *
+     * @return a period representing the number of minutes for this number of days
+     * @throws ArithmeticException if the number of minutes is too large to be represented
+     */
+    Minutes toStandardMinutes() const;
+    
+    /**
+     * Converts this period in days to a period in seconds assuming a
+     * seconds per day standard.
+     *
+     * @return a period representing the number of seconds for this number of days
+     * @throws ArithmeticException if the number of seconds is too large to be represented
+     */
+    Seconds toStandardSeconds() const;
+    
+    /**
+     * Converts this period in days to a duration in milliseconds assuming a
+     * millis per day standard.
+     *
+     * @return a duration equivalent to this number of days
+     */
+    Duration *toStandardDuration() const;
+    
+    /**
+     * Converts this period to a <code>Period</code> with the standard period type.
+     *
+     * @return a period representing the same number of days
+     */
+    Period *toPeriod() const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Returns a new instance with the specified number of days added.
+     *
+     * @param days  the amount of days to add, may be negative
+     * @return the new period plus the specified number of days
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Days plus(int days) const;
+    
+    /**
+     * Returns a new instance with the specified number of days added.
+     *
+     * @param days  the amount of days to add, may be negative
+     * @return the new period plus the specified number of days
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Days plus(const Days &days) const;
+    
+    /**
+     * Returns a new instance with the specified number of days taken away.
+     *
+     * @param days  the amount of days to take away, may be negative
+     * @return the new period minus the specified number of days
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Days minus(int days) const;
+    
+    /**
+     * Returns a new instance with the specified number of days taken away.
+     *
+     * @param days  the amount of days to take away, may be negative
+     * @return the new period minus the specified number of days
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Days minus(const Days &days) const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Returns a new instance with the days multiplied by the specified scalar.
+     *
+     * @param scalar  the amount to multiply by, may be negative
+     * @return the new period multiplied by the specified scalar
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Days multipliedBy(int scalar) const;
+    
+    /**
+     * Returns a new instance with the days divided by the specified divisor.
+     * The calculation uses integer division, thus 3 divided by 2 is 1.
+     *
+     * @param divisor  the amount to divide by, may be negative
+     * @return the new period divided by the specified divisor
+     * @throws ArithmeticException if the divisor is zero
+     */
+    Days dividedBy(int divisor) const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Returns a new instance with the days value negated.
+     *
+     * @return the new period with a negated value
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Days negated() const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Is this days instance greater than the specified number of days.
+     *
+     * @param other  the other period
+     * @return true if this days instance is greater than the specified one
+     */
+    constexpr bool isGreaterThan(const Days &other) const {
+        return getValue() > other.getValue();
+    }
+    
+    /**
+     * Is this days instance less than the specified number of days.
+     *
+     * @param other  the other period
+     * @return true if this days instance is less than the specified one
+     */
+    constexpr bool isLessThan(const Days &other) const {
+        return getValue() < other.getValue();
+    }
+    
+    /**
+     * Compares this period to another of the same type.
+     *
+     * @param other  the other period
+     * @return negative if this is less, zero if equal, positive if greater
+     */
+    constexpr int compareTo(const Days &other) const {
+        return (getValue() > other.getValue() ? 1 : (getValue() < other.getValue() ? -1 : 0));
+    }
+    
+    constexpr bool equals(const Days &other) const {
+        return getValue() == other.getValue();
+    }
+    
+    constexpr bool operator==(const Days &other) const {
+        return getValue() == other.getValue();
+    }
+    
+    constexpr bool operator!=(const Days &other) const {
+        return getValue() != other.getValue();
+    }
+    
+    int hashCode() const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Gets this instance as a string in the ISO8601 duration format.
+     * <p>
+     * For example, "P4D" represents 4 days.
+     *
+     * @return the value as an ISO8601 string
+     */
+    string toString() const;
+    
+};
+
+CODATIME_END
+
+#endif /* defined(__CodaTime__Days__) */
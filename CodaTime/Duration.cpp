@@ -15,7 +15,10 @@
 
 CODATIME_BEGIN
 
-Duration *Duration::ZERO = new Duration(0LL);
+Duration *Duration::ZERO() {
+    static Duration *const cZero = new Duration((int64_t) 0);
+    return cZero;
+}
 
 Duration *Duration::parse(string str) {
     return new Duration(str);
@@ -23,35 +26,35 @@ Duration *Duration::parse(string str) {
 
 Duration *Duration::standardDays(int64_t days) {
     if (days == 0) {
-        return ZERO;
+        return ZERO();
     }
     return new Duration(FieldUtils::safeMultiply(days, DateTimeConstants::MILLIS_PER_DAY));
 }
 
 Duration *Duration::standardHours(int64_t hours) {
     if (hours == 0) {
-        return ZERO;
+        return ZERO();
     }
     return new Duration(FieldUtils::safeMultiply(hours, DateTimeConstants::MILLIS_PER_HOUR));
 }
 
 Duration *Duration::standardMinutes(int64_t minutes) {
     if (minutes == 0) {
-        return ZERO;
+        return ZERO();
     }
     return new Duration(FieldUtils::safeMultiply(minutes, DateTimeConstants::MILLIS_PER_MINUTE));
 }
 
 Duration *Duration::standardSeconds(int64_t seconds) {
     if (seconds == 0) {
-        return ZERO;
+        return ZERO();
     }
     return new Duration(FieldUtils::safeMultiply(seconds, DateTimeConstants::MILLIS_PER_SECOND));
 }
 
 Duration *Duration::millis(int64_t millis) {
     if (millis == 0) {
-        return ZERO;
+        return ZERO();
     }
     return new Duration(millis);
 }
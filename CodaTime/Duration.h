@@ -62,8 +62,8 @@ public:
     
     string toString() { return BaseDuration::toString(); }
     
-    /** Constant representing zero millisecond duration */
-    static Duration *ZERO;
+    /** Gets the zero millisecond duration, created on first use and never destroyed */
+    static Duration *ZERO();
     
     //-----------------------------------------------------------------------
     /**
@@ -17,6 +17,7 @@
 
 #include <string>
 #include <climits>
+#include <limits>
 
 using namespace std;
 
@@ -15,28 +15,68 @@
 
 CODATIME_BEGIN
 
-const DurationFieldType *DurationFieldType::ERAS_TYPE = new StandardDurationFieldType("eras", ERAS);
-const DurationFieldType *DurationFieldType::CENTURIES_TYPE = new StandardDurationFieldType("centuries", CENTURIES);
-/** The weekyears field type. */
-const DurationFieldType *DurationFieldType::WEEKYEARS_TYPE = new StandardDurationFieldType("weekyears", WEEKYEARS);
-/** The years field type. */
-const DurationFieldType *DurationFieldType::YEARS_TYPE = new StandardDurationFieldType("years", YEARS);
-/** The months field type. */
-const DurationFieldType *DurationFieldType::MONTHS_TYPE = new StandardDurationFieldType("months", MONTHS);
-/** The weeks field type. */
-const DurationFieldType *DurationFieldType::WEEKS_TYPE = new StandardDurationFieldType("weeks", WEEKS);
-/** The days field type. */
-const DurationFieldType *DurationFieldType::DAYS_TYPE = new StandardDurationFieldType("days", DAYS);
-/** The halfdays field type. */
-const DurationFieldType *DurationFieldType::HALFDAYS_TYPE = new StandardDurationFieldType("halfdays", HALFDAYS);
-/** The hours field type. */
-const DurationFieldType *DurationFieldType::HOURS_TYPE = new StandardDurationFieldType("hours", HOURS);
-/** The minutes field type. */
-const DurationFieldType *DurationFieldType::MINUTES_TYPE = new StandardDurationFieldType("minutes", MINUTES);
-/** The seconds field type. */
-const DurationFieldType *DurationFieldType::SECONDS_TYPE = new StandardDurationFieldType("seconds", SECONDS);
-/** The millis field type. */
-const DurationFieldType *DurationFieldType::MILLIS_TYPE = new StandardDurationFieldType("millis", MILLIS);
+// the standard types are built on first use, so loading the library runs no
+// initializer for them
+
+const DurationFieldType *DurationFieldType::eras() {
+    static const DurationFieldType *const cType = new StandardDurationFieldType("eras", ERAS);
+    return cType;
+}
+
+const DurationFieldType *DurationFieldType::centuries() {
+    static const DurationFieldType *const cType = new StandardDurationFieldType("centuries", CENTURIES);
+    return cType;
+}
+
+const DurationFieldType *DurationFieldType::weekyears() {
+    static const DurationFieldType *const cType = new StandardDurationFieldType("weekyears", WEEKYEARS);
+    return cType;
+}
+
+const DurationFieldType *DurationFieldType::years() {
+    static const DurationFieldType *const cType = new StandardDurationFieldType("years", YEARS);
+    return cType;
+}
+
+const DurationFieldType *DurationFieldType::months() {
+    static const DurationFieldType *const cType = new StandardDurationFieldType("months", MONTHS);
+    return cType;
+}
+
+const DurationFieldType *DurationFieldType::weeks() {
+    static const DurationFieldType *const cType = new StandardDurationFieldType("weeks", WEEKS);
+    return cType;
+}
+
+const DurationFieldType *DurationFieldType::days() {
+    static const DurationFieldType *const cType = new StandardDurationFieldType("days", DAYS);
+    return cType;
+}
+
+const DurationFieldType *DurationFieldType::halfdays() {
+    static const DurationFieldType *const cType = new StandardDurationFieldType("halfdays", HALFDAYS);
+    return cType;
+}
+
+const DurationFieldType *DurationFieldType::hours() {
+    static const DurationFieldType *const cType = new StandardDurationFieldType("hours", HOURS);
+    return cType;
+}
+
+const DurationFieldType *DurationFieldType::minutes() {
+    static const DurationFieldType *const cType = new StandardDurationFieldType("minutes", MINUTES);
+    return cType;
+}
+
+const DurationFieldType *DurationFieldType::seconds() {
+    static const DurationFieldType *const cType = new StandardDurationFieldType("seconds", SECONDS);
+    return cType;
+}
+
+const DurationFieldType *DurationFieldType::millis() {
+    static const DurationFieldType *const cType = new StandardDurationFieldType("millis", MILLIS);
+    return cType;
+}
 
 bool DurationFieldType::isSupported(Chronology *chronology) {
     return getField(chronology)->isSupported();
@@ -95,29 +135,29 @@ const DurationField *StandardDurationFieldType::getField(Chronology *chronology)
 const DurationFieldType *StandardDurationFieldType::readResolve() {
     switch (iOrdinal) {
         case ERAS:
-            return ERAS_TYPE;
+            return eras();
         case CENTURIES:
-            return CENTURIES_TYPE;
+            return centuries();
         case WEEKYEARS:
-            return WEEKYEARS_TYPE;
+            return weekyears();
         case YEARS:
-            return YEARS_TYPE;
+            return years();
         case MONTHS:
-            return MONTHS_TYPE;
+            return months();
         case WEEKS:
-            return WEEKS_TYPE;
+            return weeks();
         case DAYS:
-            return DAYS_TYPE;
+            return days();
         case HALFDAYS:
-            return HALFDAYS_TYPE;
+            return halfdays();
         case HOURS:
-            return HOURS_TYPE;
+            return hours();
         case MINUTES:
-            return MINUTES_TYPE;
+            return minutes();
         case SECONDS:
-            return SECONDS_TYPE;
+            return seconds();
         case MILLIS:
-            return MILLIS_TYPE;
+            return millis();
         default:
             // Shouldn't happen.
             return this;
@@ -57,31 +57,6 @@ private:
     
 protected:
     
-    /** The eras field type. */
-    static const DurationFieldType *ERAS_TYPE;
-    /** The centuries field type. */
-    static const DurationFieldType *CENTURIES_TYPE;
-    /** The weekyears field type. */
-    static const DurationFieldType *WEEKYEARS_TYPE;
-    /** The years field type. */
-    static const DurationFieldType *YEARS_TYPE;
-    /** The months field type. */
-    static const DurationFieldType *MONTHS_TYPE;
-    /** The weeks field type. */
-    static const DurationFieldType *WEEKS_TYPE;
-    /** The days field type. */
-    static const DurationFieldType *DAYS_TYPE;
-    /** The halfdays field type. */
-    static const DurationFieldType *HALFDAYS_TYPE;
-    /** The hours field type. */
-    static const DurationFieldType *HOURS_TYPE;
-    /** The minutes field type. */
-    static const DurationFieldType *MINUTES_TYPE;
-    /** The seconds field type. */
-    static const DurationFieldType *SECONDS_TYPE;
-    /** The millis field type. */
-    static const DurationFieldType *MILLIS_TYPE;
-    
     // Ordinals for standard field types.
     static const unsigned char
     ERAS = 1,
@@ -114,45 +89,35 @@ public:
      *
      * @return the DateTimeFieldType constant
      */
-    static const DurationFieldType *millis() {
-        return MILLIS_TYPE;
-    }
+    static const DurationFieldType *millis();
     
     /**
      * Get the seconds field type.
      *
      * @return the DateTimeFieldType constant
      */
-    static const DurationFieldType *seconds() {
-        return SECONDS_TYPE;
-    }
+    static const DurationFieldType *seconds();
     
     /**
      * Get the minutes field type.
      *
      * @return the DateTimeFieldType constant
      */
-    static const DurationFieldType *minutes() {
-        return MINUTES_TYPE;
-    }
+    static const DurationFieldType *minutes();
     
     /**
      * Get the hours field type.
      *
      * @return the DateTimeFieldType constant
      */
-    static const DurationFieldType *hours() {
-        return HOURS_TYPE;
-    }
+    static const DurationFieldType *hours();
     
     /**
      * Get the halfdays field type.
      *
      * @return the DateTimeFieldType constant
      */
-    static const DurationFieldType *halfdays() {
-        return HALFDAYS_TYPE;
-    }
+    static const DurationFieldType *halfdays();
     
     //-----------------------------------------------------------------------
     /**
@@ -160,61 +125,49 @@ public:
      *
      * @return the DateTimeFieldType constant
      */
-    static const DurationFieldType *days() {
-        return DAYS_TYPE;
-    }
+    static const DurationFieldType *days();
     
     /**
      * Get the weeks field type.
      *
      * @return the DateTimeFieldType constant
      */
-    static const DurationFieldType *weeks() {
-        return WEEKS_TYPE;
-    }
+    static const DurationFieldType *weeks();
     
     /**
      * Get the weekyears field type.
      *
      * @return the DateTimeFieldType constant
      */
-    static const DurationFieldType *weekyears() {
-        return WEEKYEARS_TYPE;
-    }
+    static const DurationFieldType *weekyears();
     
     /**
      * Get the months field type.
      *
      * @return the DateTimeFieldType constant
      */
-    static const DurationFieldType *months() {
-        return MONTHS_TYPE;
-    }
+    static const DurationFieldType *months();
     
     /**
      * Get the years field type.
      *
      * @return the DateTimeFieldType constant
      */
-    static const DurationFieldType *years() {
-        return YEARS_TYPE;
-    }
+    static const DurationFieldType *years();
     
     /**
      * Get the centuries field type.
      *
      * @return the DateTimeFieldType constant
      */
-    static const DurationFieldType *centuries() {
-        return CENTURIES_TYPE;
-    }
+    static const DurationFieldType *centuries();
     
     /**
      * Get the eras field type.
      *
      * @return the DateTimeFieldType constant
      */
-    static const DurationFieldType *eras() { return ERAS_TYPE; }
+    static const DurationFieldType *eras();
     
     //-----------------------------------------------------------------------
     /**
@@ -275,7 +228,7 @@ public:
     bool equals(const Object *obj) const;
     
     /** @inheritdoc */
-    int hashCode() { return (1 << iOrdinal); }
+    int hashCode() const { return (1 << iOrdinal); }
     
     const DurationField *getField(Chronology *chronology) const;
     
@@ -0,0 +1,138 @@
+//
+//  Hours.cpp
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#include "Hours.h"
+
+#include "DateTimeConstants.h"
+#include "Days.h"
+#include "Duration.h"
+#include "DurationFieldType.h"
+#include "Minutes.h"
+#include "Period.h"
+#include "PeriodType.h"
+#include "Seconds.h"
+#include "Weeks.h"
+#include "field/FieldUtils.h"
+
+#include <climits>
+
+CODATIME_BEGIN
+
+const Hours Hours::ZERO = Hours(0);
+const Hours Hours::ONE = Hours(1);
+const Hours Hours::TWO = Hours(2);
+const Hours Hours::THREE = Hours(3);
+const Hours Hours::FOUR = Hours(4);
+const Hours Hours::FIVE = Hours(5);
+const Hours Hours::SIX = Hours(6);
+const Hours Hours::SEVEN = Hours(7);
+const Hours Hours::EIGHT = Hours(8);
+const Hours Hours::MAX_VALUE = Hours(INT_MAX);
+const Hours Hours::MIN_VALUE = Hours(INT_MIN);
+
+//-----------------------------------------------------------------------
+Hours Hours::hoursBetween(ReadableInstant *start, ReadableInstant *end) {
+    return Hours(BaseSingleFieldPeriod::between(start, end, DurationFieldType::hours()));
+}
+
+Hours Hours::hoursBetween(ReadablePartial *start, ReadablePartial *end) {
+    return Hours(BaseSingleFieldPeriod::between(start, end, DurationFieldType::hours()));
+}
+
+Hours Hours::hoursIn(ReadableInterval *interval) {
+    return Hours(BaseSingleFieldPeriod::between(interval, DurationFieldType::hours()));
+}
+
+Hours Hours::standardHoursIn(ReadablePeriod *period) {
+    return Hours(BaseSingleFieldPeriod::standardPeriodIn(period, DateTimeConstants::MILLIS_PER_HOUR));
+}
+
+//-----------------------------------------------------------------------
+const DurationFieldType *Hours::getFieldType() const {
+    return DurationFieldType::hours();
+}
+
+PeriodType *Hours::getPeriodType() const {
+    return PeriodType::hours();
+}
+
+//-----------------------------------------------------------------------
+Weeks Hours::toStandardWeeks() const {
+    return Weeks::weeks(getValue() / DateTimeConstants::HOURS_PER_WEEK);
+}
+
+Days Hours::toStandardDays() const {
+    return Days::days(getValue() / DateTimeConstants::HOURS_PER_DAY);
+}
+
+Minutes Hours::toStandardMinutes() const {
+    return Minutes::minutes(FieldUtils::safeMultiply(getValue(), DateTimeConstants::MINUTES_PER_HOUR));
+}
+
+Seconds Hours::toStandardSeconds() const {
+    return Seconds::seconds(FieldUtils::safeMultiply(getValue(), DateTimeConstants::SECONDS_PER_HOUR));
+}
+
+Duration *Hours::toStandardDuration() const {
+    int64_t hours = getValue();  // assign to a int64_t
+    return new Duration(hours * DateTimeConstants::MILLIS_PER_HOUR);
+}
+
+Period *Hours::toPeriod() const {
+    return Period::hours(getValue());
+}
+
+//-----------------------------------------------------------------------
+Hours Hours::plus(int hours) const {
+    if (hours == 0) {
+        return *this;
+    }
+    return Hours::hours(FieldUtils::safeAdd(getValue(), hours));
+}
+
+Hours Hours::plus(const Hours &hours) const {
+    return plus(hours.getValue());
+}
+
+Hours Hours::minus(int hours) const {
+    return plus(FieldUtils::safeNegate(hours));
+}
+
+Hours Hours::minus(const Hours &hours) const {
+    return minus(hours.getValue());
+}
+
+//-----------------------------------------------------------------------
+Hours Hours::multipliedBy(int scalar) const {
+    return Hours::hours(multipliedValue(scalar));
+}
+
+Hours Hours::dividedBy(int divisor) const {
+    if (divisor == 1) {
+        return *this;
+    }
+    return Hours::hours(dividedValue(divisor));
+}
+
+Hours Hours::negated() const {
+    return Hours::hours(FieldUtils::safeNegate(getValue()));
+}
+
+int Hours::hashCode() const {
+    int total = 17;
+    total = 27 * total + getValue();
+    total = 27 * total + getFieldType()->hashCode();
+    return total;
+}
+
+//-----------------------------------------------------------------------
+string Hours::toString() const {
+    return BaseSingleFieldPeriod::toString("PT", 'H');
+}
+
+CODATIME_END
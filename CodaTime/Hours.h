@@ -0,0 +1,357 @@
+//
+//  Hours.h
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#ifndef __CodaTime__Hours__
+#define __CodaTime__Hours__
+
+#include "CodaTimeMacros.h"
+
+#include "base/BaseSingleFieldPeriod.h"
+
+#include <string>
+
+using namespace std;
+
+CODATIME_BEGIN
+
+class Days;
+class Duration;
+class DurationFieldType;
+class Minutes;
+class Period;
+class PeriodType;
+class ReadableInstant;
+class ReadableInterval;
+class ReadablePartial;
+class ReadablePeriod;
+class Seconds;
+class Weeks;
+
+/**
+ * An immutable time period representing a number of hours.
+ * <p>
+ * <code>Hours</code> is an immutable period that can only store hours.
+ * It does not store years, months or hours for example. As such it is a
+ * type-safe way of representing a number of hours in an application.
+ * <p>
+ * The number of hours is set in the constructor, and may be queried using
+ * <code>getHours()</code>. Basic mathematical operations are provided -
+ * <code>plus()</code>, <code>minus()</code>, <code>multipliedBy()</code> and
+ * <code>dividedBy()</code>.
+ * <p>
+ * <code>Hours</code> is a value type holding a single int. It should be passed
+ * and returned by value rather than allocated.
+ * <p>
+ * Hours is thread-safe and immutable.
+ *
+ * @author Stephen Colebourne
+ * @since 1.4
+ */
+class Hours : public BaseSingleFieldPeriod {
+    
+public:
+    
+    /** Constant representing zero hours. */
+    static const Hours ZERO;
+    /** Constant representing one hour. */
+    static const Hours ONE;
+    /** Constant representing two hours. */
+    static const Hours TWO;
+    /** Constant representing three hours. */
+    static const Hours THREE;
+    /** Constant representing four hours. */
+    static const Hours FOUR;
+    /** Constant representing five hours. */
+    static const Hours FIVE;
+    /** Constant representing six hours. */
+    static const Hours SIX;
+    /** Constant representing seven hours. */
+    static const Hours SEVEN;
+    /** Constant representing eight hours. */
+    static const Hours EIGHT;
+    /** Constant representing the maximum number of hours that can be stored in this object. */
+    static const Hours MAX_VALUE;
+    /** Constant representing the minimum number of hours that can be stored in this object. */
+    static const Hours MIN_VALUE;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Creates a new instance representing the specified number of hours.
+     *
+     * @param hours  the number of hours to represent
+     */
+    constexpr Hours(int hours) : BaseSingleFieldPeriod(hours) {
+    }
+    
+    /**
+     * Obtains an instance of <code>Hours</code>.
+     *
+     * @param hours  the number of hours to obtain an instance for
+     * @return the instance of Hours
+     */
+    static constexpr Hours hours(int hours) {
+        return Hours(hours);
+    }
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Creates a <code>Hours</code> representing the number of whole hours
+     * between the two specified datetimes. This method correctly handles
+     * any daylight savings time changes that may occur during the interval.
+     * <p>
+     * The difference is read directly from the hours field of the start's
+     * chronology, no intermediate <code>Period</code> is created.
+     *
+     * @param start  the start instant, must not be null
+     * @param end  the end instant, must not be null
+     * @return the period in hours
+     * @throws IllegalArgumentException if the instants are null or invalid
+     */
+    static Hours hoursBetween(ReadableInstant *start, ReadableInstant *end);
+    
+    /**
+     * Creates a <code>Hours</code> representing the number of whole hours
+     * between the two specified partial datetimes.
+     * <p>
+     * The two partials must contain the same fields, for example you can specify
+     * two <code>LocalDate</code> objects.
+     *
+     * @param start  the start partial date, must not be null
+     * @param end  the end partial date, must not be null
+     * @return the period in hours
+     * @throws IllegalArgumentException if the partials are null or invalid
+     */
+    static Hours hoursBetween(ReadablePartial *start, ReadablePartial *end);
+    
+    /**
+     * Creates a <code>Hours</code> representing the number of whole hours
+     * in the specified interval.
+     *
+     * @param interval  the interval to extract hours from, null returns zero
+     * @return the period in hours
+     * @throws IllegalArgumentException if the partials are null or invalid
+     */
+    static Hours hoursIn(ReadableInterval *interval);
+    
+    /**
+     * Creates a new <code>Hours</code> representing the number of complete
+     * standard length hours in the specified period.
+     * <p>
+     * This factory method converts all fields from the period to hours using standardised
+     * durations for each field. Only those fields which have a precise duration in
+     * the ISO UTC chronology can be converted.
+     *
+     * @param period  the period to get the number of hours from, null returns zero
+     * @return the period in hours
+     * @throws IllegalArgumentException if the period contains imprecise duration values
+     */
+    static Hours standardHoursIn(ReadablePeriod *period);
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Gets the duration field type, which is <code>hours</code>.
+     *
+     * @return the period type
+     */
+    const DurationFieldType *getFieldType() const;
+    
+    /**
+     * Gets the period type, which is <code>hours</code>.
+     *
+     * @return the period type
+     */
+    PeriodType *getPeriodType() const;
+    
+    /**
+     * Gets the number of hours that this period represents.
+     *
+     * @return the number of hours in the period
+     */
+    constexpr int getHours() const {
+        return getValue();
+    }
+    
+    /**
+     * Converts this period in hours to a period in weeks assuming a
+     * hours per week standard.
+     * <p>
+     * The result is the number of whole weeks, truncated towards zero.
+     *
+     * @return a period representing the number of whole weeks for this number of hours
+     */
+    Weeks toStandardWeeks() const;
+    
+    /**
+     * Converts this period in hours to a period in days assuming a
+     * hours per day standard.
+     * <p>
+     * The result is the number of whole days, truncated towards zero.
+     *
+     * @return a period representing the number of whole days for this number of hours
+     */
+    Days toStandardDays() const;
+    
+    /**
+     * Converts this period in hours to a period in minutes assuming a
+     * minutes per hour standard.
+     *
+     * @return a period representing the number of minutes for this number of hours
+     * @throws ArithmeticException if the number of minutes is too large to be represented
+     */
+    Minutes toStandardMinutes() const;
+    
+    /**
+     * Converts this period in hours to a period in seconds assuming a
+     * seconds per hour standard.
+     *
+     * @return a period representing the number of seconds for this number of hours
+     * @throws ArithmeticException if the number of seconds is too large to be represented
+     */
+    Seconds toStandardSeconds() const;
+    
+    /**
+     * Converts this period in hours to a duration in milliseconds assuming a
+     * millis per hour standard.
+     *
+     * @return a duration equivalent to this number of hours
+     */
+    Duration *toStandardDuration() const;
+    
+    /**
+     * Converts this period to a <code>Period</code> with the standard period type.
+     *
+     * @return a period representing the same number of hours
+     */
+    Period *toPeriod() const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Returns a new instance with the specified number of hours added.
+     *
+     * @param hours  the amount of hours to add, may be negative
+     * @return the new period plus the specified number of hours
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Hours plus(int hours) const;
+    
+    /**
+     * Returns a new instance with the specified number of hours added.
+     *
+     * @param hours  the amount of hours to add, may be negative
+     * @return the new period plus the specified number of hours
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Hours plus(const Hours &hours) const;
+    
+    /**
+     * Returns a new instance with the specified number of hours taken away.
+     *
+     * @param hours  the amount of hours to take away, may be negative
+     * @return the new period minus the specified number of hours
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Hours minus(int hours) const;
+    
+    /**
+     * Returns a new instance with the specified number of hours taken away.
+     *
+     * @param hours  the amount of hours to take away, may be negative
+     * @return the new period minus the specified number of hours
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Hours minus(const Hours &hours) const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Returns a new instance with the hours multiplied by the specified scalar.
+     *
+     * @param scalar  the amount to multiply by, may be negative
+     * @return the new period multiplied by the specified scalar
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Hours multipliedBy(int scalar) const;
+    
+    /**
+     * Returns a new instance with the hours divided by the specified divisor.
+     * The calculation uses integer division, thus 3 divided by 2 is 1.
+     *
+     * @param divisor  the amount to divide by, may be negative
+     * @return the new period divided by the specified divisor
+     * @throws ArithmeticException if the divisor is zero
+     */
+    Hours dividedBy(int divisor) const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Returns a new instance with the hours value negated.
+     *
+     * @return the new period with a negated value
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Hours negated() const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Is this hours instance greater than the specified number of hours.
+     *
+     * @param other  the other period
+     * @return true if this hours instance is greater than the specified one
+     */
+    constexpr bool isGreaterThan(const Hours &other) const {
+        return getValue() > other.getValue();
+    }
+    
+    /**
+     * Is this hours instance less than the specified number of hours.
+     *
+     * @param other  the other period
+     * @return true if this hours instance is less than the specified one
+     */
+    constexpr bool isLessThan(const Hours &other) const {
+        return getValue() < other.getValue();
+    }
+    
+    /**
+     * Compares this period to another of the same type.
+     *
+     * @param other  the other period
+     * @return negative if this is less, zero if equal, positive if greater
+     */
+    constexpr int compareTo(const Hours &other) const {
+        return (getValue() > other.getValue() ? 1 : (getValue() < other.getValue() ? -1 : 0));
+    }
+    
+    constexpr bool equals(const Hours &other) const {
+        return getValue() == other.getValue();
+    }
+    
+    constexpr bool operator==(const Hours &other) const {
+        return getValue() == other.getValue();
+    }
+    
+    constexpr bool operator!=(const Hours &other) const {
+        return getValue() != other.getValue();
+    }
+    
+    int hashCode() const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Gets this instance as a string in the ISO8601 duration format.
+     * <p>
+     * For example, "PT4H" represents 4 hours.
+     *
+     * @return the value as an ISO8601 string
+     */
+    string toString() const;
+    
+};
+
+CODATIME_END
+
+#endif /* defined(__CodaTime__Hours__) */
@@ -11,7 +11,7 @@
 
 #include "CodaTimeMacros.h"
 
-#include "base/Baseinterval.h"
+#include "base/BaseInterval.h"
 #include "ReadableInterval.h"
 
 #include <string>
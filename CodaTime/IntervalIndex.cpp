@@ -0,0 +1,228 @@
+//
+//  IntervalIndex.cpp
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#include "IntervalIndex.h"
+
+#include "DateTimeUtils.h"
+#include "Exceptions.h"
+#include "ReadableInstant.h"
+#include "ReadableInterval.h"
+#include "WorkerThreads.h"
+
+#include <algorithm>
+#include <climits>
+
+CODATIME_BEGIN
+
+/** An interval being indexed, with its original position */
+struct IndexEntry {
+    int64_t iStart;
+    int64_t iEnd;
+    size_t iPosition;
+    
+    bool operator<(const IndexEntry &other) const {
+        if (iStart != other.iStart) {
+            return iStart < other.iStart;
+        }
+        if (iEnd != other.iEnd) {
+            return iEnd < other.iEnd;
+        }
+        return iPosition < other.iPosition;
+    }
+};
+
+static void sortEntries(IndexEntry *first, IndexEntry *last) {
+    sort(first, last);
+}
+
+static bool endsAfter(int64_t instant, const IntervalIndex::Gap &gap) {
+    return instant < gap.second;
+}
+
+IntervalIndex::IntervalIndex(const int64_t *starts, const int64_t *ends, size_t count) {
+    init(starts, ends, count, 1);
+}
+
+IntervalIndex::IntervalIndex(const int64_t *starts, const int64_t *ends, size_t count, int threads) {
+    init(starts, ends, count, threads);
+}
+
+IntervalIndex::IntervalIndex(ReadableInterval *const *intervals, size_t count) {
+    vector<int64_t> starts(count);
+    vector<int64_t> ends(count);
+    for (size_t i = 0; i < count; i++) {
+        if (intervals[i] == NULL) {
+            throw IllegalArgumentException("Interval must not be null");
+        }
+        starts[i] = intervals[i]->getStartMillis();
+        ends[i] = intervals[i]->getEndMillis();
+    }
+    init(starts.data(), ends.data(), count, 1);
+}
+
+void IntervalIndex::init(const int64_t *starts, const int64_t *ends, size_t count, int threads) {
+    vector<IndexEntry> entries(count);
+    for (size_t i = 0; i < count; i++) {
+        if (ends[i] < starts[i]) {
+            throw IllegalArgumentException("The end instant must be greater or equal to the start");
+        }
+        entries[i].iStart = starts[i];
+        entries[i].iEnd = ends[i];
+        entries[i].iPosition = i;
+    }
+    
+    size_t chunks = (threads < 1 ? 1 : (size_t) threads);
+    if (chunks > count) {
+        chunks = (count == 0 ? 1 : count);
+    }
+    if (chunks == 1) {
+        sortEntries(entries.data(), entries.data() + count);
+    } else {
+        // sort each chunk on its own thread, then merge the sorted runs
+        size_t chunkSize = (count + chunks - 1) / chunks;
+        IndexEntry *base = entries.data();
+        WorkerThreads workers(chunks - 1);
+        for (size_t c = 1; c < chunks; c++) {
+            size_t start = c * chunkSize;
+            size_t end = min(count, start + chunkSize);
+            if (start < end) {
+                workers.start(sortEntries, base + start, base + end);
+            }
+        }
+        sortEntries(base, base + min(count, chunkSize));
+        workers.join();
+        for (size_t merged = chunkSize; merged < count; merged += chunkSize) {
+            inplace_merge(base, base + merged, base + min(count, merged + chunkSize));
+        }
+    }
+    
+    iStarts.resize(count);
+    iEnds.resize(count);
+    iPositions.resize(count);
+    for (size_t i = 0; i < count; i++) {
+        iStarts[i] = entries[i].iStart;
+        iEnds[i] = entries[i].iEnd;
+        iPositions[i] = entries[i].iPosition;
+    }
+    
+    iLeafCount = 1;
+    while (iLeafCount < count) {
+        iLeafCount <<= 1;
+    }
+    iMaxEnds.assign(iLeafCount * 2, LLONG_MIN);
+    copy(iEnds.begin(), iEnds.end(), iMaxEnds.begin() + iLeafCount);
+    for (size_t node = iLeafCount - 1; node > 0; node--) {
+        iMaxEnds[node] = max(iMaxEnds[node * 2], iMaxEnds[node * 2 + 1]);
+    }
+    
+    // a gap opens wherever an interval starts after everything before it has ended
+    if (count > 0) {
+        int64_t coveredTo = iEnds[0];
+        for (size_t i = 1; i < count; i++) {
+            if (iStarts[i] > coveredTo) {
+                iGaps.push_back(Gap(coveredTo, iStarts[i]));
+            }
+            coveredTo = max(coveredTo, iEnds[i]);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------
+void IntervalIndex::collect(size_t node, size_t first, size_t last, size_t limit, int64_t after, vector<size_t> &result) const {
+    if (first >= limit || iMaxEnds[node] <= after) {
+        return;
+    }
+    if (node >= iLeafCount) {
+        result.push_back(iPositions[first]);
+        return;
+    }
+    size_t mid = first + (last - first) / 2;
+    collect(node * 2, first, mid, limit, after, result);
+    collect(node * 2 + 1, mid, last, limit, after, result);
+}
+
+size_t IntervalIndex::size() const {
+    return iStarts.size();
+}
+
+size_t IntervalIndex::findContaining(int64_t millisInstant, vector<size_t> &result) const {
+    size_t limit = upper_bound(iStarts.begin(), iStarts.end(), millisInstant) - iStarts.begin();
+    size_t found = result.size();
+    collect(1, 0, iLeafCount, limit, millisInstant, result);
+    return result.size() - found;
+}
+
+size_t IntervalIndex::findContaining(ReadableInstant *instant, vector<size_t> &result) const {
+    return findContaining(DateTimeUtils::getInstantMillis(instant), result);
+}
+
+size_t IntervalIndex::findOverlapping(int64_t startInstant, int64_t endInstant, vector<size_t> &result) const {
+    if (endInstant < startInstant) {
+        throw IllegalArgumentException("The end instant must be greater or equal to the start");
+    }
+    size_t limit = lower_bound(iStarts.begin(), iStarts.end(), endInstant) - iStarts.begin();
+    size_t found = result.size();
+    collect(1, 0, iLeafCount, limit, startInstant, result);
+    return result.size() - found;
+}
+
+size_t IntervalIndex::findOverlapping(ReadableInterval *interval, vector<size_t> &result) const {
+    interval = DateTimeUtils::getReadableInterval(interval);
+    return findOverlapping(interval->getStartMillis(), interval->getEndMillis(), result);
+}
+
+bool IntervalIndex::overlapsAny(int64_t startInstant, int64_t endInstant) const {
+    if (endInstant < startInstant) {
+        throw IllegalArgumentException("The end instant must be greater or equal to the start");
+    }
+    size_t limit = lower_bound(iStarts.begin(), iStarts.end(), endInstant) - iStarts.begin();
+    int64_t latestEnd = LLONG_MIN;
+    for (size_t left = iLeafCount, right = iLeafCount + limit; left < right; left >>= 1, right >>= 1) {
+        if (left & 1) {
+            latestEnd = max(latestEnd, iMaxEnds[left++]);
+        }
+        if (right & 1) {
+            latestEnd = max(latestEnd, iMaxEnds[--right]);
+        }
+    }
+    return latestEnd > startInstant;
+}
+
+//-----------------------------------------------------------------------
+size_t IntervalIndex::findNearestGaps(int64_t millisInstant, size_t k, vector<Gap> &result) const {
+    // the gaps are disjoint and sorted, so those ending by the instant lie to its left
+    vector<Gap>::const_iterator split = upper_bound(iGaps.begin(), iGaps.end(), millisInstant, endsAfter);
+    size_t right = split - iGaps.begin();
+    size_t left = right;
+    size_t found = 0;
+    while (found < k && (left > 0 || right < iGaps.size())) {
+        bool takeLeft;
+        if (left == 0) {
+            takeLeft = false;
+        } else if (right == iGaps.size()) {
+            takeLeft = true;
+        } else {
+            uint64_t leftDistance = (uint64_t) millisInstant - (uint64_t) iGaps[left - 1].second;
+            uint64_t rightDistance = (iGaps[right].first <= millisInstant ? 0 : (uint64_t) iGaps[right].first - (uint64_t) millisInstant);
+            takeLeft = (leftDistance <= rightDistance);
+        }
+        if (takeLeft) {
+            result.push_back(iGaps[--left]);
+        } else {
+            result.push_back(iGaps[right++]);
+        }
+        found++;
+    }
+    return found;
+}
+
+const vector<IntervalIndex::Gap> &IntervalIndex::getGaps() const {
+    return iGaps;
+}
+
+CODATIME_END
@@ -0,0 +1,200 @@
+//
+//  IntervalIndex.h
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#ifndef __CodaTime__IntervalIndex__
+#define __CodaTime__IntervalIndex__
+
+#include "CodaTimeMacros.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+CODATIME_BEGIN
+
+class ReadableInstant;
+class ReadableInterval;
+
+/**
+ * IntervalIndex is an immutable index over a collection of intervals,
+ * answering which of them contain an instant or overlap an interval.
+ * <p>
+ * The intervals are held as millisecond endpoints only, sorted by start.
+ * Alongside them is an implicit tree recording the latest end within each
+ * range of the sorted order, so a query skips any range that ends too
+ * early to match. Queries take O(log n + k log n) time for k matches and
+ * building takes O(n log n).
+ * <p>
+ * Results are reported as the positions of the intervals in the arrays
+ * the index was built from, rather than as new <code>Interval</code> objects.
+ * <p>
+ * Matching follows <code>AbstractInterval</code>. Intervals are half-open,
+ * so an interval contains its start but not its end, and intervals that
+ * abut do not overlap.
+ * <p>
+ * IntervalIndex is thread-safe and immutable.
+ */
+class IntervalIndex {
+    
+public:
+    
+    /** A gap between intervals, as its start and end millis */
+    typedef pair<int64_t, int64_t> Gap;
+    
+private:
+    
+    /** The interval start millis, in ascending order */
+    vector<int64_t> iStarts;
+    /** The interval end millis, in the same order as the starts */
+    vector<int64_t> iEnds;
+    /** The original position of each interval, in the same order as the starts */
+    vector<size_t> iPositions;
+    /** The latest end in each node of the tree, with the leaves from iLeafCount */
+    vector<int64_t> iMaxEnds;
+    /** The number of leaves in the tree, a power of two */
+    size_t iLeafCount;
+    /** The gaps between the intervals, in ascending order */
+    vector<Gap> iGaps;
+    
+    void init(const int64_t *starts, const int64_t *ends, size_t count, int threads);
+    
+    void collect(size_t node, size_t first, size_t last, size_t limit, int64_t after, vector<size_t> &result) const;
+    
+public:
+    
+    /**
+     * Builds an index over arrays of start and end millis.
+     *
+     * @param starts  the start of each interval, not null unless count is zero
+     * @param ends  the end of each interval, not null unless count is zero
+     * @param count  the number of intervals
+     * @throws IllegalArgumentException if any end is before its start
+     */
+    IntervalIndex(const int64_t *starts, const int64_t *ends, size_t count);
+    
+    /**
+     * Builds an index over arrays of start and end millis, sorting on
+     * several threads.
+     *
+     * @param starts  the start of each interval, not null unless count is zero
+     * @param ends  the end of each interval, not null unless count is zero
+     * @param count  the number of intervals
+     * @param threads  the maximum number of threads to use, one or less builds on the calling thread
+     * @throws IllegalArgumentException if any end is before its start
+     */
+    IntervalIndex(const int64_t *starts, const int64_t *ends, size_t count, int threads);
+    
+    /**
+     * Builds an index over an array of intervals.
+     * <p>
+     * Only the millis of each interval are kept, the chronology is ignored.
+     *
+     * @param intervals  the intervals to index, not null unless count is zero
+     * @param count  the number of intervals
+     * @throws IllegalArgumentException if any interval is null
+     */
+    IntervalIndex(ReadableInterval *const *intervals, size_t count);
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Gets the number of intervals in the index.
+     *
+     * @return the number of intervals
+     */
+    size_t size() const;
+    
+    /**
+     * Finds the intervals that contain the specified instant.
+     * <p>
+     * The positions of the matching intervals are appended to the result
+     * in ascending order of start.
+     *
+     * @param millisInstant  the instant to query
+     * @param result  the vector to append the matching positions to
+     * @return the number of matching intervals
+     */
+    size_t findContaining(int64_t millisInstant, vector<size_t> &result) const;
+    
+    /**
+     * Finds the intervals that contain the specified instant.
+     *
+     * @param instant  the instant to query, null means now
+     * @param result  the vector to append the matching positions to
+     * @return the number of matching intervals
+     */
+    size_t findContaining(ReadableInstant *instant, vector<size_t> &result) const;
+    
+    /**
+     * Finds the intervals that overlap the specified interval.
+     * <p>
+     * The positions of the matching intervals are appended to the result
+     * in ascending order of start.
+     *
+     * @param startInstant  the start of the interval to query
+     * @param endInstant  the end of the interval to query
+     * @param result  the vector to append the matching positions to
+     * @return the number of matching intervals
+     * @throws IllegalArgumentException if the end is before the start
+     */
+    size_t findOverlapping(int64_t startInstant, int64_t endInstant, vector<size_t> &result) const;
+    
+    /**
+     * Finds the intervals that overlap the specified interval.
+     *
+     * @param interval  the interval to query, null means a zero duration interval now
+     * @param result  the vector to append the matching positions to
+     * @return the number of matching intervals
+     */
+    size_t findOverlapping(ReadableInterval *interval, vector<size_t> &result) const;
+    
+    /**
+     * Checks whether any interval overlaps the specified interval.
+     * <p>
+     * This is quicker than finding the overlaps, as it stops at the first.
+     *
+     * @param startInstant  the start of the interval to query
+     * @param endInstant  the end of the interval to query
+     * @return true if at least one interval overlaps
+     * @throws IllegalArgumentException if the end is before the start
+     */
+    bool overlapsAny(int64_t startInstant, int64_t endInstant) const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Finds the gaps nearest to the specified instant.
+     * <p>
+     * A gap is a stretch of time covered by none of the intervals, lying
+     * between two of them as <code>Interval::gap</code> would report.
+     * The time before the first interval and after the last is not a gap.
+     * <p>
+     * The distance to a gap is zero if the gap contains the instant, and
+     * otherwise the millis to its nearer end. The gaps are appended nearest
+     * first, with ties going to the earlier gap.
+     *
+     * @param millisInstant  the instant to query
+     * @param k  the maximum number of gaps to find
+     * @param result  the vector to append the gaps to
+     * @return the number of gaps found
+     */
+    size_t findNearestGaps(int64_t millisInstant, size_t k, vector<Gap> &result) const;
+    
+    /**
+     * Gets all of the gaps between the intervals, in ascending order.
+     *
+     * @return the gaps, owned by the index
+     */
+    const vector<Gap> &getGaps() const;
+    
+};
+
+CODATIME_END
+
+#endif /* defined(__CodaTime__IntervalIndex__) */
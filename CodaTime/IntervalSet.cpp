@@ -0,0 +1,232 @@
+//
+//  IntervalSet.cpp
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#include "IntervalSet.h"
+
+#include "DateTimeUtils.h"
+#include "Exceptions.h"
+#include "field/FieldUtils.h"
+#include "Interval.h"
+#include "ReadableInstant.h"
+#include "ReadableInterval.h"
+
+#include <algorithm>
+
+CODATIME_BEGIN
+
+static bool endsAfter(int64_t instant, const IntervalSet::Span &span) {
+    return instant < span.second;
+}
+
+IntervalSet::IntervalSet() {
+}
+
+IntervalSet::IntervalSet(int64_t startInstant, int64_t endInstant) {
+    if (endInstant < startInstant) {
+        throw IllegalArgumentException("The end instant must be greater or equal to the start");
+    }
+    if (startInstant < endInstant) {
+        iSpans.push_back(Span(startInstant, endInstant));
+    }
+}
+
+IntervalSet::IntervalSet(const int64_t *starts, const int64_t *ends, size_t count) {
+    iSpans.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        if (ends[i] < starts[i]) {
+            throw IllegalArgumentException("The end instant must be greater or equal to the start");
+        }
+        iSpans.push_back(Span(starts[i], ends[i]));
+    }
+    normalize();
+}
+
+IntervalSet::IntervalSet(ReadableInterval *const *intervals, size_t count) {
+    iSpans.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        if (intervals[i] == NULL) {
+            throw IllegalArgumentException("Interval must not be null");
+        }
+        iSpans.push_back(Span(intervals[i]->getStartMillis(), intervals[i]->getEndMillis()));
+    }
+    normalize();
+}
+
+IntervalSet::IntervalSet(vector<Span> &spans, bool normalized) {
+    iSpans.swap(spans);
+    if (normalized == false) {
+        normalize();
+    }
+}
+
+void IntervalSet::normalize() {
+    sort(iSpans.begin(), iSpans.end());
+    size_t size = 0;
+    for (size_t i = 0; i < iSpans.size(); i++) {
+        const Span &span = iSpans[i];
+        if (span.first == span.second) {
+            continue;  // a zero duration interval contains nothing
+        }
+        if (size > 0 && span.first <= iSpans[size - 1].second) {
+            iSpans[size - 1].second = max(iSpans[size - 1].second, span.second);
+        } else {
+            iSpans[size++] = span;
+        }
+    }
+    iSpans.resize(size);
+}
+
+size_t IntervalSet::indexAfter(int64_t millisInstant) const {
+    return upper_bound(iSpans.begin(), iSpans.end(), millisInstant, endsAfter) - iSpans.begin();
+}
+
+//-----------------------------------------------------------------------
+size_t IntervalSet::size() const {
+    return iSpans.size();
+}
+
+bool IntervalSet::isEmpty() const {
+    return iSpans.empty();
+}
+
+const vector<IntervalSet::Span> &IntervalSet::getSpans() const {
+    return iSpans;
+}
+
+Interval *IntervalSet::getInterval(size_t index, Chronology *chrono) const {
+    if (index >= iSpans.size()) {
+        string err("Invalid index: ");
+        err.append(to_string(index));
+        throw IndexOutOfBoundsException(err);
+    }
+    return new Interval(iSpans[index].first, iSpans[index].second, chrono);
+}
+
+int64_t IntervalSet::toDurationMillis() const {
+    int64_t total = 0;
+    for (size_t i = 0; i < iSpans.size(); i++) {
+        total = FieldUtils::safeAdd(total, FieldUtils::safeSubtract(iSpans[i].second, iSpans[i].first));
+    }
+    return total;
+}
+
+int64_t IntervalSet::getDurationMillisWithin(int64_t startInstant, int64_t endInstant) const {
+    if (endInstant < startInstant) {
+        throw IllegalArgumentException("The end instant must be greater or equal to the start");
+    }
+    int64_t total = 0;
+    for (size_t i = indexAfter(startInstant); i < iSpans.size() && iSpans[i].first < endInstant; i++) {
+        int64_t start = max(iSpans[i].first, startInstant);
+        int64_t end = min(iSpans[i].second, endInstant);
+        total = FieldUtils::safeAdd(total, FieldUtils::safeSubtract(end, start));
+    }
+    return total;
+}
+
+//-----------------------------------------------------------------------
+bool IntervalSet::contains(int64_t millisInstant) const {
+    size_t i = indexAfter(millisInstant);
+    return i < iSpans.size() && iSpans[i].first <= millisInstant;
+}
+
+bool IntervalSet::contains(ReadableInstant *instant) const {
+    return contains(DateTimeUtils::getInstantMillis(instant));
+}
+
+bool IntervalSet::contains(ReadableInterval *interval) const {
+    interval = DateTimeUtils::getReadableInterval(interval);
+    int64_t otherStart = interval->getStartMillis();
+    int64_t otherEnd = interval->getEndMillis();
+    size_t i = indexAfter(otherStart);
+    return i < iSpans.size() && iSpans[i].first <= otherStart && otherEnd <= iSpans[i].second;
+}
+
+bool IntervalSet::overlaps(ReadableInterval *interval) const {
+    interval = DateTimeUtils::getReadableInterval(interval);
+    int64_t otherStart = interval->getStartMillis();
+    int64_t otherEnd = interval->getEndMillis();
+    size_t i = indexAfter(otherStart);
+    return i < iSpans.size() && iSpans[i].first < otherEnd;
+}
+
+//-----------------------------------------------------------------------
+IntervalSet IntervalSet::unionWith(const IntervalSet &other) const {
+    const vector<Span> &a = iSpans;
+    const vector<Span> &b = other.iSpans;
+    vector<Span> spans;
+    spans.reserve(a.size() + b.size());
+    size_t i = 0, j = 0;
+    while (i < a.size() || j < b.size()) {
+        const Span &next = (j == b.size() || (i < a.size() && a[i].first <= b[j].first) ? a[i++] : b[j++]);
+        if (spans.empty() == false && next.first <= spans.back().second) {
+            spans.back().second = max(spans.back().second, next.second);
+        } else {
+            spans.push_back(next);
+        }
+    }
+    return IntervalSet(spans, true);
+}
+
+IntervalSet IntervalSet::intersect(const IntervalSet &other) const {
+    const vector<Span> &a = iSpans;
+    const vector<Span> &b = other.iSpans;
+    vector<Span> spans;
+    size_t i = 0, j = 0;
+    while (i < a.size() && j < b.size()) {
+        int64_t start = max(a[i].first, b[j].first);
+        int64_t end = min(a[i].second, b[j].second);
+        if (start < end) {
+            spans.push_back(Span(start, end));
+        }
+        if (a[i].second < b[j].second) {
+            i++;
+        } else {
+            j++;
+        }
+    }
+    return IntervalSet(spans, true);
+}
+
+IntervalSet IntervalSet::subtract(const IntervalSet &other) const {
+    const vector<Span> &a = iSpans;
+    const vector<Span> &b = other.iSpans;
+    vector<Span> spans;
+    size_t j = 0;
+    for (size_t i = 0; i < a.size(); i++) {
+        int64_t start = a[i].first;
+        while (j < b.size() && b[j].second <= start) {
+            j++;
+        }
+        // the last removed span may reach into the next span of this set, so j stays on it
+        for (size_t k = j; k < b.size() && b[k].first < a[i].second; k++) {
+            if (b[k].first > start) {
+                spans.push_back(Span(start, b[k].first));
+            }
+            start = max(start, b[k].second);
+        }
+        if (start < a[i].second) {
+            spans.push_back(Span(start, a[i].second));
+        }
+    }
+    return IntervalSet(spans, true);
+}
+
+IntervalSet IntervalSet::complement(int64_t startInstant, int64_t endInstant) const {
+    return IntervalSet(startInstant, endInstant).subtract(*this);
+}
+
+//-----------------------------------------------------------------------
+bool IntervalSet::operator==(const IntervalSet &other) const {
+    return iSpans == other.iSpans;
+}
+
+bool IntervalSet::operator!=(const IntervalSet &other) const {
+    return iSpans != other.iSpans;
+}
+
+CODATIME_END
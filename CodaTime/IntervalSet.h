@@ -0,0 +1,232 @@
+//
+//  IntervalSet.h
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#ifndef __CodaTime__IntervalSet__
+#define __CodaTime__IntervalSet__
+
+#include "CodaTimeMacros.h"
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+CODATIME_BEGIN
+
+class Chronology;
+class Interval;
+class ReadableInstant;
+class ReadableInterval;
+
+/**
+ * IntervalSet is an immutable set of instants, held as sorted and
+ * coalesced spans of millis.
+ * <p>
+ * Each span is half-open, containing its start but not its end, as an
+ * <code>Interval</code> does. Spans never overlap or abut, since those are
+ * merged, and are never empty, since a zero duration interval contains no
+ * instants. Two sets holding the same instants therefore hold the same spans.
+ * <p>
+ * The set operations walk both sets once in order, so each runs in linear
+ * time and returns a new set by value. Chronology plays no part in the set,
+ * it is only needed to create <code>Interval</code> objects at the edges.
+ * <p>
+ * IntervalSet is thread-safe and immutable.
+ */
+class IntervalSet {
+    
+public:
+    
+    /** A span of the set, as its start and end millis */
+    typedef pair<int64_t, int64_t> Span;
+    
+private:
+    
+    /** The spans in ascending order */
+    vector<Span> iSpans;
+    
+    IntervalSet(vector<Span> &spans, bool normalized);
+    
+    void normalize();
+    
+    size_t indexAfter(int64_t millisInstant) const;
+    
+public:
+    
+    /**
+     * Creates an empty set.
+     */
+    IntervalSet();
+    
+    /**
+     * Creates a set covering one interval.
+     *
+     * @param startInstant  the start of the interval
+     * @param endInstant  the end of the interval
+     * @throws IllegalArgumentException if the end is before the start
+     */
+    IntervalSet(int64_t startInstant, int64_t endInstant);
+    
+    /**
+     * Creates a set covering the union of arrays of intervals.
+     * <p>
+     * The intervals may be in any order and may overlap.
+     *
+     * @param starts  the start of each interval, not null unless count is zero
+     * @param ends  the end of each interval, not null unless count is zero
+     * @param count  the number of intervals
+     * @throws IllegalArgumentException if any end is before its start
+     */
+    IntervalSet(const int64_t *starts, const int64_t *ends, size_t count);
+    
+    /**
+     * Creates a set covering the union of an array of intervals.
+     *
+     * @param intervals  the intervals to cover, not null unless count is zero
+     * @param count  the number of intervals
+     * @throws IllegalArgumentException if any interval is null
+     */
+    IntervalSet(ReadableInterval *const *intervals, size_t count);
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Gets the number of spans in the set.
+     *
+     * @return the number of spans
+     */
+    size_t size() const;
+    
+    /**
+     * Checks whether the set contains no instants.
+     *
+     * @return true if empty
+     */
+    bool isEmpty() const;
+    
+    /**
+     * Gets the spans of the set, in ascending order.
+     *
+     * @return the spans, owned by the set
+     */
+    const vector<Span> &getSpans() const;
+    
+    /**
+     * Gets one span of the set as a new interval.
+     *
+     * @param index  the index of the span
+     * @param chrono  the chronology of the interval, null means ISO in the default zone
+     * @return the interval, owned by the caller
+     * @throws IndexOutOfBoundsException if the index is invalid
+     */
+    Interval *getInterval(size_t index, Chronology *chrono) const;
+    
+    /**
+     * Gets the total duration of the set in milliseconds.
+     *
+     * @return the sum of the durations of the spans
+     * @throws ArithmeticException if the total overflows
+     */
+    int64_t toDurationMillis() const;
+    
+    /**
+     * Gets the duration of the part of the set within an interval, in milliseconds.
+     *
+     * @param startInstant  the start of the interval
+     * @param endInstant  the end of the interval
+     * @return the covered duration within the interval
+     * @throws IllegalArgumentException if the end is before the start
+     */
+    int64_t getDurationMillisWithin(int64_t startInstant, int64_t endInstant) const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Checks whether the set contains an instant.
+     *
+     * @param millisInstant  the instant to check
+     * @return true if a span contains the instant
+     */
+    bool contains(int64_t millisInstant) const;
+    
+    /**
+     * Checks whether the set contains an instant.
+     *
+     * @param instant  the instant to check, null means now
+     * @return true if a span contains the instant
+     */
+    bool contains(ReadableInstant *instant) const;
+    
+    /**
+     * Checks whether the set contains the whole of an interval.
+     * <p>
+     * This follows <code>AbstractInterval::contains</code>, so a zero
+     * duration interval is contained if a span contains its instant.
+     *
+     * @param interval  the interval to check, null means a zero duration interval now
+     * @return true if a single span contains the interval
+     */
+    bool contains(ReadableInterval *interval) const;
+    
+    /**
+     * Checks whether the set overlaps an interval.
+     * <p>
+     * This follows <code>AbstractInterval::overlaps</code>, so spans that
+     * only abut the interval do not overlap it.
+     *
+     * @param interval  the interval to check, null means a zero duration interval now
+     * @return true if any span overlaps the interval
+     */
+    bool overlaps(ReadableInterval *interval) const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Gets the set of instants in either this set or the other.
+     *
+     * @param other  the other set
+     * @return the union
+     */
+    IntervalSet unionWith(const IntervalSet &other) const;
+    
+    /**
+     * Gets the set of instants in both this set and the other.
+     *
+     * @param other  the other set
+     * @return the intersection
+     */
+    IntervalSet intersect(const IntervalSet &other) const;
+    
+    /**
+     * Gets the set of instants in this set but not in the other.
+     *
+     * @param other  the set to remove
+     * @return the difference
+     */
+    IntervalSet subtract(const IntervalSet &other) const;
+    
+    /**
+     * Gets the set of instants within an interval that are not in this set.
+     * <p>
+     * The complement is taken within bounds, as that of all time would
+     * include the instants before the first span and after the last.
+     *
+     * @param startInstant  the start of the bounds
+     * @param endInstant  the end of the bounds
+     * @return the complement within the bounds
+     * @throws IllegalArgumentException if the end is before the start
+     */
+    IntervalSet complement(int64_t startInstant, int64_t endInstant) const;
+    
+    //-----------------------------------------------------------------------
+    bool operator==(const IntervalSet &other) const;
+    bool operator!=(const IntervalSet &other) const;
+    
+};
+
+CODATIME_END
+
+#endif /* defined(__CodaTime__IntervalSet__) */
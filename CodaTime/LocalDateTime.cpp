@@ -46,7 +46,7 @@ LocalDateTime *LocalDateTime::now(Chronology *chronology) {
 int64_t LocalDateTime::init(int64_t instant, Chronology *chronology) {
     
     chronology = DateTimeUtils::getChronology(chronology);
-    int64_t localMillis = chronology->getZone()->getMillisKeepLocal(DateTimeZone::UTC, instant);
+    int64_t localMillis = chronology->getZone()->getMillisKeepLocal(DateTimeZone::UTC(), instant);
     iChronology = chronology->withUTC();
     
     return localMillis;
@@ -263,7 +263,7 @@ Object *LocalDateTime::readResolve() {
     if (iChronology == NULL) {
         return new LocalDateTime(iLocalMillis, ISOChronology::getInstanceUTC());
     }
-    if (DateTimeZone::UTC->equals(iChronology->getZone()) == false) {
+    if (DateTimeZone::UTC()->equals(iChronology->getZone()) == false) {
         return new LocalDateTime(iLocalMillis, iChronology->withUTC());
     }
     return this;
@@ -381,23 +381,13 @@ bool LocalDateTime::isSupported(const DurationFieldType *type) const {
 }
 
 /**
- * Compares this ReadablePartial with another returning true if the chronology,
- * field types and values are equal.
+ * Compares this ReadablePartial with another returning true if it is also
+ * a LocalDateTime with an equal chronology and the same local millis.
  *
  * @param partial  an object to check against
- * @return true if fields and values are equal
+ * @return true if the class, chronology and local millis are equal
  */
 bool LocalDateTime::equals(const Object *partial) const {
-    // override to perform faster
-    if (this == partial) {
-        return true;
-    }
-    const LocalDateTime *other = dynamic_cast<const LocalDateTime*>(partial);
-    if (other != 0) {
-        if (iChronology->equals(other->iChronology)) {
-            return iLocalMillis == other->iLocalMillis;
-        }
-    }
     return BaseLocal::equals(partial);
 }
 
@@ -418,18 +408,6 @@ bool LocalDateTime::equals(const Object *partial) const {
  * @throws NullPointerException if the partial is NULL
  */
 int LocalDateTime::compareTo(const ReadablePartial *partial) const {
-    // override to perform faster
-//    if (this == partial) {
-//        return 0;
-//    }
-    const LocalDateTime *other = dynamic_cast<const LocalDateTime*>(partial);
-    if (other != 0) {
-        if (iChronology->equals(other->iChronology)) {
-            return (iLocalMillis < other->iLocalMillis ? -1 :
-                    (iLocalMillis == other->iLocalMillis ? 0 : 1));
-            
-        }
-    }
     return BaseLocal::compareTo(partial);
 }
 
@@ -466,7 +444,7 @@ DateTime *LocalDateTime::toDateTime(DateTimeZone *zone) {
  * <p>
  * To set a single field use the properties, for example:
  * <pre>
- * DateTime set = dt.monthOfYear()->setCopy(6);
+ * LocalDateTime *set = dt.monthOfYear().setCopy(6);
  * </pre>
  *
  * @param year  the new year value
@@ -492,7 +470,7 @@ LocalDateTime *LocalDateTime::withDate(int year, int monthOfYear, int dayOfMonth
  * <p>
  * To set a single field use the properties, for example:
  * <pre>
- * LocalDateTime *set = dt.hourOfDay()->setCopy(6);
+ * LocalDateTime *set = dt.hourOfDay().setCopy(6);
  * </pre>
  *
  * @param hourOfDay  the hour of the day
@@ -542,7 +520,7 @@ LocalDateTime *LocalDateTime::withFields(ReadablePartial *partial) {
  * These three lines are equivalent:
  * <pre>
  * LocalDateTime *updated = dt.withField(DateTimeFieldtype->dayOfMonth(), 6);
- * LocalDateTime *updated = dt.dayOfMonth()->setCopy(6);
+ * LocalDateTime *updated = dt.dayOfMonth().setCopy(6);
  * LocalDateTime *updated = dt.property(DateTimeFieldtype->dayOfMonth()).setCopy(6);
  * </pre>
  *
@@ -1074,14 +1052,14 @@ LocalDateTime *LocalDateTime::minusMillis(int millis) {
  * @return the property object
  * @throws IllegalArgumentException if the field is NULL or unsupported
  */
-LocalDateTime::Property *LocalDateTime::property(DateTimeFieldType *fieldType) {
+LocalDateTime::Property LocalDateTime::property(DateTimeFieldType *fieldType) {
     if (fieldType == NULL) {
         throw IllegalArgumentException("The DateTimeFieldType must not be NULL");
     }
     if (isSupported(fieldType) == false) {
         throw IllegalArgumentException("Field '" + fieldType->toString() + "' is not supported");
     }
-    return new Property(this, fieldType->getField(getChronology()));
+    return Property(this, fieldType->getField(getChronology()));
 }
 
 //-----------------------------------------------------------------------
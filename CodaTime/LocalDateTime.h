@@ -91,6 +91,10 @@ public:
      * LocalDateTime dt1920 = dt.year().setCopy(1920);
      * </pre>
      * <p>
+     * A property only holds a pointer to the LocalDateTime and to the field, and
+     * is returned by value, so that obtaining and using one does not allocate.
+     * It must not be used after the LocalDateTime it came from is deleted.
+     * <p>
      * LocalDateTime.Property itself is thread-safe and immutable, as well as the
      * LocalDateTime being operated on.
      *
@@ -507,6 +511,7 @@ public:
      */
     Chronology *getChronology() const { return iChronology; }
     
+    const BaseLocal *getBaseLocal() const { return this; }
     bool equals(const Object *partial) const;
     int compareTo(const ReadablePartial *partial) const;
     
@@ -577,7 +582,7 @@ public:
     LocalDateTime *minusSeconds(int seconds);
     LocalDateTime *minusMillis(int millis);
     
-    Property *property(DateTimeFieldType *fieldType);
+    Property property(DateTimeFieldType *fieldType);
     
     /**
      * Get the era field value.
@@ -934,77 +939,77 @@ public:
      *
      * @return the era property
      */
-    Property *era() { return new Property(this, getChronology()->era()); }
+    Property era() { return Property(this, getChronology()->era()); }
     
     /**
      * Get the century of era property which provides access to advanced functionality.
      *
      * @return the year of era property
      */
-    Property *centuryOfEra() { return new Property(this, getChronology()->centuryOfEra()); }
+    Property centuryOfEra() { return Property(this, getChronology()->centuryOfEra()); }
     
     /**
      * Get the year of century property which provides access to advanced functionality.
      *
      * @return the year of era property
      */
-    Property *yearOfCentury() { return new Property(this, getChronology()->yearOfCentury()); }
+    Property yearOfCentury() { return Property(this, getChronology()->yearOfCentury()); }
     
     /**
      * Get the year of era property which provides access to advanced functionality.
      *
      * @return the year of era property
      */
-    Property *yearOfEra() { return new Property(this, getChronology()->yearOfEra()); }
+    Property yearOfEra() { return Property(this, getChronology()->yearOfEra()); }
     
     /**
      * Get the year property which provides access to advanced functionality.
      *
      * @return the year property
      */
-    Property *year() { return new Property(this, getChronology()->year()); }
+    Property year() { return Property(this, getChronology()->year()); }
     
     /**
      * Get the weekyear property which provides access to advanced functionality.
      *
      * @return the weekyear property
      */
-    Property *weekyear() { return new Property(this, getChronology()->weekyear()); }
+    Property weekyear() { return Property(this, getChronology()->weekyear()); }
     
     /**
      * Get the month of year property which provides access to advanced functionality.
      *
      * @return the month of year property
      */
-    Property *monthOfYear() { return new Property(this, getChronology()->monthOfYear()); }
+    Property monthOfYear() { return Property(this, getChronology()->monthOfYear()); }
     
     /**
      * Get the week of a week based year property which provides access to advanced functionality.
      *
      * @return the week of a week based year property
      */
-    Property *weekOfWeekyear() { return new Property(this, getChronology()->weekOfWeekyear()); }
+    Property weekOfWeekyear() { return Property(this, getChronology()->weekOfWeekyear()); }
     
     /**
      * Get the day of year property which provides access to advanced functionality.
      *
      * @return the day of year property
      */
-    Property *dayOfYear() { return new Property(this, getChronology()->dayOfYear()); }
+    Property dayOfYear() { return Property(this, getChronology()->dayOfYear()); }
     
     /**
      * Get the day of month property which provides access to advanced functionality.
      *
      * @return the day of month property
      */
-    Property *dayOfMonth() { return new Property(this, getChronology()->dayOfMonth()); }
+    Property dayOfMonth() { return Property(this, getChronology()->dayOfMonth()); }
     
     /**
      * Get the day of week property which provides access to advanced functionality.
      *
      * @return the day of week property
      */
-    Property *dayOfWeek() { return new Property(this, getChronology()->dayOfWeek()); }
+    Property dayOfWeek() { return Property(this, getChronology()->dayOfWeek()); }
     
     //-----------------------------------------------------------------------
     /**
@@ -1012,35 +1017,35 @@ public:
      *
      * @return the hour of day property
      */
-    Property *hourOfDay() { return new Property(this, getChronology()->hourOfDay()); }
+    Property hourOfDay() { return Property(this, getChronology()->hourOfDay()); }
     
     /**
      * Get the minute of hour field property which provides access to advanced functionality.
      *
      * @return the minute of hour property
      */
-    Property *minuteOfHour() { return new Property(this, getChronology()->minuteOfHour()); }
+    Property minuteOfHour() { return Property(this, getChronology()->minuteOfHour()); }
     
     /**
      * Get the second of minute field property which provides access to advanced functionality.
      *
      * @return the second of minute property
      */
-    Property *secondOfMinute() { return new Property(this, getChronology()->secondOfMinute()); }
+    Property secondOfMinute() { return Property(this, getChronology()->secondOfMinute()); }
     
     /**
      * Get the millis of second property which provides access to advanced functionality.
      *
      * @return the millis of second property
      */
-    Property *millisOfSecond() { return new Property(this, getChronology()->millisOfSecond()); }
+    Property millisOfSecond() { return Property(this, getChronology()->millisOfSecond()); }
     
     /**
      * Get the millis of day property which provides access to advanced functionality.
      *
      * @return the millis of day property
      */
-    Property *millisOfDay() { return new Property(this, getChronology()->millisOfDay()); }
+    Property millisOfDay() { return Property(this, getChronology()->millisOfDay()); }
     
     //-----------------------------------------------------------------------
     /**
@@ -18,7 +18,10 @@
 
 CODATIME_BEGIN
 
-const LocalTime *LocalTime::MIDNIGHT = new LocalTime(0, 0, 0, 0);
+const LocalTime *LocalTime::MIDNIGHT() {
+    static const LocalTime *const cMidnight = new LocalTime(0, 0, 0, 0);
+    return cMidnight;
+}
 
 /**
  * Obtains a {@code LocalTime} set to the current system millisecond time
@@ -195,7 +198,7 @@ LocalTime::LocalTime(int64_t instant, DateTimeZone *zone) : LocalTime(instant, I
 LocalTime::LocalTime(int64_t instant, Chronology *chronology) {
     chronology = DateTimeUtils::getChronology(chronology);
     
-    int64_t localMillis = chronology->getZone()->getMillisKeepLocal(DateTimeZone::UTC, instant);
+    int64_t localMillis = chronology->getZone()->getMillisKeepLocal(DateTimeZone::UTC(), instant);
     chronology = chronology->withUTC();
     iLocalMillis = chronology->millisOfDay()->get(localMillis);
     iChronology = chronology;
@@ -346,7 +349,7 @@ LocalTime *LocalTime::readResolve() {
     if (iChronology == NULL) {
         return new LocalTime(iLocalMillis, ISOChronology::getInstanceUTC());
     }
-    if (DateTimeZone::UTC->equals(iChronology->getZone()) == false) {
+    if (DateTimeZone::UTC()->equals(iChronology->getZone()) == false) {
         return new LocalTime(iLocalMillis, iChronology->withUTC());
     }
     return this;
@@ -465,6 +468,11 @@ bool LocalTime::isSupported(const DateTimeFieldType *type) const {
     return (isSupported(range) || range == DurationFieldType::days());
 }
 
+bool LocalTime::isTimeDurationType(const DurationFieldType *type) {
+    return type == DurationFieldType::millis() || type == DurationFieldType::seconds() ||
+    type == DurationFieldType::minutes() || type == DurationFieldType::hours();
+}
+
 /**
  * Checks if the duration type specified is supported by this
  * local time and chronology.
@@ -477,8 +485,7 @@ bool LocalTime::isSupported(const DurationFieldType *type) const {
         return false;
     }
     const DurationField *field = type->getField(getChronology());
-    bool contains = find(TIME_DURATION_TYPES.begin(), TIME_DURATION_TYPES.end(), type) != TIME_DURATION_TYPES.end();
-    if (contains || field->getUnitMillis() < getChronology()->days()->getUnitMillis()) {
+    if (isTimeDurationType(type) || field->getUnitMillis() < getChronology()->days()->getUnitMillis()) {
         return field->isSupported();
     }
     return false;
@@ -507,24 +514,14 @@ Chronology *LocalTime::getChronology() const {
 
 //-----------------------------------------------------------------------
 /**
- * Compares this ReadablePartial with another returning true if the chronology,
- * field types and values are equal.
+ * Compares this ReadablePartial with another returning true if it is also
+ * a LocalTime with an equal chronology and the same local millis.
  *
  * @param partial  an object to check against
- * @return true if fields and values are equal
+ * @return true if the class, chronology and local millis are equal
  */
 bool LocalTime::equals(const Object *partial) const {
-    // override to perform faster
-    if (this == partial) {
-        return true;
-    }
-    const LocalTime *other = dynamic_cast<const LocalTime*>(partial);
-    if (other != 0) {
-        if (iChronology->equals(other->iChronology)) {
-            return iLocalMillis == other->iLocalMillis;
-        }
-    }
-    return AbstractPartial::equals(partial);
+    return BaseLocal::equals(partial);
 }
 
 /**
@@ -544,19 +541,7 @@ bool LocalTime::equals(const Object *partial) const {
  * @throws NullPointerException if the partial is NULL
  */
 int LocalTime::compareTo(const ReadablePartial *partial) const {
-    // override to perform faster
-//    if (this == partial) {
-//        return 0;
-//    }
-    const LocalTime *other = dynamic_cast<const LocalTime*>(partial);
-    if (other != 0) {
-        if (iChronology->equals(other->iChronology)) {
-            return (iLocalMillis < other->iLocalMillis ? -1 :
-                    (iLocalMillis == other->iLocalMillis ? 0 : 1));
-            
-        }
-    }
-    return AbstractPartial::compareTo(partial);
+    return BaseLocal::compareTo(partial);
 }
 
 //-----------------------------------------------------------------------
@@ -922,7 +907,7 @@ LocalTime *LocalTime::minusMillis(int millis) {
  * @return the property object
  * @throws IllegalArgumentException if the field is NULL or unsupported
  */
-LocalTime::Property *LocalTime::property(DateTimeFieldType *fieldType) {
+LocalTime::Property LocalTime::property(DateTimeFieldType *fieldType) {
     if (fieldType == NULL) {
         throw IllegalArgumentException("The DateTimeFieldType *must not be NULL");
     }
@@ -932,7 +917,7 @@ LocalTime::Property *LocalTime::property(DateTimeFieldType *fieldType) {
         err.append("' is not supported");
         throw IllegalArgumentException(err);
     }
-    return new Property(this, fieldType->getField(getChronology()));
+    return Property(this, fieldType->getField(getChronology()));
 }
 
 //-----------------------------------------------------------------------
@@ -1063,8 +1048,8 @@ LocalTime *LocalTime::withMillisOfDay(int millis) {
  *
  * @return the hour of day property
  */
-LocalTime::Property *LocalTime::hourOfDay() {
-    return new Property(this, getChronology()->hourOfDay());
+LocalTime::Property LocalTime::hourOfDay() {
+    return Property(this, getChronology()->hourOfDay());
 }
 
 /**
@@ -1072,8 +1057,8 @@ LocalTime::Property *LocalTime::hourOfDay() {
  *
  * @return the minute of hour property
  */
-LocalTime::Property *LocalTime::minuteOfHour() {
-    return new Property(this, getChronology()->minuteOfHour());
+LocalTime::Property LocalTime::minuteOfHour() {
+    return Property(this, getChronology()->minuteOfHour());
 }
 
 /**
@@ -1081,8 +1066,8 @@ LocalTime::Property *LocalTime::minuteOfHour() {
  *
  * @return the second of minute property
  */
-LocalTime::Property *LocalTime::secondOfMinute() {
-    return new Property(this, getChronology()->secondOfMinute());
+LocalTime::Property LocalTime::secondOfMinute() {
+    return Property(this, getChronology()->secondOfMinute());
 }
 
 /**
@@ -1090,8 +1075,8 @@ LocalTime::Property *LocalTime::secondOfMinute() {
  *
  * @return the millis of second property
  */
-LocalTime::Property *LocalTime::millisOfSecond() {
-    return new Property(this, getChronology()->millisOfSecond());
+LocalTime::Property LocalTime::millisOfSecond() {
+    return Property(this, getChronology()->millisOfSecond());
 }
 
 /**
@@ -1099,8 +1084,8 @@ LocalTime::Property *LocalTime::millisOfSecond() {
  *
  * @return the millis of day property
  */
-LocalTime::Property *LocalTime::millisOfDay() {
-    return new Property(this, getChronology()->millisOfDay());
+LocalTime::Property LocalTime::millisOfDay() {
+    return Property(this, getChronology()->millisOfDay());
 }
 
 //-----------------------------------------------------------------------
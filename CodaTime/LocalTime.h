@@ -22,7 +22,6 @@
 #include "Chronology.h"
 
 #include <string>
-#include <set>
 
 using namespace std;
 
@@ -82,20 +81,8 @@ private:
     static const int SECOND_OF_MINUTE = 2;
     /** The index of the millisOfSecond field in the field array */
     static const int MILLIS_OF_SECOND = 3;
-    /** Set of known duration types. */
-    static set<DurationFieldType*> TIME_DURATION_TYPES;
-    
-    struct StaticBlock {
-        StaticBlock() {
-            // TODO: uncomment
-//            TIME_DURATION_TYPES.insert(DurationFieldType::millis());
-//            TIME_DURATION_TYPES.insert(DurationFieldType::seconds());
-//            TIME_DURATION_TYPES.insert(DurationFieldType::minutes());
-//            TIME_DURATION_TYPES.insert(DurationFieldType::hours());
-        }
-    };
-    
-    static StaticBlock staticBlock;
+    /** Checks for one of the known time duration types. */
+    static bool isTimeDurationType(const DurationFieldType *type);
     
     /** The local millis from 1970-01-01T00:00:00 */
     int64_t iLocalMillis;
@@ -115,7 +102,7 @@ public:
     
     const DateTimeFieldType *getFieldType(int index) const { return AbstractPartial::getFieldType(index); }
     
-    int hashCode() { return AbstractPartial::hashCode(); }
+    int hashCode() { return BaseLocal::hashCode(); }
     
     /**
      * LocalTime.Property binds a LocalTime to a DateTimeField *allowing
@@ -136,6 +123,10 @@ public:
      * LocalTime dt1430 = dt1230.hourOfDay().setCopy(14);
      * </pre>
      * <p>
+     * A property only holds a pointer to the LocalTime and to the field, and
+     * is returned by value, so that obtaining and using one does not allocate.
+     * It must not be used after the LocalTime it came from is deleted.
+     * <p>
      * LocalTime.Property itself is thread-safe and immutable, as well as the
      * LocalTime being operated on.
      *
@@ -415,8 +406,8 @@ public:
         }
     };
     
-    /** Constant for midnight. */
-    static const LocalTime *MIDNIGHT;
+    /** Gets the constant for midnight, created on first use and never destroyed. */
+    static const LocalTime *MIDNIGHT();
     
     static LocalTime *now();
     static LocalTime *now(DateTimeZone *zone);
@@ -457,6 +448,7 @@ public:
     bool isSupported(const DateTimeFieldType *type) const;
     bool isSupported(const DurationFieldType *type) const;
     Chronology *getChronology() const;
+    const BaseLocal *getBaseLocal() const { return this; }
     bool equals(const Object *partial) const;
     int compareTo(const ReadablePartial *partial) const;
     
@@ -477,7 +469,7 @@ public:
     LocalTime *minusSeconds(int seconds);
     LocalTime *minusMillis(int millis);
     
-    Property *property(DateTimeFieldType *fieldType);
+    Property property(DateTimeFieldType *fieldType);
     
     int getHourOfDay();
     int getMinuteOfHour();
@@ -491,11 +483,11 @@ public:
     LocalTime *withMillisOfSecond(int millis);
     LocalTime *withMillisOfDay(int millis);
     
-    Property *hourOfDay();
-    Property *minuteOfHour();
-    Property *secondOfMinute();
-    Property *millisOfSecond();
-    Property *millisOfDay();
+    Property hourOfDay();
+    Property minuteOfHour();
+    Property secondOfMinute();
+    Property millisOfSecond();
+    Property millisOfDay();
     
     DateTime *toDateTime(ReadableInstant *baseInstant) { return AbstractPartial::toDateTime(baseInstant); }
     DateTime *toDateTimeToday();
@@ -0,0 +1,133 @@
+//
+//  Minutes.cpp
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#include "Minutes.h"
+
+#include "DateTimeConstants.h"
+#include "Days.h"
+#include "Duration.h"
+#include "DurationFieldType.h"
+#include "Hours.h"
+#include "Period.h"
+#include "PeriodType.h"
+#include "Seconds.h"
+#include "Weeks.h"
+#include "field/FieldUtils.h"
+
+#include <climits>
+
+CODATIME_BEGIN
+
+const Minutes Minutes::ZERO = Minutes(0);
+const Minutes Minutes::ONE = Minutes(1);
+const Minutes Minutes::TWO = Minutes(2);
+const Minutes Minutes::THREE = Minutes(3);
+const Minutes Minutes::MAX_VALUE = Minutes(INT_MAX);
+const Minutes Minutes::MIN_VALUE = Minutes(INT_MIN);
+
+//-----------------------------------------------------------------------
+Minutes Minutes::minutesBetween(ReadableInstant *start, ReadableInstant *end) {
+    return Minutes(BaseSingleFieldPeriod::between(start, end, DurationFieldType::minutes()));
+}
+
+Minutes Minutes::minutesBetween(ReadablePartial *start, ReadablePartial *end) {
+    return Minutes(BaseSingleFieldPeriod::between(start, end, DurationFieldType::minutes()));
+}
+
+Minutes Minutes::minutesIn(ReadableInterval *interval) {
+    return Minutes(BaseSingleFieldPeriod::between(interval, DurationFieldType::minutes()));
+}
+
+Minutes Minutes::standardMinutesIn(ReadablePeriod *period) {
+    return Minutes(BaseSingleFieldPeriod::standardPeriodIn(period, DateTimeConstants::MILLIS_PER_MINUTE));
+}
+
+//-----------------------------------------------------------------------
+const DurationFieldType *Minutes::getFieldType() const {
+    return DurationFieldType::minutes();
+}
+
+PeriodType *Minutes::getPeriodType() const {
+    return PeriodType::minutes();
+}
+
+//-----------------------------------------------------------------------
+Weeks Minutes::toStandardWeeks() const {
+    return Weeks::weeks(getValue() / DateTimeConstants::MINUTES_PER_WEEK);
+}
+
+Days Minutes::toStandardDays() const {
+    return Days::days(getValue() / DateTimeConstants::MINUTES_PER_DAY);
+}
+
+Hours Minutes::toStandardHours() const {
+    return Hours::hours(getValue() / DateTimeConstants::MINUTES_PER_HOUR);
+}
+
+Seconds Minutes::toStandardSeconds() const {
+    return Seconds::seconds(FieldUtils::safeMultiply(getValue(), DateTimeConstants::SECONDS_PER_MINUTE));
+}
+
+Duration *Minutes::toStandardDuration() const {
+    int64_t minutes = getValue();  // assign to a int64_t
+    return new Duration(minutes * DateTimeConstants::MILLIS_PER_MINUTE);
+}
+
+Period *Minutes::toPeriod() const {
+    return Period::minutes(getValue());
+}
+
+//-----------------------------------------------------------------------
+Minutes Minutes::plus(int minutes) const {
+    if (minutes == 0) {
+        return *this;
+    }
+    return Minutes::minutes(FieldUtils::safeAdd(getValue(), minutes));
+}
+
+Minutes Minutes::plus(const Minutes &minutes) const {
+    return plus(minutes.getValue());
+}
+
+Minutes Minutes::minus(int minutes) const {
+    return plus(FieldUtils::safeNegate(minutes));
+}
+
+Minutes Minutes::minus(const Minutes &minutes) const {
+    return minus(minutes.getValue());
+}
+
+//-----------------------------------------------------------------------
+Minutes Minutes::multipliedBy(int scalar) const {
+    return Minutes::minutes(multipliedValue(scalar));
+}
+
+Minutes Minutes::dividedBy(int divisor) const {
+    if (divisor == 1) {
+        return *this;
+    }
+    return Minutes::minutes(dividedValue(divisor));
+}
+
+Minutes Minutes::negated() const {
+    return Minutes::minutes(FieldUtils::safeNegate(getValue()));
+}
+
+int Minutes::hashCode() const {
+    int total = 17;
+    total = 27 * total + getValue();
+    total = 27 * total + getFieldType()->hashCode();
+    return total;
+}
+
+//-----------------------------------------------------------------------
+string Minutes::toString() const {
+    return BaseSingleFieldPeriod::toString("PT", 'M');
+}
+
+CODATIME_END
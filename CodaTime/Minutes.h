@@ -0,0 +1,348 @@
+//
+//  Minutes.h
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#ifndef __CodaTime__Minutes__
+#define __CodaTime__Minutes__
+
+#include "CodaTimeMacros.h"
+
+#include "base/BaseSingleFieldPeriod.h"
+
+#include <string>
+
+using namespace std;
+
+CODATIME_BEGIN
+
+class Days;
+class Duration;
+class DurationFieldType;
+class Hours;
+class Period;
+class PeriodType;
+class ReadableInstant;
+class ReadableInterval;
+class ReadablePartial;
+class ReadablePeriod;
+class Seconds;
+class Weeks;
+
+/**
+ * An immutable time period representing a number of minutes.
+ * <p>
+ * <code>Minutes</code> is an immutable period that can only store minutes.
+ * It does not store years, months or hours for example. As such it is a
+ * type-safe way of representing a number of minutes in an application.
+ * <p>
+ * The number of minutes is set in the constructor, and may be queried using
+ * <code>getMinutes()</code>. Basic mathematical operations are provided -
+ * <code>plus()</code>, <code>minus()</code>, <code>multipliedBy()</code> and
+ * <code>dividedBy()</code>.
+ * <p>
+ * <code>Minutes</code> is a value type holding a single int. It should be passed
+ * and returned by value rather than allocated.
+ * <p>
+ * Minutes is thread-safe and immutable.
+ *
+ * @author Stephen Colebourne
+ * @since 1.4
+ */
+class Minutes : public BaseSingleFieldPeriod {
+    
+public:
+    
+    /** Constant representing zero minutes. */
+    static const Minutes ZERO;
+    /** Constant representing one minute. */
+    static const Minutes ONE;
+    /** Constant representing two minutes. */
+    static const Minutes TWO;
+    /** Constant representing three minutes. */
+    static const Minutes THREE;
+    /** Constant representing the maximum number of minutes that can be stored in this object. */
+    static const Minutes MAX_VALUE;
+    /** Constant representing the minimum number of minutes that can be stored in this object. */
+    static const Minutes MIN_VALUE;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Creates a new instance representing the specified number of minutes.
+     *
+     * @param minutes  the number of minutes to represent
+     */
+    constexpr Minutes(int minutes) : BaseSingleFieldPeriod(minutes) {
+    }
+    
+    /**
+     * Obtains an instance of <code>Minutes</code>.
+     *
+     * @param minutes  the number of minutes to obtain an instance for
+     * @return the instance of Minutes
+     */
+    static constexpr Minutes minutes(int minutes) {
+        return Minutes(minutes);
+    }
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Creates a <code>Minutes</code> representing the number of whole minutes
+     * between the two specified datetimes. This method correctly handles
+     * any daylight savings time changes that may occur during the interval.
+     * <p>
+     * The difference is read directly from the minutes field of the start's
+     * chronology, no intermediate <code>Period</code> is created.
+     *
+     * @param start  the start instant, must not be null
+     * @param end  the end instant, must not be null
+     * @return the period in minutes
+     * @throws IllegalArgumentException if the instants are null or invalid
+     */
+    static Minutes minutesBetween(ReadableInstant *start, ReadableInstant *end);
+    
+    /**
+     * Creates a <code>Minutes</code> representing the number of whole minutes
+     * between the two specified partial datetimes.
+     * <p>
+     * The two partials must contain the same fields, for example you can specify
+     * two <code>LocalDate</code> objects.
+     *
+     * @param start  the start partial date, must not be null
+     * @param end  the end partial date, must not be null
+     * @return the period in minutes
+     * @throws IllegalArgumentException if the partials are null or invalid
+     */
+    static Minutes minutesBetween(ReadablePartial *start, ReadablePartial *end);
+    
+    /**
+     * Creates a <code>Minutes</code> representing the number of whole minutes
+     * in the specified interval.
+     *
+     * @param interval  the interval to extract minutes from, null returns zero
+     * @return the period in minutes
+     * @throws IllegalArgumentException if the partials are null or invalid
+     */
+    static Minutes minutesIn(ReadableInterval *interval);
+    
+    /**
+     * Creates a new <code>Minutes</code> representing the number of complete
+     * standard length minutes in the specified period.
+     * <p>
+     * This factory method converts all fields from the period to minutes using standardised
+     * durations for each field. Only those fields which have a precise duration in
+     * the ISO UTC chronology can be converted.
+     *
+     * @param period  the period to get the number of minutes from, null returns zero
+     * @return the period in minutes
+     * @throws IllegalArgumentException if the period contains imprecise duration values
+     */
+    static Minutes standardMinutesIn(ReadablePeriod *period);
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Gets the duration field type, which is <code>minutes</code>.
+     *
+     * @return the period type
+     */
+    const DurationFieldType *getFieldType() const;
+    
+    /**
+     * Gets the period type, which is <code>minutes</code>.
+     *
+     * @return the period type
+     */
+    PeriodType *getPeriodType() const;
+    
+    /**
+     * Gets the number of minutes that this period represents.
+     *
+     * @return the number of minutes in the period
+     */
+    constexpr int getMinutes() const {
+        return getValue();
+    }
+    
+    /**
+     * Converts this period in minutes to a period in weeks assuming a
+     * minutes per week standard.
+     * <p>
+     * The result is the number of whole weeks, truncated towards zero.
+     *
+     * @return a period representing the number of whole weeks for this number of minutes
+     */
+    Weeks toStandardWeeks() const;
+    
+    /**
+     * Converts this period in minutes to a period in days assuming a
+     * minutes per day standard.
+     * <p>
+     * The result is the number of whole days, truncated towards zero.
+     *
+     * @return a period representing the number of whole days for this number of minutes
+     */
+    Days toStandardDays() const;
+    
+    /**
+     * Converts this period in minutes to a period in hours assuming a
+     * minutes per hour standard.
+     * <p>
+     * The result is the number of whole hours, truncated towards zero.
+     *
+     * @return a period representing the number of whole hours for this number of minutes
+     */
+    Hours toStandardHours() const;
+    
+    /**
+     * Converts this period in minutes to a period in seconds assuming a
+     * seconds per minute standard.
+     *
+     * @return a period representing the number of seconds for this number of minutes
+     * @throws ArithmeticException if the number of seconds is too large to be represented
+     */
+    Seconds toStandardSeconds() const;
+    
+    /**
+     * Converts this period in minutes to a duration in milliseconds assuming a
+     * millis per minute standard.
+     *
+     * @return a duration equivalent to this number of minutes
+     */
+    Duration *toStandardDuration() const;
+    
+    /**
+     * Converts this period to a <code>Period</code> with the standard period type.
+     *
+     * @return a period representing the same number of minutes
+     */
+    Period *toPeriod() const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Returns a new instance with the specified number of minutes added.
+     *
+     * @param minutes  the amount of minutes to add, may be negative
+     * @return the new period plus the specified number of minutes
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Minutes plus(int minutes) const;
+    
+    /**
+     * Returns a new instance with the specified number of minutes added.
+     *
+     * @param minutes  the amount of minutes to add, may be negative
+     * @return the new period plus the specified number of minutes
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Minutes plus(const Minutes &minutes) const;
+    
+    /**
+     * Returns a new instance with the specified number of minutes taken away.
+     *
+     * @param minutes  the amount of minutes to take away, may be negative
+     * @return the new period minus the specified number of minutes
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Minutes minus(int minutes) const;
+    
+    /**
+     * Returns a new instance with the specified number of minutes taken away.
+     *
+     * @param minutes  the amount of minutes to take away, may be negative
+     * @return the new period minus the specified number of minutes
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Minutes minus(const Minutes &minutes) const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Returns a new instance with the minutes multiplied by the specified scalar.
+     *
+     * @param scalar  the amount to multiply by, may be negative
+     * @return the new period multiplied by the specified scalar
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Minutes multipliedBy(int scalar) const;
+    
+    /**
+     * Returns a new instance with the minutes divided by the specified divisor.
+     * The calculation uses integer division, thus 3 divided by 2 is 1.
+     *
+     * @param divisor  the amount to divide by, may be negative
+     * @return the new period divided by the specified divisor
+     * @throws ArithmeticException if the divisor is zero
+     */
+    Minutes dividedBy(int divisor) const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Returns a new instance with the minutes value negated.
+     *
+     * @return the new period with a negated value
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Minutes negated() const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Is this minutes instance greater than the specified number of minutes.
+     *
+     * @param other  the other period
+     * @return true if this minutes instance is greater than the specified one
+     */
+    constexpr bool isGreaterThan(const Minutes &other) const {
+        return getValue() > other.getValue();
+    }
+    
+    /**
+     * Is this minutes instance less than the specified number of minutes.
+     *
+     * @param other  the other period
+     * @return true if this minutes instance is less than the specified one
+     */
+    constexpr bool isLessThan(const Minutes &other) const {
+        return getValue() < other.getValue();
+    }
+    
+    /**
+     * Compares this period to another of the same type.
+     *
+     * @param other  the other period
+     * @return negative if this is less, zero if equal, positive if greater
+     */
+    constexpr int compareTo(const Minutes &other) const {
+        return (getValue() > other.getValue() ? 1 : (getValue() < other.getValue() ? -1 : 0));
+    }
+    
+    constexpr bool equals(const Minutes &other) const {
+        return getValue() == other.getValue();
+    }
+    
+    constexpr bool operator==(const Minutes &other) const {
+        return getValue() == other.getValue();
+    }
+    
+    constexpr bool operator!=(const Minutes &other) const {
+        return getValue() != other.getValue();
+    }
+    
+    int hashCode() const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Gets this instance as a string in the ISO8601 duration format.
+     * <p>
+     * For example, "PT4M" represents 4 minutes.
+     *
+     * @return the value as an ISO8601 string
+     */
+    string toString() const;
+    
+};
+
+CODATIME_END
+
+#endif /* defined(__CodaTime__Minutes__) */
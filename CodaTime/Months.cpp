@@ -0,0 +1,111 @@
+//
+//  Months.cpp
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#include "Months.h"
+
+#include "DateTimeConstants.h"
+#include "DurationFieldType.h"
+#include "Period.h"
+#include "PeriodType.h"
+#include "field/FieldUtils.h"
+
+#include <climits>
+
+CODATIME_BEGIN
+
+const Months Months::ZERO = Months(0);
+const Months Months::ONE = Months(1);
+const Months Months::TWO = Months(2);
+const Months Months::THREE = Months(3);
+const Months Months::FOUR = Months(4);
+const Months Months::FIVE = Months(5);
+const Months Months::SIX = Months(6);
+const Months Months::SEVEN = Months(7);
+const Months Months::EIGHT = Months(8);
+const Months Months::NINE = Months(9);
+const Months Months::TEN = Months(10);
+const Months Months::ELEVEN = Months(11);
+const Months Months::TWELVE = Months(12);
+const Months Months::MAX_VALUE = Months(INT_MAX);
+const Months Months::MIN_VALUE = Months(INT_MIN);
+
+//-----------------------------------------------------------------------
+Months Months::monthsBetween(ReadableInstant *start, ReadableInstant *end) {
+    return Months(BaseSingleFieldPeriod::between(start, end, DurationFieldType::months()));
+}
+
+Months Months::monthsBetween(ReadablePartial *start, ReadablePartial *end) {
+    return Months(BaseSingleFieldPeriod::between(start, end, DurationFieldType::months()));
+}
+
+Months Months::monthsIn(ReadableInterval *interval) {
+    return Months(BaseSingleFieldPeriod::between(interval, DurationFieldType::months()));
+}
+
+//-----------------------------------------------------------------------
+const DurationFieldType *Months::getFieldType() const {
+    return DurationFieldType::months();
+}
+
+PeriodType *Months::getPeriodType() const {
+    return PeriodType::months();
+}
+
+Period *Months::toPeriod() const {
+    return Period::months(getValue());
+}
+
+//-----------------------------------------------------------------------
+Months Months::plus(int months) const {
+    if (months == 0) {
+        return *this;
+    }
+    return Months::months(FieldUtils::safeAdd(getValue(), months));
+}
+
+Months Months::plus(const Months &months) const {
+    return plus(months.getValue());
+}
+
+Months Months::minus(int months) const {
+    return plus(FieldUtils::safeNegate(months));
+}
+
+Months Months::minus(const Months &months) const {
+    return minus(months.getValue());
+}
+
+//-----------------------------------------------------------------------
+Months Months::multipliedBy(int scalar) const {
+    return Months::months(multipliedValue(scalar));
+}
+
+Months Months::dividedBy(int divisor) const {
+    if (divisor == 1) {
+        return *this;
+    }
+    return Months::months(dividedValue(divisor));
+}
+
+Months Months::negated() const {
+    return Months::months(FieldUtils::safeNegate(getValue()));
+}
+
+int Months::hashCode() const {
+    int total = 17;
+    total = 27 * total + getValue();
+    total = 27 * total + getFieldType()->hashCode();
+    return total;
+}
+
+//-----------------------------------------------------------------------
+string Months::toString() const {
+    return BaseSingleFieldPeriod::toString("P", 'M');
+}
+
+CODATIME_END
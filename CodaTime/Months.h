@@ -0,0 +1,299 @@
+//
+//  Months.h
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#ifndef __CodaTime__Months__
+#define __CodaTime__Months__
+
+#include "CodaTimeMacros.h"
+
+#include "base/BaseSingleFieldPeriod.h"
+
+#include <string>
+
+using namespace std;
+
+CODATIME_BEGIN
+
+class DurationFieldType;
+class Period;
+class PeriodType;
+class ReadableInstant;
+class ReadableInterval;
+class ReadablePartial;
+
+/**
+ * An immutable time period representing a number of months.
+ * <p>
+ * <code>Months</code> is an immutable period that can only store months.
+ * It does not store years, months or hours for example. As such it is a
+ * type-safe way of representing a number of months in an application.
+ * <p>
+ * The number of months is set in the constructor, and may be queried using
+ * <code>getMonths()</code>. Basic mathematical operations are provided -
+ * <code>plus()</code>, <code>minus()</code>, <code>multipliedBy()</code> and
+ * <code>dividedBy()</code>.
+ * <p>
+ * <code>Months</code> is a value type holding a single int. It should be passed
+ * and returned by value rather than allocated.
+ * <p>
+ * Months is thread-safe and immutable.
+ *
+ * @author Stephen Colebourne
+ * @since 1.4
+ */
+class Months : public BaseSingleFieldPeriod {
+    
+public:
+    
+    /** Constant representing zero months. */
+    static const Months ZERO;
+    /** Constant representing one month. */
+    static const Months ONE;
+    /** Constant representing two months. */
+    static const Months TWO;
+    /** Constant representing three months. */
+    static const Months THREE;
+    /** Constant representing four months. */
+    static const Months FOUR;
+    /** Constant representing five months. */
+    static const Months FIVE;
+    /** Constant representing six months. */
+    static const Months SIX;
+    /** Constant representing seven months. */
+    static const Months SEVEN;
+    /** Constant representing eight months. */
+    static const Months EIGHT;
+    /** Constant representing nine months. */
+    static const Months NINE;
+    /** Constant representing ten months. */
+    static const Months TEN;
+    /** Constant representing eleven months. */
+    static const Months ELEVEN;
+    /** Constant representing twelve months. */
+    static const Months TWELVE;
+    /** Constant representing the maximum number of months that can be stored in this object. */
+    static const Months MAX_VALUE;
+    /** Constant representing the minimum number of months that can be stored in this object. */
+    static const Months MIN_VALUE;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Creates a new instance representing the specified number of months.
+     *
+     * @param months  the number of months to represent
+     */
+    constexpr Months(int months) : BaseSingleFieldPeriod(months) {
+    }
+    
+    /**
+     * Obtains an instance of <code>Months</code>.
+     *
+     * @param months  the number of months to obtain an instance for
+     * @return the instance of Months
+     */
+    static constexpr Months months(int months) {
+        return Months(months);
+    }
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Creates a <code>Months</code> representing the number of whole months
+     * between the two specified datetimes. This method correctly handles
+     * any daylight savings time changes that may occur during the interval.
+     * <p>
+     * The difference is read directly from the months field of the start's
+     * chronology, no intermediate <code>Period</code> is created.
+     *
+     * @param start  the start instant, must not be null
+     * @param end  the end instant, must not be null
+     * @return the period in months
+     * @throws IllegalArgumentException if the instants are null or invalid
+     */
+    static Months monthsBetween(ReadableInstant *start, ReadableInstant *end);
+    
+    /**
+     * Creates a <code>Months</code> representing the number of whole months
+     * between the two specified partial datetimes.
+     * <p>
+     * The two partials must contain the same fields, for example you can specify
+     * two <code>LocalDate</code> objects.
+     *
+     * @param start  the start partial date, must not be null
+     * @param end  the end partial date, must not be null
+     * @return the period in months
+     * @throws IllegalArgumentException if the partials are null or invalid
+     */
+    static Months monthsBetween(ReadablePartial *start, ReadablePartial *end);
+    
+    /**
+     * Creates a <code>Months</code> representing the number of whole months
+     * in the specified interval.
+     *
+     * @param interval  the interval to extract months from, null returns zero
+     * @return the period in months
+     * @throws IllegalArgumentException if the partials are null or invalid
+     */
+    static Months monthsIn(ReadableInterval *interval);
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Gets the duration field type, which is <code>months</code>.
+     *
+     * @return the period type
+     */
+    const DurationFieldType *getFieldType() const;
+    
+    /**
+     * Gets the period type, which is <code>months</code>.
+     *
+     * @return the period type
+     */
+    PeriodType *getPeriodType() const;
+    
+    /**
+     * Gets the number of months that this period represents.
+     *
+     * @return the number of months in the period
+     */
+    constexpr int getMonths() const {
+        return getValue();
+    }
+    
+    /**
+     * Converts this period to a <code>Period</code> with the standard period type.
+     *
+     * @return a period representing the same number of months
+     */
+    Period *toPeriod() const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Returns a new instance with the specified number of months added.
+     *
+     * @param months  the amount of months to add, may be negative
+     * @return the new period plus the specified number of months
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Months plus(int months) const;
+    
+    /**
+     * Returns a new instance with the specified number of months added.
+     *
+     * @param months  the amount of months to add, may be negative
+     * @return the new period plus the specified number of months
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Months plus(const Months &months) const;
+    
+    /**
+     * Returns a new instance with the specified number of months taken away.
+     *
+     * @param months  the amount of months to take away, may be negative
+     * @return the new period minus the specified number of months
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Months minus(int months) const;
+    
+    /**
+     * Returns a new instance with the specified number of months taken away.
+     *
+     * @param months  the amount of months to take away, may be negative
+     * @return the new period minus the specified number of months
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Months minus(const Months &months) const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Returns a new instance with the months multiplied by the specified scalar.
+     *
+     * @param scalar  the amount to multiply by, may be negative
+     * @return the new period multiplied by the specified scalar
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Months multipliedBy(int scalar) const;
+    
+    /**
+     * Returns a new instance with the months divided by the specified divisor.
+     * The calculation uses integer division, thus 3 divided by 2 is 1.
+     *
+     * @param divisor  the amount to divide by, may be negative
+     * @return the new period divided by the specified divisor
+     * @throws ArithmeticException if the divisor is zero
+     */
+    Months dividedBy(int divisor) const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Returns a new instance with the months value negated.
+     *
+     * @return the new period with a negated value
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Months negated() const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Is this months instance greater than the specified number of months.
+     *
+     * @param other  the other period
+     * @return true if this months instance is greater than the specified one
+     */
+    constexpr bool isGreaterThan(const Months &other) const {
+        return getValue() > other.getValue();
+    }
+    
+    /**
+     * Is this months instance less than the specified number of months.
+     *
+     * @param other  the other period
+     * @return true if this months instance is less than the specified one
+     */
+    constexpr bool isLessThan(const Months &other) const {
+        return getValue() < other.getValue();
+    }
+    
+    /**
+     * Compares this period to another of the same type.
+     *
+     * @param other  the other period
+     * @return negative if this is less, zero if equal, positive if greater
+     */
+    constexpr int compareTo(const Months &other) const {
+        return (getValue() > other.getValue() ? 1 : (getValue() < other.getValue() ? -1 : 0));
+    }
+    
+    constexpr bool equals(const Months &other) const {
+        return getValue() == other.getValue();
+    }
+    
+    constexpr bool operator==(const Months &other) const {
+        return getValue() == other.getValue();
+    }
+    
+    constexpr bool operator!=(const Months &other) const {
+        return getValue() != other.getValue();
+    }
+    
+    int hashCode() const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Gets this instance as a string in the ISO8601 duration format.
+     * <p>
+     * For example, "P4M" represents 4 months.
+     *
+     * @return the value as an ISO8601 string
+     */
+    string toString() const;
+    
+};
+
+CODATIME_END
+
+#endif /* defined(__CodaTime__Months__) */
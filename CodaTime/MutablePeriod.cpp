@@ -30,9 +30,9 @@ MutablePeriod *MutablePeriod::parse(string str, PeriodFormatter *formatter) {
 }
 
 //-----------------------------------------------------------------------
-MutablePeriod::MutablePeriod() : BasePeriod(0LL, (PeriodType*) NULL, (Chronology*) NULL) {}
+MutablePeriod::MutablePeriod() : BasePeriod((int64_t) 0, (PeriodType*) NULL, (Chronology*) NULL) {}
 
-MutablePeriod::MutablePeriod(const PeriodType *type) : BasePeriod(0LL, type, NULL) {}
+MutablePeriod::MutablePeriod(const PeriodType *type) : BasePeriod((int64_t) 0, type, NULL) {}
 
 MutablePeriod::MutablePeriod(int hours, int minutes, int seconds, int millis) : BasePeriod(0, 0, 0, 0, hours, minutes, seconds, millis, PeriodType::standard()) {}
 
@@ -80,7 +80,7 @@ MutablePeriod::MutablePeriod(Object *period, const PeriodType *type, Chronology
 
 //-----------------------------------------------------------------------
 void MutablePeriod::clear() {
-    BasePeriod::setValues(vector<int>(size()));
+    BasePeriod::setValues(PeriodType::Values());
 }
 
 void MutablePeriod::setValue(int index, int value) {
@@ -100,6 +100,10 @@ void MutablePeriod::setPeriod(int years, int months, int weeks, int days,
     BasePeriod::setPeriod(years, months, weeks, days, hours, minutes, seconds, millis);
 }
 
+void MutablePeriod::setFields(const PeriodType::Values &values, int fieldMask) {
+    BasePeriod::setFields(values, fieldMask);
+}
+
 void MutablePeriod::setPeriod(ReadableInterval *interval) {
     if (interval == NULL) {
         setPeriod((int64_t) 0);
@@ -158,35 +162,43 @@ void MutablePeriod::add(ReadablePeriod *period) {
 
 void MutablePeriod::add(int years, int months, int weeks, int days,
                 int hours, int minutes, int seconds, int millis) {
-    setPeriod(FieldUtils::safeAdd(getYears(), years),
-              FieldUtils::safeAdd(getMonths(), months),
-              FieldUtils::safeAdd(getWeeks(), weeks),
-              FieldUtils::safeAdd(getDays(), days),
-              FieldUtils::safeAdd(getHours(), hours),
-              FieldUtils::safeAdd(getMinutes(), minutes),
-              FieldUtils::safeAdd(getSeconds(), seconds),
-              FieldUtils::safeAdd(getMillis(), millis)
-              );
+    PeriodType::Values values = {{ years, months, weeks, days, hours, minutes, seconds, millis }};
+    BasePeriod::addFields(values, PeriodType::STANDARD_MASK);
 }
 
 void MutablePeriod::add(ReadableInterval *interval) {
     if (interval != NULL) {
-        add(interval->toPeriod(getPeriodType()));
+        Chronology *chrono = DateTimeUtils::getChronology(interval->getChronology());
+        add(interval->getStartMillis(), interval->getEndMillis(), chrono);
+    }
+}
+
+void MutablePeriod::add(int64_t startInstant, int64_t endInstant) {
+    add(startInstant, endInstant, NULL);
+}
+
+void MutablePeriod::add(int64_t startInstant, int64_t endInstant, Chronology *chrono) {
+    if (startInstant != endInstant) {
+        chrono = DateTimeUtils::getChronology(chrono);
+        BasePeriod::addValues(chrono->get(this, startInstant, endInstant));
     }
 }
 
 void MutablePeriod::add(ReadableDuration *duration) {
     if (duration != NULL) {
-        add(new Period(duration->getMillis(), getPeriodType()));
+        add(duration->getMillis());
     }
 }
 
 void MutablePeriod::add(int64_t duration) {
-    add(new Period(duration, getPeriodType()));
+    add(duration, (Chronology*) NULL);
 }
 
 void MutablePeriod::add(int64_t duration, Chronology *chrono) {
-    add(new Period(duration, getPeriodType(), chrono));
+    if (duration != 0) {
+        chrono = DateTimeUtils::getChronology(chrono);
+        BasePeriod::addValues(chrono->get(this, duration));
+    }
 }
 
 //-----------------------------------------------------------------------
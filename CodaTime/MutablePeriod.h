@@ -432,6 +432,18 @@ public:
     void setPeriod(int years, int months, int weeks, int days,
                           int hours, int minutes, int seconds, int millis);
     
+    /**
+     * Sets some of the standard fields in one go, leaving the others unchanged.
+     * <p>
+     * This writes straight into the value array, and is used by parsers which
+     * have already read all the fields.
+     *
+     * @param values  the values in standard order, years first
+     * @param fieldMask  the fields to set, bit i set for standard field i
+     * @throws IllegalArgumentException if an unsupported field's value is non-zero
+     */
+    void setFields(const PeriodType::Values &values, int fieldMask);
+    
     /**
      * Sets all the fields in one go from an interval using the ISO chronology
      * and dividing the fields using the period type.
@@ -575,6 +587,34 @@ public:
      */
     void add(ReadableInterval *interval);
     
+    /**
+     * Adds the interval between two millisecond instants to this one using
+     * the ISO chronology in the default zone.
+     * <p>
+     * The interval is divided into the fields of this period's type and each
+     * is added in place. No Period or Interval is created, so this is suitable
+     * for accumulating many intervals in a loop.
+     *
+     * @param startInstant  interval start, in milliseconds
+     * @param endInstant  interval end, in milliseconds
+     * @throws ArithmeticException if the addition exceeds the capacity of the period
+     */
+    void add(int64_t startInstant, int64_t endInstant);
+    
+    /**
+     * Adds the interval between two millisecond instants to this one.
+     * <p>
+     * The interval is divided into the fields of this period's type and each
+     * is added in place. No Period or Interval is created, so this is suitable
+     * for accumulating many intervals in a loop.
+     *
+     * @param startInstant  interval start, in milliseconds
+     * @param endInstant  interval end, in milliseconds
+     * @param chrono  the chronology to use, null means ISO default
+     * @throws ArithmeticException if the addition exceeds the capacity of the period
+     */
+    void add(int64_t startInstant, int64_t endInstant, Chronology *chrono);
+    
     /**
      * Adds a duration to this one by dividing the duration into
      * fields and calling {@link #add(ReadablePeriod)}.
@@ -832,14 +872,14 @@ public:
      * @return a clone of the this object.
      */
 //    MutablePeriod *copy();
-
+    
     /**
      * Clone this object.
      *
      * @return a clone of this object.
      */
 //    Object *clone(); catch (CloneNotSupportedException ex);
-
+    
 };
 
 CODATIME_END
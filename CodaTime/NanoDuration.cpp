@@ -0,0 +1,101 @@
+//
+//  NanoDuration.cpp
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#include "NanoDuration.h"
+
+#include "Duration.h"
+#include "Exceptions.h"
+#include "field/FieldUtils.h"
+#include "format/FormatUtils.h"
+#include "NanoInstant.h"
+
+#include <climits>
+
+CODATIME_BEGIN
+
+const NanoDuration NanoDuration::ZERO = NanoDuration(0);
+
+NanoDuration NanoDuration::micros(int64_t micros) {
+    return NanoDuration(FieldUtils::safeMultiply(micros, 1000));
+}
+
+NanoDuration NanoDuration::millis(int64_t millis) {
+    return NanoDuration(FieldUtils::safeMultiply(millis, 1000000));
+}
+
+NanoDuration NanoDuration::seconds(int64_t seconds) {
+    return NanoDuration(FieldUtils::safeMultiply(seconds, 1000000000));
+}
+
+NanoDuration NanoDuration::between(const NanoInstant &start, const NanoInstant &end) {
+    return NanoDuration(FieldUtils::safeSubtract(end.getEpochNanos(), start.getEpochNanos()));
+}
+
+//-----------------------------------------------------------------------
+int64_t NanoDuration::getMicros() const {
+    return iNanos / 1000;
+}
+
+int64_t NanoDuration::getMillis() const {
+    return iNanos / 1000000;
+}
+
+int64_t NanoDuration::getStandardSeconds() const {
+    return iNanos / 1000000000;
+}
+
+Duration *NanoDuration::toDuration() const {
+    return new Duration(getMillis());
+}
+
+//-----------------------------------------------------------------------
+NanoDuration NanoDuration::plus(NanoDuration duration) const {
+    return NanoDuration(FieldUtils::safeAdd(iNanos, duration.iNanos));
+}
+
+NanoDuration NanoDuration::minus(NanoDuration duration) const {
+    return NanoDuration(FieldUtils::safeSubtract(iNanos, duration.iNanos));
+}
+
+NanoDuration NanoDuration::multipliedBy(int64_t scalar) const {
+    return NanoDuration(FieldUtils::safeMultiply(iNanos, scalar));
+}
+
+NanoDuration NanoDuration::dividedBy(int64_t divisor) const {
+    if (divisor == 0) {
+        throw ArithmeticException("Cannot divide a duration by zero");
+    }
+    return NanoDuration(FieldUtils::safeDivide(iNanos, divisor));
+}
+
+NanoDuration NanoDuration::negated() const {
+    if (iNanos == LLONG_MIN) {
+        throw ArithmeticException("Negation of this duration would overflow");
+    }
+    return NanoDuration(-iNanos);
+}
+
+//-----------------------------------------------------------------------
+int NanoDuration::hashCode() const {
+    return (int) (iNanos ^ ((uint64_t) iNanos >> 32));
+}
+
+string NanoDuration::toString() const {
+    string buf("PT");
+    uint64_t magnitude = (uint64_t) iNanos;
+    if (iNanos < 0) {
+        buf.append(1, '-');
+        magnitude = 0 - magnitude;
+    }
+    FormatUtils::appendUnpaddedInteger(buf, (int64_t) (magnitude / 1000000000));
+    FormatUtils::appendFractionOfSecond(buf, (int) (magnitude % 1000000000));
+    buf.append(1, 'S');
+    return buf;
+}
+
+CODATIME_END
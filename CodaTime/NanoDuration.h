@@ -0,0 +1,228 @@
+//
+//  NanoDuration.h
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#ifndef __CodaTime__NanoDuration__
+#define __CodaTime__NanoDuration__
+
+#include "CodaTimeMacros.h"
+
+#include <string>
+
+using namespace std;
+
+CODATIME_BEGIN
+
+class Duration;
+class NanoInstant;
+
+/**
+ * An immutable duration specifying a length of time in nanoseconds.
+ * <p>
+ * <code>NanoDuration</code> is the nanosecond counterpart of <code>Duration</code>,
+ * intended for measuring short spans such as request latencies. It holds a
+ * single 64 bit count of nanoseconds, which covers about 292 years either
+ * way. It should be passed and returned by value rather than allocated.
+ * <p>
+ * Conversions to coarser units truncate towards zero, as
+ * <code>Duration::getStandardSeconds</code> does.
+ * <p>
+ * NanoDuration is thread-safe and immutable.
+ */
+class NanoDuration {
+    
+private:
+    
+    /** The length of the duration in nanoseconds */
+    int64_t iNanos;
+    
+public:
+    
+    /** Constant representing zero nanoseconds. */
+    static const NanoDuration ZERO;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Creates a duration of the specified number of nanoseconds.
+     *
+     * @param nanos  the length of the duration in nanoseconds
+     */
+    constexpr NanoDuration(int64_t nanos) : iNanos(nanos) {
+    }
+    
+    /**
+     * Obtains a duration of the specified number of nanoseconds.
+     *
+     * @param nanos  the length of the duration in nanoseconds
+     * @return the duration
+     */
+    static constexpr NanoDuration nanos(int64_t nanos) {
+        return NanoDuration(nanos);
+    }
+    
+    /**
+     * Obtains a duration of the specified number of microseconds.
+     *
+     * @param micros  the length of the duration in microseconds
+     * @return the duration
+     * @throws ArithmeticException if the duration overflows
+     */
+    static NanoDuration micros(int64_t micros);
+    
+    /**
+     * Obtains a duration of the specified number of milliseconds.
+     *
+     * @param millis  the length of the duration in milliseconds
+     * @return the duration
+     * @throws ArithmeticException if the duration overflows
+     */
+    static NanoDuration millis(int64_t millis);
+    
+    /**
+     * Obtains a duration of the specified number of seconds.
+     *
+     * @param seconds  the length of the duration in seconds
+     * @return the duration
+     * @throws ArithmeticException if the duration overflows
+     */
+    static NanoDuration seconds(int64_t seconds);
+    
+    /**
+     * Obtains the duration between two instants.
+     *
+     * @param start  the start instant
+     * @param end  the end instant
+     * @return the duration, negative if the end is before the start
+     * @throws ArithmeticException if the duration overflows
+     */
+    static NanoDuration between(const NanoInstant &start, const NanoInstant &end);
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Gets the length of this duration in nanoseconds.
+     *
+     * @return the length in nanoseconds
+     */
+    constexpr int64_t getNanos() const {
+        return iNanos;
+    }
+    
+    /**
+     * Gets the length of this duration in whole microseconds.
+     *
+     * @return the length in microseconds, truncated towards zero
+     */
+    int64_t getMicros() const;
+    
+    /**
+     * Gets the length of this duration in whole milliseconds.
+     *
+     * @return the length in milliseconds, truncated towards zero
+     */
+    int64_t getMillis() const;
+    
+    /**
+     * Gets the length of this duration in whole seconds.
+     *
+     * @return the length in seconds, truncated towards zero
+     */
+    int64_t getStandardSeconds() const;
+    
+    /**
+     * Converts this duration to a millisecond <code>Duration</code>.
+     *
+     * @return the duration truncated to milliseconds, owned by the caller
+     */
+    Duration *toDuration() const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Returns a new duration with the specified duration added.
+     *
+     * @param duration  the duration to add
+     * @return the new duration
+     * @throws ArithmeticException if the result overflows
+     */
+    NanoDuration plus(NanoDuration duration) const;
+    
+    /**
+     * Returns a new duration with the specified duration subtracted.
+     *
+     * @param duration  the duration to subtract
+     * @return the new duration
+     * @throws ArithmeticException if the result overflows
+     */
+    NanoDuration minus(NanoDuration duration) const;
+    
+    /**
+     * Returns a new duration multiplied by the specified scalar.
+     *
+     * @param scalar  the amount to multiply by
+     * @return the new duration
+     * @throws ArithmeticException if the result overflows
+     */
+    NanoDuration multipliedBy(int64_t scalar) const;
+    
+    /**
+     * Returns a new duration divided by the specified divisor, truncating towards zero.
+     *
+     * @param divisor  the amount to divide by, must not be zero
+     * @return the new duration
+     * @throws ArithmeticException if the divisor is zero or the result overflows
+     */
+    NanoDuration dividedBy(int64_t divisor) const;
+    
+    /**
+     * Returns a new duration with the length negated.
+     *
+     * @return the new duration
+     * @throws ArithmeticException if the result overflows
+     */
+    NanoDuration negated() const;
+    
+    //-----------------------------------------------------------------------
+    constexpr bool operator==(const NanoDuration &other) const {
+        return iNanos == other.iNanos;
+    }
+    
+    constexpr bool operator!=(const NanoDuration &other) const {
+        return iNanos != other.iNanos;
+    }
+    
+    constexpr bool operator<(const NanoDuration &other) const {
+        return iNanos < other.iNanos;
+    }
+    
+    constexpr bool operator>(const NanoDuration &other) const {
+        return iNanos > other.iNanos;
+    }
+    
+    constexpr bool operator<=(const NanoDuration &other) const {
+        return iNanos <= other.iNanos;
+    }
+    
+    constexpr bool operator>=(const NanoDuration &other) const {
+        return iNanos >= other.iNanos;
+    }
+    
+    int hashCode() const;
+    
+    /**
+     * Gets the value as a String in the ISO8601 duration format, such as "PT0.000123S".
+     * <p>
+     * As with <code>Duration</code> only seconds are output, with three, six
+     * or nine digits of fraction as needed.
+     *
+     * @return the value as an ISO8601 string
+     */
+    string toString() const;
+    
+};
+
+CODATIME_END
+
+#endif /* defined(__CodaTime__NanoDuration__) */
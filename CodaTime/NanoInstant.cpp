@@ -0,0 +1,99 @@
+//
+//  NanoInstant.cpp
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#include "NanoInstant.h"
+
+#include "Chronology.h"
+#include "DateTimeField.h"
+#include "DateTimeFieldType.h"
+#include "DateTimeUtils.h"
+#include "Exceptions.h"
+#include "field/FieldUtils.h"
+#include "format/FormatUtils.h"
+#include "Instant.h"
+#include "PackedLocalDate.h"
+
+CODATIME_BEGIN
+
+const NanoInstant NanoInstant::EPOCH = NanoInstant(0);
+
+NanoInstant NanoInstant::now() {
+    return NanoInstant(DateTimeUtils::currentTimeNanos());
+}
+
+NanoInstant NanoInstant::ofEpochMillis(int64_t epochMillis) {
+    return NanoInstant(FieldUtils::safeMultiply(epochMillis, 1000000));
+}
+
+NanoInstant NanoInstant::fromInstant(ReadableInstant *instant) {
+    return ofEpochMillis(DateTimeUtils::getInstantMillis(instant));
+}
+
+//-----------------------------------------------------------------------
+int64_t NanoInstant::getMillis() const {
+    int64_t millis = iNanos / 1000000;
+    return (iNanos % 1000000 < 0 ? millis - 1 : millis);
+}
+
+int NanoInstant::getNanoOfSecond() const {
+    int nanos = (int) (iNanos % 1000000000);
+    return (nanos < 0 ? nanos + 1000000000 : nanos);
+}
+
+int NanoInstant::get(const DateTimeFieldType *type, Chronology *chrono) const {
+    if (type == NULL) {
+        throw IllegalArgumentException("The DateTimeFieldType must not be null");
+    }
+    return type->getField(DateTimeUtils::getChronology(chrono))->get(getMillis());
+}
+
+Instant *NanoInstant::toInstant() const {
+    return new Instant(getMillis());
+}
+
+//-----------------------------------------------------------------------
+NanoInstant NanoInstant::plus(NanoDuration duration) const {
+    return NanoInstant(FieldUtils::safeAdd(iNanos, duration.getNanos()));
+}
+
+NanoInstant NanoInstant::minus(NanoDuration duration) const {
+    return NanoInstant(FieldUtils::safeSubtract(iNanos, duration.getNanos()));
+}
+
+//-----------------------------------------------------------------------
+int NanoInstant::hashCode() const {
+    return (int) (iNanos ^ ((uint64_t) iNanos >> 32));
+}
+
+string NanoInstant::toString() const {
+    int nanoOfSecond = getNanoOfSecond();
+    int64_t epochSecond = iNanos / 1000000000 - (iNanos % 1000000000 < 0 ? 1 : 0);
+    int64_t epochDay = epochSecond / 86400;
+    int secondOfDay = (int) (epochSecond % 86400);
+    if (secondOfDay < 0) {
+        epochDay--;
+        secondOfDay += 86400;
+    }
+    
+    string buf = PackedLocalDate::fromEpochDay((int32_t) epochDay).toString();
+    buf.append(1, 'T');
+    FormatUtils::appendPaddedInteger(buf, secondOfDay / 3600, 2);
+    buf.append(1, ':');
+    FormatUtils::appendPaddedInteger(buf, secondOfDay / 60 % 60, 2);
+    buf.append(1, ':');
+    FormatUtils::appendPaddedInteger(buf, secondOfDay % 60, 2);
+    if (nanoOfSecond == 0) {
+        buf.append(".000");
+    } else {
+        FormatUtils::appendFractionOfSecond(buf, nanoOfSecond);
+    }
+    buf.append(1, 'Z');
+    return buf;
+}
+
+CODATIME_END
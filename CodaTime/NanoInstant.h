@@ -0,0 +1,192 @@
+//
+//  NanoInstant.h
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#ifndef __CodaTime__NanoInstant__
+#define __CodaTime__NanoInstant__
+
+#include "CodaTimeMacros.h"
+
+#include "NanoDuration.h"
+
+#include <string>
+
+using namespace std;
+
+CODATIME_BEGIN
+
+class Chronology;
+class DateTimeFieldType;
+class Instant;
+class ReadableInstant;
+
+/**
+ * An immutable instant on the time-line with nanosecond precision.
+ * <p>
+ * <code>NanoInstant</code> is the nanosecond counterpart of <code>Instant</code>,
+ * intended for timestamping latency spans. It holds a single 64 bit count of
+ * nanoseconds from 1970-01-01T00:00:00Z, which covers the years 1677 to 2262.
+ * It should be passed and returned by value rather than allocated.
+ * <p>
+ * Calendar fields are read through the normal chronology machinery from
+ * the instant truncated to milliseconds, see {@link #get}. The nanosecond
+ * part is available separately from {@link #getNanoOfSecond}.
+ * <p>
+ * NanoInstant is thread-safe and immutable.
+ */
+class NanoInstant {
+    
+private:
+    
+    /** The nanoseconds from 1970-01-01T00:00:00Z */
+    int64_t iNanos;
+    
+public:
+    
+    /** Constant for 1970-01-01T00:00:00Z. */
+    static const NanoInstant EPOCH;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Creates an instant from nanoseconds since the epoch.
+     *
+     * @param epochNanos  the nanoseconds from 1970-01-01T00:00:00Z
+     */
+    constexpr NanoInstant(int64_t epochNanos) : iNanos(epochNanos) {
+    }
+    
+    /**
+     * Obtains the current instant, from <code>DateTimeUtils::currentTimeNanos</code>.
+     *
+     * @return the current instant
+     */
+    static NanoInstant now();
+    
+    /**
+     * Obtains an instant from milliseconds since the epoch.
+     *
+     * @param epochMillis  the milliseconds from 1970-01-01T00:00:00Z
+     * @return the instant
+     * @throws ArithmeticException if the instant is outside the supported range
+     */
+    static NanoInstant ofEpochMillis(int64_t epochMillis);
+    
+    /**
+     * Obtains an instant from a millisecond instant.
+     *
+     * @param instant  the instant to convert, null means now
+     * @return the instant
+     * @throws ArithmeticException if the instant is outside the supported range
+     */
+    static NanoInstant fromInstant(ReadableInstant *instant);
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Gets the nanoseconds from 1970-01-01T00:00:00Z.
+     *
+     * @return the epoch nanoseconds
+     */
+    constexpr int64_t getEpochNanos() const {
+        return iNanos;
+    }
+    
+    /**
+     * Gets the milliseconds from 1970-01-01T00:00:00Z, truncated towards
+     * the past so that the result is the millisecond containing this instant.
+     *
+     * @return the epoch milliseconds
+     */
+    int64_t getMillis() const;
+    
+    /**
+     * Gets the nanosecond within the second, from 0 to 999,999,999.
+     *
+     * @return the nano of second
+     */
+    int getNanoOfSecond() const;
+    
+    /**
+     * Gets the value of a field of this instant in a chronology.
+     * <p>
+     * The field is read from the instant truncated to milliseconds, so
+     * sub-millisecond precision is ignored.
+     *
+     * @param type  the field type to get, not null
+     * @param chrono  the chronology to use, null means ISO in the default zone
+     * @return the value of the field
+     */
+    int get(const DateTimeFieldType *type, Chronology *chrono) const;
+    
+    /**
+     * Converts this instant to a millisecond <code>Instant</code>.
+     *
+     * @return the instant truncated to milliseconds, owned by the caller
+     */
+    Instant *toInstant() const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Returns a new instant with the specified duration added.
+     *
+     * @param duration  the duration to add
+     * @return the new instant
+     * @throws ArithmeticException if the result overflows
+     */
+    NanoInstant plus(NanoDuration duration) const;
+    
+    /**
+     * Returns a new instant with the specified duration subtracted.
+     *
+     * @param duration  the duration to subtract
+     * @return the new instant
+     * @throws ArithmeticException if the result overflows
+     */
+    NanoInstant minus(NanoDuration duration) const;
+    
+    //-----------------------------------------------------------------------
+    constexpr bool operator==(const NanoInstant &other) const {
+        return iNanos == other.iNanos;
+    }
+    
+    constexpr bool operator!=(const NanoInstant &other) const {
+        return iNanos != other.iNanos;
+    }
+    
+    constexpr bool operator<(const NanoInstant &other) const {
+        return iNanos < other.iNanos;
+    }
+    
+    constexpr bool operator>(const NanoInstant &other) const {
+        return iNanos > other.iNanos;
+    }
+    
+    constexpr bool operator<=(const NanoInstant &other) const {
+        return iNanos <= other.iNanos;
+    }
+    
+    constexpr bool operator>=(const NanoInstant &other) const {
+        return iNanos >= other.iNanos;
+    }
+    
+    int hashCode() const;
+    
+    /**
+     * Output the instant in ISO8601 format in UTC, such as
+     * "2013-12-20T10:15:30.123456789Z".
+     * <p>
+     * As with <code>Instant</code> milliseconds are always output, followed
+     * by the microseconds and nanoseconds only when they are not zero.
+     *
+     * @return ISO8601 date-time string
+     */
+    string toString() const;
+    
+};
+
+CODATIME_END
+
+#endif /* defined(__CodaTime__NanoInstant__) */
@@ -0,0 +1,69 @@
+//
+//  PackedLocalConversions.cpp
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+// The conversions between the packed values and LocalDateTime and LocalTime.
+// They are kept apart from the packed arithmetic, so that PackedLocalDate.cpp
+// and PackedLocalTime.cpp do not depend on the chronologies.
+
+#include "PackedLocalDate.h"
+#include "PackedLocalTime.h"
+
+#include "chrono/ISOChronology.h"
+#include "DateTimeConstants.h"
+#include "Exceptions.h"
+#include "field/FieldUtils.h"
+#include "LocalDateTime.h"
+#include "LocalTime.h"
+
+CODATIME_BEGIN
+
+PackedLocalDate PackedLocalDate::fromLocalDateTime(LocalDateTime *dateTime) {
+    if (dateTime == NULL) {
+        throw IllegalArgumentException("The LocalDateTime must not be null");
+    }
+    BaseLocal *local = dateTime;
+    int64_t localMillis = local->getLocalMillis();
+    int64_t epochDay = localMillis / DateTimeConstants::MILLIS_PER_DAY;
+    if (localMillis % DateTimeConstants::MILLIS_PER_DAY < 0) {
+        epochDay--;
+    }
+    return PackedLocalDate(FieldUtils::safeToInt(epochDay));
+}
+
+LocalDateTime *PackedLocalDate::toLocalDateTime(PackedLocalTime time) const {
+    int64_t localMillis = (int64_t) iEpochDay * DateTimeConstants::MILLIS_PER_DAY + time.getMillisOfDay();
+    return new LocalDateTime(localMillis, ISOChronology::getInstanceUTC());
+}
+
+//-----------------------------------------------------------------------
+PackedLocalTime PackedLocalTime::fromLocalTime(LocalTime *time) {
+    if (time == NULL) {
+        throw IllegalArgumentException("The LocalTime must not be null");
+    }
+    // a LocalTime holds the millis of the day as its local millis
+    BaseLocal *local = time;
+    return PackedLocalTime((uint32_t) local->getLocalMillis());
+}
+
+PackedLocalTime PackedLocalTime::fromLocalDateTime(LocalDateTime *dateTime) {
+    if (dateTime == NULL) {
+        throw IllegalArgumentException("The LocalDateTime must not be null");
+    }
+    BaseLocal *local = dateTime;
+    int millisOfDay = (int) (local->getLocalMillis() % DateTimeConstants::MILLIS_PER_DAY);
+    if (millisOfDay < 0) {
+        millisOfDay += DateTimeConstants::MILLIS_PER_DAY;
+    }
+    return PackedLocalTime((uint32_t) millisOfDay);
+}
+
+LocalTime *PackedLocalTime::toLocalTime() const {
+    return new LocalTime((int64_t) iMillisOfDay, ISOChronology::getInstanceUTC());
+}
+
+CODATIME_END
@@ -0,0 +1,117 @@
+//
+//  PackedLocalDate.cpp
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#include "PackedLocalDate.h"
+
+#include "DateTimeConstants.h"
+#include "DateTimeFieldType.h"
+#include "Exceptions.h"
+#include "field/FieldUtils.h"
+#include "format/FormatUtils.h"
+
+#include <type_traits>
+
+CODATIME_BEGIN
+
+static_assert(sizeof(PackedLocalDate) == 4, "PackedLocalDate must pack into 32 bits");
+static_assert(is_trivially_copyable<PackedLocalDate>::value, "PackedLocalDate must be trivially copyable");
+
+/** The days from 0000-03-01, the start of a 400 year cycle, to 1970-01-01 */
+static const int DAYS_0000_TO_1970 = 719468;
+/** The days in a 400 year cycle */
+static const int DAYS_PER_CYCLE = 146097;
+
+/**
+ * Splits an epoch day into its ISO year, month and day.
+ * <p>
+ * The calculation counts years from March, so that the leap day falls at
+ * the end of the year, and 400 year cycles, after which the calendar repeats.
+ */
+static void splitEpochDay(int64_t epochDay, int &year, int &monthOfYear, int &dayOfMonth) {
+    int64_t days = epochDay + DAYS_0000_TO_1970;
+    int64_t cycle = (days >= 0 ? days : days - (DAYS_PER_CYCLE - 1)) / DAYS_PER_CYCLE;
+    int dayOfCycle = (int) (days - cycle * DAYS_PER_CYCLE);
+    int yearOfCycle = (dayOfCycle - dayOfCycle / 1460 + dayOfCycle / 36524 - dayOfCycle / (DAYS_PER_CYCLE - 1)) / 365;
+    int dayOfYear = dayOfCycle - (365 * yearOfCycle + yearOfCycle / 4 - yearOfCycle / 100);
+    int monthFromMarch = (5 * dayOfYear + 2) / 153;
+    dayOfMonth = dayOfYear - (153 * monthFromMarch + 2) / 5 + 1;
+    monthOfYear = (monthFromMarch < 10 ? monthFromMarch + 3 : monthFromMarch - 9);
+    year = (int) (yearOfCycle + cycle * 400) + (monthOfYear <= 2 ? 1 : 0);
+}
+
+static int64_t joinEpochDay(int year, int monthOfYear, int dayOfMonth) {
+    int64_t marchYear = year - (monthOfYear <= 2 ? 1 : 0);
+    int64_t cycle = (marchYear >= 0 ? marchYear : marchYear - 399) / 400;
+    int yearOfCycle = (int) (marchYear - cycle * 400);
+    int dayOfYear = (153 * (monthOfYear > 2 ? monthOfYear - 3 : monthOfYear + 9) + 2) / 5 + dayOfMonth - 1;
+    int dayOfCycle = yearOfCycle * 365 + yearOfCycle / 4 - yearOfCycle / 100 + dayOfYear;
+    return cycle * DAYS_PER_CYCLE + dayOfCycle - DAYS_0000_TO_1970;
+}
+
+const PackedLocalDate PackedLocalDate::EPOCH = PackedLocalDate();
+
+PackedLocalDate PackedLocalDate::of(int year, int monthOfYear, int dayOfMonth) {
+    static const int DAYS_IN_MONTH[12] = { 31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    FieldUtils::verifyValueBounds(DateTimeFieldType::year(), year, MIN_YEAR, MAX_YEAR);
+    FieldUtils::verifyValueBounds(DateTimeFieldType::monthOfYear(), monthOfYear, 1, 12);
+    int maxDay = DAYS_IN_MONTH[monthOfYear - 1];
+    if (monthOfYear == 2 && ((year & 3) != 0 || (year % 100 == 0 && year % 400 != 0))) {
+        maxDay = 28;
+    }
+    FieldUtils::verifyValueBounds(DateTimeFieldType::dayOfMonth(), dayOfMonth, 1, maxDay);
+    return PackedLocalDate((int32_t) joinEpochDay(year, monthOfYear, dayOfMonth));
+}
+
+//-----------------------------------------------------------------------
+int PackedLocalDate::getYear() const {
+    int year, monthOfYear, dayOfMonth;
+    splitEpochDay(iEpochDay, year, monthOfYear, dayOfMonth);
+    return year;
+}
+
+int PackedLocalDate::getMonthOfYear() const {
+    int year, monthOfYear, dayOfMonth;
+    splitEpochDay(iEpochDay, year, monthOfYear, dayOfMonth);
+    return monthOfYear;
+}
+
+int PackedLocalDate::getDayOfMonth() const {
+    int year, monthOfYear, dayOfMonth;
+    splitEpochDay(iEpochDay, year, monthOfYear, dayOfMonth);
+    return dayOfMonth;
+}
+
+int PackedLocalDate::getDayOfWeek() const {
+    // 1970-01-01 was a Thursday
+    int dayOfWeek = (int) (((int64_t) iEpochDay + 3) % 7);
+    return (dayOfWeek < 0 ? dayOfWeek + 8 : dayOfWeek + 1);
+}
+
+PackedLocalDate PackedLocalDate::plusDays(int days) const {
+    return PackedLocalDate(FieldUtils::safeToInt((int64_t) iEpochDay + days));
+}
+
+//-----------------------------------------------------------------------
+int PackedLocalDate::hashCode() const {
+    return iEpochDay;
+}
+
+string PackedLocalDate::toString() const {
+    int year, monthOfYear, dayOfMonth;
+    splitEpochDay(iEpochDay, year, monthOfYear, dayOfMonth);
+    string buf;
+    buf.reserve(11);
+    FormatUtils::appendPaddedInteger(buf, year, 4);
+    buf.append(1, '-');
+    FormatUtils::appendPaddedInteger(buf, monthOfYear, 2);
+    buf.append(1, '-');
+    FormatUtils::appendPaddedInteger(buf, dayOfMonth, 2);
+    return buf;
+}
+
+CODATIME_END
@@ -0,0 +1,170 @@
+//
+//  PackedLocalDate.h
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#ifndef __CodaTime__PackedLocalDate__
+#define __CodaTime__PackedLocalDate__
+
+#include "CodaTimeMacros.h"
+
+#include "PackedLocalTime.h"
+
+#include <string>
+
+using namespace std;
+
+CODATIME_BEGIN
+
+class LocalDateTime;
+
+/**
+ * PackedLocalDate is a date without a time zone, packed into 32 bits.
+ * <p>
+ * It holds the number of days from 1970-01-01 and nothing else. The fields
+ * are always those of the ISO chronology, which is the proleptic Gregorian
+ * calendar, and are calculated arithmetically from the day. It is trivially
+ * copyable, so arrays of it can be stored and moved as plain memory, and two
+ * dates compare as plain integers.
+ * <p>
+ * Use <code>LocalDateTime</code> for anything beyond reading the fields, and
+ * convert with {@link #fromLocalDateTime} and {@link #toLocalDateTime}.
+ * <p>
+ * PackedLocalDate is thread-safe and immutable.
+ */
+class PackedLocalDate {
+    
+private:
+    
+    /** The days from 1970-01-01 */
+    int32_t iEpochDay;
+    
+    constexpr explicit PackedLocalDate(int32_t epochDay) : iEpochDay(epochDay) {
+    }
+    
+public:
+    
+    /** The earliest supported year. */
+    static const int MIN_YEAR = -5000000;
+    /** The latest supported year. */
+    static const int MAX_YEAR = 5000000;
+    
+    /** Constant for 1970-01-01. */
+    static const PackedLocalDate EPOCH;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Creates the date 1970-01-01.
+     */
+    constexpr PackedLocalDate() : iEpochDay(0) {
+    }
+    
+    /**
+     * Obtains a date from its fields.
+     *
+     * @param year  the year, from MIN_YEAR to MAX_YEAR
+     * @param monthOfYear  the month of the year, from 1 to 12
+     * @param dayOfMonth  the day of the month, from 1 to the length of the month
+     * @return the date
+     * @throws IllegalFieldValueException if any field is out of range
+     */
+    static PackedLocalDate of(int year, int monthOfYear, int dayOfMonth);
+    
+    /**
+     * Obtains a date from the number of days from 1970-01-01.
+     *
+     * @param epochDay  the days from 1970-01-01
+     * @return the date
+     */
+    static constexpr PackedLocalDate fromEpochDay(int32_t epochDay) {
+        return PackedLocalDate(epochDay);
+    }
+    
+    /**
+     * Obtains the date part of a <code>LocalDateTime</code>.
+     * <p>
+     * The date is taken from the local millis, so it is the ISO date of the
+     * same day even if the date-time uses another chronology.
+     *
+     * @param dateTime  the date-time to convert, not null
+     * @return the date
+     * @throws IllegalArgumentException if the date-time is null or out of range
+     */
+    static PackedLocalDate fromLocalDateTime(LocalDateTime *dateTime);
+    
+    //-----------------------------------------------------------------------
+    constexpr int32_t getEpochDay() const {
+        return iEpochDay;
+    }
+    
+    int getYear() const;
+    int getMonthOfYear() const;
+    int getDayOfMonth() const;
+    
+    /**
+     * Gets the day of the week, from 1 for Monday to 7 for Sunday.
+     *
+     * @return the day of the week
+     */
+    int getDayOfWeek() const;
+    
+    /**
+     * Returns a new date with the specified number of days added.
+     *
+     * @param days  the amount of days to add, may be negative
+     * @return the new date
+     * @throws ArithmeticException if the result overflows
+     */
+    PackedLocalDate plusDays(int days) const;
+    
+    /**
+     * Converts this date and a time to a <code>LocalDateTime</code> in the
+     * ISO chronology.
+     *
+     * @param time  the time of day
+     * @return the date-time, owned by the caller
+     */
+    LocalDateTime *toLocalDateTime(PackedLocalTime time) const;
+    
+    //-----------------------------------------------------------------------
+    constexpr bool operator==(const PackedLocalDate &other) const {
+        return iEpochDay == other.iEpochDay;
+    }
+    
+    constexpr bool operator!=(const PackedLocalDate &other) const {
+        return iEpochDay != other.iEpochDay;
+    }
+    
+    constexpr bool operator<(const PackedLocalDate &other) const {
+        return iEpochDay < other.iEpochDay;
+    }
+    
+    constexpr bool operator>(const PackedLocalDate &other) const {
+        return iEpochDay > other.iEpochDay;
+    }
+    
+    constexpr bool operator<=(const PackedLocalDate &other) const {
+        return iEpochDay <= other.iEpochDay;
+    }
+    
+    constexpr bool operator>=(const PackedLocalDate &other) const {
+        return iEpochDay >= other.iEpochDay;
+    }
+    
+    int hashCode() const;
+    
+    /**
+     * Output the date in ISO8601 format (yyyy-MM-dd).
+     *
+     * @return ISO8601 date formatted string.
+     */
+    string toString() const;
+    
+};
+
+CODATIME_END
+
+#endif /* defined(__CodaTime__PackedLocalDate__) */
@@ -0,0 +1,69 @@
+//
+//  PackedLocalTime.cpp
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#include "PackedLocalTime.h"
+
+#include "DateTimeConstants.h"
+#include "DateTimeFieldType.h"
+#include "Exceptions.h"
+#include "field/FieldUtils.h"
+#include "format/FormatUtils.h"
+
+#include <type_traits>
+
+CODATIME_BEGIN
+
+static_assert(sizeof(PackedLocalTime) == 4, "PackedLocalTime must pack into 32 bits");
+static_assert(is_trivially_copyable<PackedLocalTime>::value, "PackedLocalTime must be trivially copyable");
+
+const PackedLocalTime PackedLocalTime::MIDNIGHT = PackedLocalTime();
+
+PackedLocalTime PackedLocalTime::of(int hourOfDay, int minuteOfHour, int secondOfMinute, int millisOfSecond) {
+    FieldUtils::verifyValueBounds(DateTimeFieldType::hourOfDay(), hourOfDay, 0, 23);
+    FieldUtils::verifyValueBounds(DateTimeFieldType::minuteOfHour(), minuteOfHour, 0, 59);
+    FieldUtils::verifyValueBounds(DateTimeFieldType::secondOfMinute(), secondOfMinute, 0, 59);
+    FieldUtils::verifyValueBounds(DateTimeFieldType::millisOfSecond(), millisOfSecond, 0, 999);
+    return PackedLocalTime((uint32_t) (hourOfDay * DateTimeConstants::MILLIS_PER_HOUR +
+                                       minuteOfHour * DateTimeConstants::MILLIS_PER_MINUTE +
+                                       secondOfMinute * DateTimeConstants::MILLIS_PER_SECOND +
+                                       millisOfSecond));
+}
+
+PackedLocalTime PackedLocalTime::fromMillisOfDay(int millisOfDay) {
+    FieldUtils::verifyValueBounds(DateTimeFieldType::millisOfDay(), millisOfDay, 0, DateTimeConstants::MILLIS_PER_DAY - 1);
+    return PackedLocalTime((uint32_t) millisOfDay);
+}
+
+//-----------------------------------------------------------------------
+PackedLocalTime PackedLocalTime::plusMillis(int millis) const {
+    int64_t millisOfDay = (iMillisOfDay + (int64_t) millis) % DateTimeConstants::MILLIS_PER_DAY;
+    if (millisOfDay < 0) {
+        millisOfDay += DateTimeConstants::MILLIS_PER_DAY;
+    }
+    return PackedLocalTime((uint32_t) millisOfDay);
+}
+
+//-----------------------------------------------------------------------
+int PackedLocalTime::hashCode() const {
+    return (int) iMillisOfDay;
+}
+
+string PackedLocalTime::toString() const {
+    string buf;
+    buf.reserve(12);
+    FormatUtils::appendPaddedInteger(buf, getHourOfDay(), 2);
+    buf.append(1, ':');
+    FormatUtils::appendPaddedInteger(buf, getMinuteOfHour(), 2);
+    buf.append(1, ':');
+    FormatUtils::appendPaddedInteger(buf, getSecondOfMinute(), 2);
+    buf.append(1, '.');
+    FormatUtils::appendPaddedInteger(buf, getMillisOfSecond(), 3);
+    return buf;
+}
+
+CODATIME_END
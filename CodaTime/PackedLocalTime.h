@@ -0,0 +1,172 @@
+//
+//  PackedLocalTime.h
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#ifndef __CodaTime__PackedLocalTime__
+#define __CodaTime__PackedLocalTime__
+
+#include "CodaTimeMacros.h"
+
+#include <string>
+
+using namespace std;
+
+CODATIME_BEGIN
+
+class LocalDateTime;
+class LocalTime;
+
+/**
+ * PackedLocalTime is a time of day without a time zone, packed into 32 bits.
+ * <p>
+ * It holds the millisecond of the day, which needs 27 bits, and nothing
+ * else. The fields are always those of the ISO chronology. It is trivially
+ * copyable, so arrays of it can be stored and moved as plain memory, and two
+ * times compare as plain integers.
+ * <p>
+ * Use <code>LocalTime</code> for anything beyond reading the fields, and
+ * convert with {@link #fromLocalTime} and {@link #toLocalTime}.
+ * <p>
+ * PackedLocalTime is thread-safe and immutable.
+ */
+class PackedLocalTime {
+    
+private:
+    
+    /** The millisecond of the day, from 0 to 86,399,999 */
+    uint32_t iMillisOfDay;
+    
+    constexpr explicit PackedLocalTime(uint32_t millisOfDay) : iMillisOfDay(millisOfDay) {
+    }
+    
+public:
+    
+    /** Constant for midnight, 00:00. */
+    static const PackedLocalTime MIDNIGHT;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Creates a time of midnight.
+     */
+    constexpr PackedLocalTime() : iMillisOfDay(0) {
+    }
+    
+    /**
+     * Obtains a time from its fields.
+     *
+     * @param hourOfDay  the hour of the day, from 0 to 23
+     * @param minuteOfHour  the minute of the hour, from 0 to 59
+     * @param secondOfMinute  the second of the minute, from 0 to 59
+     * @param millisOfSecond  the millisecond of the second, from 0 to 999
+     * @return the time
+     * @throws IllegalFieldValueException if any field is out of range
+     */
+    static PackedLocalTime of(int hourOfDay, int minuteOfHour, int secondOfMinute, int millisOfSecond);
+    
+    /**
+     * Obtains a time from the millisecond of the day.
+     *
+     * @param millisOfDay  the millisecond of the day, from 0 to 86,399,999
+     * @return the time
+     * @throws IllegalFieldValueException if the value is out of range
+     */
+    static PackedLocalTime fromMillisOfDay(int millisOfDay);
+    
+    /**
+     * Obtains a time from a <code>LocalTime</code>.
+     *
+     * @param time  the time to convert, not null
+     * @return the time
+     * @throws IllegalArgumentException if the time is null
+     */
+    static PackedLocalTime fromLocalTime(LocalTime *time);
+    
+    /**
+     * Obtains the time part of a <code>LocalDateTime</code>.
+     *
+     * @param dateTime  the date-time to convert, not null
+     * @return the time
+     * @throws IllegalArgumentException if the date-time is null
+     */
+    static PackedLocalTime fromLocalDateTime(LocalDateTime *dateTime);
+    
+    //-----------------------------------------------------------------------
+    constexpr int getMillisOfDay() const {
+        return (int) iMillisOfDay;
+    }
+    
+    constexpr int getHourOfDay() const {
+        return (int) (iMillisOfDay / 3600000);
+    }
+    
+    constexpr int getMinuteOfHour() const {
+        return (int) (iMillisOfDay / 60000 % 60);
+    }
+    
+    constexpr int getSecondOfMinute() const {
+        return (int) (iMillisOfDay / 1000 % 60);
+    }
+    
+    constexpr int getMillisOfSecond() const {
+        return (int) (iMillisOfDay % 1000);
+    }
+    
+    /**
+     * Returns a new time with the specified number of milliseconds added,
+     * wrapping around midnight as <code>LocalTime::plusMillis</code> does.
+     *
+     * @param millis  the amount of milliseconds to add, may be negative
+     * @return the new time
+     */
+    PackedLocalTime plusMillis(int millis) const;
+    
+    /**
+     * Converts this time to a <code>LocalTime</code> in the ISO chronology.
+     *
+     * @return the time, owned by the caller
+     */
+    LocalTime *toLocalTime() const;
+    
+    //-----------------------------------------------------------------------
+    constexpr bool operator==(const PackedLocalTime &other) const {
+        return iMillisOfDay == other.iMillisOfDay;
+    }
+    
+    constexpr bool operator!=(const PackedLocalTime &other) const {
+        return iMillisOfDay != other.iMillisOfDay;
+    }
+    
+    constexpr bool operator<(const PackedLocalTime &other) const {
+        return iMillisOfDay < other.iMillisOfDay;
+    }
+    
+    constexpr bool operator>(const PackedLocalTime &other) const {
+        return iMillisOfDay > other.iMillisOfDay;
+    }
+    
+    constexpr bool operator<=(const PackedLocalTime &other) const {
+        return iMillisOfDay <= other.iMillisOfDay;
+    }
+    
+    constexpr bool operator>=(const PackedLocalTime &other) const {
+        return iMillisOfDay >= other.iMillisOfDay;
+    }
+    
+    int hashCode() const;
+    
+    /**
+     * Output the time in ISO8601 format (HH:mm:ss.SSS).
+     *
+     * @return ISO8601 time formatted string.
+     */
+    string toString() const;
+    
+};
+
+CODATIME_END
+
+#endif /* defined(__CodaTime__PackedLocalTime__) */
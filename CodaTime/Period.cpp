@@ -10,20 +10,28 @@
 #include "DateTimeConstants.h"
 #include "DateTimeFieldType.h"
 #include "DateTimeUtils.h"
+#include "Days.h"
 #include "Duration.h"
 #include "field/FieldUtils.h"
 #include "format/ISOPeriodFormat.h"
 #include "format/PeriodFormatter.h"
+#include "Hours.h"
+#include "Minutes.h"
 #include "Period.h"
 #include "ReadablePartial.h"
+#include "Seconds.h"
+#include "Weeks.h"
 
 #include "Exceptions.h"
 
 CODATIME_BEGIN
 
-const Period *Period::ZERO = new Period();
+const Period *Period::ZERO() {
+    static const Period *const cZero = new Period();
+    return cZero;
+}
 
-Period::Period(vector<int> values, const PeriodType *type) : BasePeriod(values, type) {
+Period::Period(const PeriodType::Values &values, const PeriodType *type) : BasePeriod(values, type) {
 }
 
 void Period::checkYearsAndMonths(string destintionType) {
@@ -52,35 +60,35 @@ Period *Period::parse(string str, PeriodFormatter *formatter) {
 
 //-----------------------------------------------------------------------
 Period *Period::years(int years) {
-    return new Period({years, 0, 0, 0, 0, 0, 0, 0, 0}, PeriodType::standard());
+    return new Period({{years, 0, 0, 0, 0, 0, 0, 0}}, PeriodType::standard());
 }
 
 Period *Period::months(int months) {
-    return new Period({0, months, 0, 0, 0, 0, 0, 0}, PeriodType::standard());
+    return new Period({{0, months, 0, 0, 0, 0, 0, 0}}, PeriodType::standard());
 }
 
 Period *Period::weeks(int weeks) {
-    return new Period({0, 0, weeks, 0, 0, 0, 0, 0}, PeriodType::standard());
+    return new Period({{0, 0, weeks, 0, 0, 0, 0, 0}}, PeriodType::standard());
 }
 
 Period *Period::days(int days) {
-    return new Period({0, 0, 0, days, 0, 0, 0, 0}, PeriodType::standard());
+    return new Period({{0, 0, 0, days, 0, 0, 0, 0}}, PeriodType::standard());
 }
 
 Period *Period::hours(int hours) {
-    return new Period({0, 0, 0, 0, hours, 0, 0, 0}, PeriodType::standard());
+    return new Period({{0, 0, 0, 0, hours, 0, 0, 0}}, PeriodType::standard());
 }
 
 Period *Period::minutes(int minutes) {
-    return new Period({0, 0, 0, 0, 0, minutes, 0, 0}, PeriodType::standard());
+    return new Period({{0, 0, 0, 0, 0, minutes, 0, 0}}, PeriodType::standard());
 }
 
 Period *Period::seconds(int seconds) {
-    return new Period({0, 0, 0, 0, 0, 0, seconds, 0}, PeriodType::standard());
+    return new Period({{0, 0, 0, 0, 0, 0, seconds, 0}}, PeriodType::standard());
 }
 
 Period *Period::millis(int millis) {
-    return new Period({0, 0, 0, 0, 0, 0, 0, millis}, PeriodType::standard());
+    return new Period({{0, 0, 0, 0, 0, 0, 0, millis}}, PeriodType::standard());
 }
 
 //-----------------------------------------------------------------------
@@ -92,7 +100,6 @@ Period *Period::fieldDifference(ReadablePartial *start, ReadablePartial *end) {
         throw IllegalArgumentException("ReadablePartial objects must have the same set of fields");
     }
     vector<const DurationFieldType*> types = vector<const DurationFieldType*>(start->size());
-    vector<int> values = vector<int>(start->size());
     for (int i = 0, isize = start->size(); i < isize; i++) {
         if (start->getFieldType(i) != end->getFieldType(i)) {
             throw IllegalArgumentException("ReadablePartial objects must have the same set of fields");
@@ -101,13 +108,18 @@ Period *Period::fieldDifference(ReadablePartial *start, ReadablePartial *end) {
         if (i > 0 && types[i - 1] == types[i]) {
             throw IllegalArgumentException("ReadablePartial objects must not have overlapping fields");
         }
-        values[i] = end->getValue(i) - start->getValue(i);
     }
-    return new Period(values, PeriodType::forFields(types));
+    const PeriodType *type = PeriodType::forFields(types);
+    // values are stored in the order of the type, which may differ from the partial
+    PeriodType::Values values = PeriodType::Values();
+    for (int i = 0, isize = start->size(); i < isize; i++) {
+        values[type->indexOf(types[i])] = end->getValue(i) - start->getValue(i);
+    }
+    return new Period(values, type);
 }
 
 //-----------------------------------------------------------------------
-Period::Period() : BasePeriod(0LL, (const PeriodType*) NULL, (Chronology*) NULL) {
+Period::Period() : BasePeriod((int64_t) 0, (const PeriodType*) NULL, (Chronology*) NULL) {
 }
 
 Period::Period(int hours, int minutes, int seconds, int millis) : BasePeriod(0, 0, 0, 0, hours, minutes, seconds, millis, PeriodType::standard()) {
@@ -233,8 +245,8 @@ Period *Period::withFields(ReadablePeriod *period) {
     if (period == NULL) {
         return this;
     }
-    vector<int> newValues = getValues();  // cloned
-    newValues = BasePeriod::mergePeriodInto(newValues, period);
+    PeriodType::Values newValues = getValueArray();  // copied
+    BasePeriod::mergePeriodInto(newValues, period);
     return new Period(newValues, getPeriodType());
 }
 
@@ -243,7 +255,7 @@ Period *Period::withField(DurationFieldType *field, int value) {
     if (field == NULL) {
         throw IllegalArgumentException("Field must not be NULL");
     }
-    vector<int> newValues = getValues();  // cloned
+    PeriodType::Values newValues = getValueArray();  // copied
     BasePeriod::setFieldInto(newValues, field, value);
     return new Period(newValues, getPeriodType());
 }
@@ -255,56 +267,56 @@ Period *Period::withFieldAdded(DurationFieldType *field, int value) {
     if (value == 0) {
         return this;
     }
-    vector<int> newValues = getValues();  // cloned
+    PeriodType::Values newValues = getValueArray();  // copied
     BasePeriod::addFieldInto(newValues, field, value);
     return new Period(newValues, getPeriodType());
 }
 
 //-----------------------------------------------------------------------
 Period *Period::withYears(int years) {
-    vector<int> values = getValues();  // cloned
+    PeriodType::Values values = getValueArray();  // copied
     getPeriodType()->setIndexedField(this, PeriodType::YEAR_INDEX, values, years);
     return new Period(values, getPeriodType());
 }
 
 Period *Period::withMonths(int months) {
-    vector<int> values = getValues();  // cloned
+    PeriodType::Values values = getValueArray();  // copied
     getPeriodType()->setIndexedField(this, PeriodType::MONTH_INDEX, values, months);
     return new Period(values, getPeriodType());
 }
 
 Period *Period::withWeeks(int weeks) {
-    vector<int> values = getValues();  // cloned
+    PeriodType::Values values = getValueArray();  // copied
     getPeriodType()->setIndexedField(this, PeriodType::WEEK_INDEX, values, weeks);
     return new Period(values, getPeriodType());
 }
 
 Period *Period::withDays(int days) {
-    vector<int> values = getValues();  // cloned
+    PeriodType::Values values = getValueArray();  // copied
     getPeriodType()->setIndexedField(this, PeriodType::DAY_INDEX, values, days);
     return new Period(values, getPeriodType());
 }
 
 Period *Period::withHours(int hours) {
-    vector<int> values = getValues();  // cloned
+    PeriodType::Values values = getValueArray();  // copied
     getPeriodType()->setIndexedField(this, PeriodType::HOUR_INDEX, values, hours);
     return new Period(values, getPeriodType());
 }
 
 Period *Period::withMinutes(int minutes) {
-    vector<int> values = getValues();  // cloned
+    PeriodType::Values values = getValueArray();  // copied
     getPeriodType()->setIndexedField(this, PeriodType::MINUTE_INDEX, values, minutes);
     return new Period(values, getPeriodType());
 }
 
 Period *Period::withSeconds(int seconds) {
-    vector<int> values = getValues();  // cloned
+    PeriodType::Values values = getValueArray();  // copied
     getPeriodType()->setIndexedField(this, PeriodType::SECOND_INDEX, values, seconds);
     return new Period(values, getPeriodType());
 }
 
 Period *Period::withMillis(int millis) {
-    vector<int> values = getValues();  // cloned
+    PeriodType::Values values = getValueArray();  // copied
     getPeriodType()->setIndexedField(this, PeriodType::MILLI_INDEX, values, millis);
     return new Period(values, getPeriodType());
 }
@@ -314,15 +326,15 @@ Period *Period::plus(ReadablePeriod *period) {
     if (period == NULL) {
         return this;
     }
-    vector<int> values = getValues();  // cloned
-    getPeriodType()->addIndexedField(this, PeriodType::YEAR_INDEX, values, period->get(DurationFieldType::YEARS_TYPE));
-    getPeriodType()->addIndexedField(this, PeriodType::MONTH_INDEX, values, period->get(DurationFieldType::MONTHS_TYPE));
-    getPeriodType()->addIndexedField(this, PeriodType::WEEK_INDEX, values, period->get(DurationFieldType::WEEKS_TYPE));
-    getPeriodType()->addIndexedField(this, PeriodType::DAY_INDEX, values, period->get(DurationFieldType::DAYS_TYPE));
-    getPeriodType()->addIndexedField(this, PeriodType::HOUR_INDEX, values, period->get(DurationFieldType::HOURS_TYPE));
-    getPeriodType()->addIndexedField(this, PeriodType::MINUTE_INDEX, values, period->get(DurationFieldType::MINUTES_TYPE));
-    getPeriodType()->addIndexedField(this, PeriodType::SECOND_INDEX, values, period->get(DurationFieldType::SECONDS_TYPE));
-    getPeriodType()->addIndexedField(this, PeriodType::MILLI_INDEX, values, period->get(DurationFieldType::MILLIS_TYPE));
+    PeriodType::Values values = getValueArray();  // copied
+    getPeriodType()->addIndexedField(this, PeriodType::YEAR_INDEX, values, period->get(DurationFieldType::years()));
+    getPeriodType()->addIndexedField(this, PeriodType::MONTH_INDEX, values, period->get(DurationFieldType::months()));
+    getPeriodType()->addIndexedField(this, PeriodType::WEEK_INDEX, values, period->get(DurationFieldType::weeks()));
+    getPeriodType()->addIndexedField(this, PeriodType::DAY_INDEX, values, period->get(DurationFieldType::days()));
+    getPeriodType()->addIndexedField(this, PeriodType::HOUR_INDEX, values, period->get(DurationFieldType::hours()));
+    getPeriodType()->addIndexedField(this, PeriodType::MINUTE_INDEX, values, period->get(DurationFieldType::minutes()));
+    getPeriodType()->addIndexedField(this, PeriodType::SECOND_INDEX, values, period->get(DurationFieldType::seconds()));
+    getPeriodType()->addIndexedField(this, PeriodType::MILLI_INDEX, values, period->get(DurationFieldType::millis()));
     return new Period(values, getPeriodType());
 }
 
@@ -331,7 +343,7 @@ Period *Period::plusYears(int years) {
     if (years == 0) {
         return this;
     }
-    vector<int> values = getValues();  // cloned
+    PeriodType::Values values = getValueArray();  // copied
     getPeriodType()->addIndexedField(this, PeriodType::YEAR_INDEX, values, years);
     return new Period(values, getPeriodType());
 }
@@ -340,7 +352,7 @@ Period *Period::plusMonths(int months) {
     if (months == 0) {
         return this;
     }
-    vector<int> values = getValues();  // cloned
+    PeriodType::Values values = getValueArray();  // copied
     getPeriodType()->addIndexedField(this, PeriodType::MONTH_INDEX, values, months);
     return new Period(values, getPeriodType());
 }
@@ -349,7 +361,7 @@ Period *Period::plusWeeks(int weeks) {
     if (weeks == 0) {
         return this;
     }
-    vector<int> values = getValues();  // cloned
+    PeriodType::Values values = getValueArray();  // copied
     getPeriodType()->addIndexedField(this, PeriodType::WEEK_INDEX, values, weeks);
     return new Period(values, getPeriodType());
 }
@@ -358,7 +370,7 @@ Period *Period::plusDays(int days) {
     if (days == 0) {
         return this;
     }
-    vector<int> values = getValues();  // cloned
+    PeriodType::Values values = getValueArray();  // copied
     getPeriodType()->addIndexedField(this, PeriodType::DAY_INDEX, values, days);
     return new Period(values, getPeriodType());
 }
@@ -367,7 +379,7 @@ Period *Period::plusHours(int hours) {
     if (hours == 0) {
         return this;
     }
-    vector<int> values = getValues();  // cloned
+    PeriodType::Values values = getValueArray();  // copied
     getPeriodType()->addIndexedField(this, PeriodType::HOUR_INDEX, values, hours);
     return new Period(values, getPeriodType());
 }
@@ -376,7 +388,7 @@ Period *Period::plusMinutes(int minutes) {
     if (minutes == 0) {
         return this;
     }
-    vector<int> values = getValues();  // cloned
+    PeriodType::Values values = getValueArray();  // copied
     getPeriodType()->addIndexedField(this, PeriodType::MINUTE_INDEX, values, minutes);
     return new Period(values, getPeriodType());
 }
@@ -385,7 +397,7 @@ Period *Period::plusSeconds(int seconds) {
     if (seconds == 0) {
         return this;
     }
-    vector<int> values = getValues();  // cloned
+    PeriodType::Values values = getValueArray();  // copied
     getPeriodType()->addIndexedField(this, PeriodType::SECOND_INDEX, values, seconds);
     return new Period(values, getPeriodType());
 }
@@ -394,7 +406,7 @@ Period *Period::plusMillis(int millis) {
     if (millis == 0) {
         return this;
     }
-    vector<int> values = getValues();  // cloned
+    PeriodType::Values values = getValueArray();  // copied
     getPeriodType()->addIndexedField(this, PeriodType::MILLI_INDEX, values, millis);
     return new Period(values, getPeriodType());
 }
@@ -404,15 +416,15 @@ Period *Period::minus(ReadablePeriod *period) {
     if (period == NULL) {
         return this;
     }
-    vector<int> values = getValues();  // cloned
-    getPeriodType()->addIndexedField(this, PeriodType::YEAR_INDEX, values, -period->get(DurationFieldType::YEARS_TYPE));
-    getPeriodType()->addIndexedField(this, PeriodType::MONTH_INDEX, values, -period->get(DurationFieldType::MONTHS_TYPE));
-    getPeriodType()->addIndexedField(this, PeriodType::WEEK_INDEX, values, -period->get(DurationFieldType::WEEKS_TYPE));
-    getPeriodType()->addIndexedField(this, PeriodType::DAY_INDEX, values, -period->get(DurationFieldType::DAYS_TYPE));
-    getPeriodType()->addIndexedField(this, PeriodType::HOUR_INDEX, values, -period->get(DurationFieldType::HOURS_TYPE));
-    getPeriodType()->addIndexedField(this, PeriodType::MINUTE_INDEX, values, -period->get(DurationFieldType::MINUTES_TYPE));
-    getPeriodType()->addIndexedField(this, PeriodType::SECOND_INDEX, values, -period->get(DurationFieldType::SECONDS_TYPE));
-    getPeriodType()->addIndexedField(this, PeriodType::MILLI_INDEX, values, -period->get(DurationFieldType::MILLIS_TYPE));
+    PeriodType::Values values = getValueArray();  // copied
+    getPeriodType()->addIndexedField(this, PeriodType::YEAR_INDEX, values, -period->get(DurationFieldType::years()));
+    getPeriodType()->addIndexedField(this, PeriodType::MONTH_INDEX, values, -period->get(DurationFieldType::months()));
+    getPeriodType()->addIndexedField(this, PeriodType::WEEK_INDEX, values, -period->get(DurationFieldType::weeks()));
+    getPeriodType()->addIndexedField(this, PeriodType::DAY_INDEX, values, -period->get(DurationFieldType::days()));
+    getPeriodType()->addIndexedField(this, PeriodType::HOUR_INDEX, values, -period->get(DurationFieldType::hours()));
+    getPeriodType()->addIndexedField(this, PeriodType::MINUTE_INDEX, values, -period->get(DurationFieldType::minutes()));
+    getPeriodType()->addIndexedField(this, PeriodType::SECOND_INDEX, values, -period->get(DurationFieldType::seconds()));
+    getPeriodType()->addIndexedField(this, PeriodType::MILLI_INDEX, values, -period->get(DurationFieldType::millis()));
     return new Period(values, getPeriodType());
 }
 
@@ -450,11 +462,11 @@ Period *Period::minusMillis(int millis) {
 }
 
 Period *Period::multipliedBy(int scalar) {
-    if (this == ZERO || scalar == 1) {
+    if (this == ZERO() || scalar == 1) {
         return this;
     }
-    vector<int> values = getValues();  // cloned
-    for (int i = 0; i < values.size(); i++) {
+    PeriodType::Values values = getValueArray();  // copied
+    for (int i = 0, isize = size(); i < isize; i++) {
         values[i] = FieldUtils::safeMultiply(values[i], scalar);
     }
     return new Period(values, getPeriodType());
@@ -464,7 +476,7 @@ Period *Period::negated() {
     return multipliedBy(-1);
 }
 
-Weeks *Period::toStandardWeeks() {
+Weeks Period::toStandardWeeks() {
     checkYearsAndMonths("Weeks");
     int64_t millis = getMillis();  // assign to a int64_t
     millis += ((int64_t) getSeconds()) * DateTimeConstants::MILLIS_PER_SECOND;
@@ -475,7 +487,7 @@ Weeks *Period::toStandardWeeks() {
     return Weeks::weeks(FieldUtils::safeToInt(weeks));
 }
 
-Days *Period::toStandardDays() {
+Days Period::toStandardDays() {
     checkYearsAndMonths("Days");
     int64_t millis = getMillis();  // assign to a int64_t
     millis += ((int64_t) getSeconds()) * DateTimeConstants::MILLIS_PER_SECOND;
@@ -487,7 +499,7 @@ Days *Period::toStandardDays() {
     return Days::days(FieldUtils::safeToInt(days));
 }
 
-Hours *Period::toStandardHours() {
+Hours Period::toStandardHours() {
     checkYearsAndMonths("Hours");
     int64_t millis = getMillis();  // assign to a int64_t
     millis += ((int64_t) getSeconds()) * DateTimeConstants::MILLIS_PER_SECOND;
@@ -499,7 +511,7 @@ Hours *Period::toStandardHours() {
     return Hours::hours(FieldUtils::safeToInt(hours));
 }
 
-Minutes *Period::toStandardMinutes() {
+Minutes Period::toStandardMinutes() {
     checkYearsAndMonths("Minutes");
     int64_t millis = getMillis();  // assign to a int64_t
     millis += ((int64_t) getSeconds()) * DateTimeConstants::MILLIS_PER_SECOND;
@@ -511,7 +523,7 @@ Minutes *Period::toStandardMinutes() {
     return Minutes::minutes(FieldUtils::safeToInt(minutes));
 }
 
-Seconds *Period::toStandardSeconds() {
+Seconds Period::toStandardSeconds() {
     checkYearsAndMonths("Seconds");
     int64_t seconds = getMillis() / DateTimeConstants::MILLIS_PER_SECOND;
     seconds = FieldUtils::safeAdd(seconds, (int64_t) getSeconds());
@@ -550,12 +562,12 @@ Period *Period::normalizedStandard(const PeriodType *type) {
     int months = getMonths();
     if (years != 0 || months != 0) {
         int64_t totalMonths = years * 12L + months;
-        if (type->isSupported(DurationFieldType::YEARS_TYPE)) {
+        if (type->isSupported(DurationFieldType::years())) {
             int normalizedYears = FieldUtils::safeToInt(totalMonths / 12);
             result = result->withYears(normalizedYears);
             totalMonths = totalMonths - (normalizedYears * 12);
         }
-        if (type->isSupported(DurationFieldType::MONTHS_TYPE)) {
+        if (type->isSupported(DurationFieldType::months())) {
             int normalizedMonths = FieldUtils::safeToInt(totalMonths);
             result = result->withMonths(normalizedMonths);
             totalMonths = totalMonths - normalizedMonths;
@@ -72,10 +72,10 @@ private:
     /**
      * Constructor used when we trust ourselves.
      *
-     * @param values  the values to use, not null, not cloned
+     * @param values  the values to use
      * @param type  which set of fields this period supports, not null
      */
-    Period(vector<int> values, const PeriodType *type);
+    Period(const PeriodType::Values &values, const PeriodType *type);
     
     /**
      * Check that there are no years or months in the period.
@@ -106,10 +106,11 @@ public:
     string toString() { return BasePeriod::toString(); }
     
     /**
-     * A period of zero length and standard period type.
+     * Gets a period of zero length and standard period type.
+     * It is created on first use and never destroyed.
      * @since 1.4
      */
-    static const Period *ZERO;
+    static const Period *ZERO();
     
     //-----------------------------------------------------------------------
     /**
@@ -1126,7 +1127,7 @@ public:
      * @throws ArithmeticException if the number of weeks is too large to be represented
      * @since 1.5
      */
-    Weeks *toStandardWeeks();
+    Weeks toStandardWeeks();
     
     /**
      * Converts this period to a period in days assuming a
@@ -1147,7 +1148,7 @@ public:
      * @throws ArithmeticException if the number of days is too large to be represented
      * @since 1.5
      */
-    Days *toStandardDays();
+    Days toStandardDays();
     
     /**
      * Converts this period to a period in hours assuming a
@@ -1168,7 +1169,7 @@ public:
      * @throws ArithmeticException if the number of hours is too large to be represented
      * @since 1.5
      */
-    Hours *toStandardHours();
+    Hours toStandardHours();
     
     /**
      * Converts this period to a period in minutes assuming a
@@ -1189,7 +1190,7 @@ public:
      * @throws ArithmeticException if the number of minutes is too large to be represented
      * @since 1.5
      */
-    Minutes *toStandardMinutes();
+    Minutes toStandardMinutes();
     
     /**
      * Converts this period to a period in seconds assuming a
@@ -1210,7 +1211,7 @@ public:
      * @throws ArithmeticException if the number of seconds is too large to be represented
      * @since 1.5
      */
-    Seconds *toStandardSeconds();
+    Seconds toStandardSeconds();
     
     //-----------------------------------------------------------------------
     /**
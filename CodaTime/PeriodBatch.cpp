@@ -0,0 +1,178 @@
+//
+//  PeriodBatch.cpp
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#include "PeriodBatch.h"
+
+#include "DateTimeConstants.h"
+#include "DateTimeUtils.h"
+#include "Exceptions.h"
+#include "field/FieldUtils.h"
+#include "ReadablePeriod.h"
+#include "WorkerThreads.h"
+
+#include <climits>
+#include <functional>
+#include <vector>
+
+CODATIME_BEGIN
+
+/** Standard duration of each lane in millis, zero for the imprecise years and months */
+static const int64_t LANE_MILLIS[8] = {
+    0, 0,
+    DateTimeConstants::MILLIS_PER_WEEK, DateTimeConstants::MILLIS_PER_DAY,
+    DateTimeConstants::MILLIS_PER_HOUR, DateTimeConstants::MILLIS_PER_MINUTE,
+    DateTimeConstants::MILLIS_PER_SECOND, 1,
+};
+
+void PeriodBatch::expand(ReadablePeriod *const *periods, size_t count, PeriodType::Values *values) {
+    for (size_t n = 0; n < count; n++) {
+        ReadablePeriod *period = periods[n];
+        const PeriodType *type = period->getPeriodType();
+        PeriodType::Values &lanes = values[n];
+        for (int i = 0; i < PeriodType::FIELD_COUNT; i++) {
+            int index = type->iIndices[i];
+            lanes[i] = (index == -1 ? 0 : period->getValue(index));
+        }
+    }
+}
+
+//-----------------------------------------------------------------------
+void PeriodBatch::accumulate(const PeriodType::Values *values, size_t count, Totals &totals) {
+    Totals sums = totals;
+    for (size_t n = 0; n < count; n++) {
+        const PeriodType::Values &lanes = values[n];
+        for (int i = 0; i < 8; i++) {
+            sums[i] += lanes[i];
+        }
+    }
+    totals = sums;
+}
+
+PeriodType::Values PeriodBatch::narrow(const Totals &totals) {
+    PeriodType::Values result;
+    for (int i = 0; i < 8; i++) {
+        result[i] = FieldUtils::safeToInt(totals[i]);
+    }
+    return result;
+}
+
+PeriodType::Values PeriodBatch::sum(const PeriodType::Values *values, size_t count) {
+    Totals totals = Totals();
+    accumulate(values, count, totals);
+    return narrow(totals);
+}
+
+PeriodType::Values PeriodBatch::sum(const PeriodType::Values *values, size_t count, int threads) {
+    size_t chunks = (threads < 1 ? 1 : (size_t) threads);
+    if (chunks > count) {
+        chunks = (count == 0 ? 1 : count);
+    }
+    if (chunks == 1) {
+        return sum(values, count);
+    }
+    
+    size_t chunkSize = (count + chunks - 1) / chunks;
+    vector<Totals> partials = vector<Totals>(chunks, Totals());
+    WorkerThreads workers(chunks - 1);
+    for (size_t c = 1; c < chunks; c++) {
+        size_t start = c * chunkSize;
+        size_t end = min(count, start + chunkSize);
+        if (start < end) {
+            workers.start(accumulate, values + start, end - start, ref(partials[c]));
+        }
+    }
+    accumulate(values, min(count, chunkSize), partials[0]);
+    workers.join();
+    
+    Totals totals = Totals();
+    for (size_t c = 0; c < chunks; c++) {
+        for (int i = 0; i < 8; i++) {
+            totals[i] += partials[c][i];
+        }
+    }
+    return narrow(totals);
+}
+
+//-----------------------------------------------------------------------
+void PeriodBatch::scale(PeriodType::Values *values, size_t count, int scalar) {
+    if (scalar == 1) {
+        return;
+    }
+    for (size_t n = 0; n < count; n++) {
+        PeriodType::Values &lanes = values[n];
+        int64_t products[8];
+        bool overflow = false;
+        for (int i = 0; i < 8; i++) {
+            products[i] = (int64_t) lanes[i] * scalar;
+            overflow |= (products[i] < INT_MIN) | (products[i] > INT_MAX);
+        }
+        if (overflow) {
+            string err("Multiplication overflows an int: element ");
+            err.append(to_string(n));
+            throw ArithmeticException(err);
+        }
+        for (int i = 0; i < 8; i++) {
+            lanes[i] = (int) products[i];
+        }
+    }
+}
+
+void PeriodBatch::toStandardMillis(const PeriodType::Values *values, size_t count, int64_t *millis) {
+    for (size_t n = 0; n < count; n++) {
+        const PeriodType::Values &lanes = values[n];
+        if ((lanes[PeriodType::YEAR_INDEX] | lanes[PeriodType::MONTH_INDEX]) != 0) {
+            throw UnsupportedOperationException("Cannot convert to Duration as this period contains years or months and they vary in length");
+        }
+        int64_t total = 0;  // no overflow can happen, even with INT_MAX values
+        for (int i = PeriodType::WEEK_INDEX; i < 8; i++) {
+            total += lanes[i] * LANE_MILLIS[i];
+        }
+        millis[n] = total;
+    }
+}
+
+void PeriodBatch::normalizedStandard(PeriodType::Values *values, size_t count, const PeriodType *type) {
+    type = DateTimeUtils::getPeriodType(type);
+    for (size_t n = 0; n < count; n++) {
+        PeriodType::Values &lanes = values[n];
+        int64_t millis = 0;  // no overflow can happen, even with INT_MAX values
+        for (int i = PeriodType::WEEK_INDEX; i < 8; i++) {
+            millis += lanes[i] * LANE_MILLIS[i];
+        }
+        
+        // split into the precise fields, largest first, as the UTC ISO chronology does
+        PeriodType::Values result = PeriodType::Values();
+        for (int i = PeriodType::WEEK_INDEX; i < 8; i++) {
+            if (type->iIndices[i] != -1) {
+                int64_t value = millis / LANE_MILLIS[i];
+                millis -= value * LANE_MILLIS[i];
+                result[i] = FieldUtils::safeToInt(value);
+            }
+        }
+        
+        int64_t totalMonths = lanes[PeriodType::YEAR_INDEX] * 12LL + lanes[PeriodType::MONTH_INDEX];
+        if (totalMonths != 0) {
+            if (type->iIndices[PeriodType::YEAR_INDEX] != -1) {
+                int normalizedYears = FieldUtils::safeToInt(totalMonths / 12);
+                result[PeriodType::YEAR_INDEX] = normalizedYears;
+                totalMonths = totalMonths - (normalizedYears * 12LL);
+            }
+            if (type->iIndices[PeriodType::MONTH_INDEX] != -1) {
+                int normalizedMonths = FieldUtils::safeToInt(totalMonths);
+                result[PeriodType::MONTH_INDEX] = normalizedMonths;
+                totalMonths = totalMonths - normalizedMonths;
+            }
+            if (totalMonths != 0) {
+                throw UnsupportedOperationException("Unable to normalize as PeriodType is missing either years or months but period has a month/year amount");
+            }
+        }
+        lanes = result;
+    }
+}
+
+CODATIME_END
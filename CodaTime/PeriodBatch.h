@@ -0,0 +1,144 @@
+//
+//  PeriodBatch.h
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#ifndef __CodaTime__PeriodBatch__
+#define __CodaTime__PeriodBatch__
+
+#include "CodaTimeMacros.h"
+
+#include "PeriodType.h"
+
+#include <array>
+#include <cstddef>
+
+using namespace std;
+
+CODATIME_BEGIN
+
+class ReadablePeriod;
+
+/**
+ * PeriodBatch provides arithmetic over arrays of period values.
+ * <p>
+ * Each element is a <code>PeriodType::Values</code> in standard order,
+ * that is years, months, weeks, days, hours, minutes, seconds and millis,
+ * whatever the type of the period it came from. Use {@link #expand} to
+ * gather periods into this layout.
+ * <p>
+ * The kernels work lane by lane over plain arrays, so the compiler can
+ * vectorise them. Overflow is checked once per element across all eight
+ * lanes rather than field by field.
+ * <p>
+ * PeriodBatch is thread-safe as it holds no state.
+ */
+class PeriodBatch {
+    
+public:
+    
+    /** Running totals of a sum, one 64 bit lane per standard field */
+    typedef array<int64_t, 8> Totals;
+    
+    /**
+     * Gathers periods into standard order, with unsupported fields as zero.
+     *
+     * @param periods  the periods to read, not null
+     * @param count  the number of periods
+     * @param values  the array to populate, at least count long
+     */
+    static void expand(ReadablePeriod *const *periods, size_t count, PeriodType::Values *values);
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Adds each element into the running totals.
+     * <p>
+     * The totals are 64 bit so no overflow can happen here, and the totals of
+     * separate ranges may simply be added together. This allows a sum to be
+     * split across threads and merged afterwards.
+     *
+     * @param values  the values to add, not null
+     * @param count  the number of elements
+     * @param totals  the totals to update
+     */
+    static void accumulate(const PeriodType::Values *values, size_t count, Totals &totals);
+    
+    /**
+     * Narrows running totals to period values.
+     *
+     * @param totals  the totals to narrow
+     * @return the values in standard order
+     * @throws ArithmeticException if any lane does not fit in an int
+     */
+    static PeriodType::Values narrow(const Totals &totals);
+    
+    /**
+     * Sums each field across all elements.
+     *
+     * @param values  the values to add, not null
+     * @param count  the number of elements
+     * @return the sum in standard order
+     * @throws ArithmeticException if any field overflows
+     */
+    static PeriodType::Values sum(const PeriodType::Values *values, size_t count);
+    
+    /**
+     * Sums each field across all elements, splitting the work across threads.
+     *
+     * @param values  the values to add, not null
+     * @param count  the number of elements
+     * @param threads  the maximum number of threads to use, one or less sums on the calling thread
+     * @return the sum in standard order
+     * @throws ArithmeticException if any field overflows
+     */
+    static PeriodType::Values sum(const PeriodType::Values *values, size_t count, int threads);
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Multiplies each field of each element by a scalar, in place.
+     * <p>
+     * If an element overflows an exception is thrown and that element, and
+     * all following it, are left unchanged.
+     *
+     * @param values  the values to update, not null
+     * @param count  the number of elements
+     * @param scalar  the scalar to multiply by
+     * @throws ArithmeticException if any field overflows
+     */
+    static void scale(PeriodType::Values *values, size_t count, int scalar);
+    
+    /**
+     * Converts each element to a standard duration in milliseconds.
+     * <p>
+     * This matches <code>Period::toStandardDuration</code>, treating weeks as
+     * 7 days, days as 24 hours, hours as 60 minutes and minutes as 60 seconds.
+     *
+     * @param values  the values to convert, not null
+     * @param count  the number of elements
+     * @param millis  the array to populate, at least count long
+     * @throws UnsupportedOperationException if an element contains years or months
+     */
+    static void toStandardMillis(const PeriodType::Values *values, size_t count, int64_t *millis);
+    
+    /**
+     * Normalizes each element to the specified type, in place.
+     * <p>
+     * This matches <code>Period::normalizedStandard(type)</code>. The result
+     * remains in standard order with the fields the type lacks set to zero.
+     *
+     * @param values  the values to update, not null
+     * @param count  the number of elements
+     * @param type  the period type of the result, null means standard
+     * @throws ArithmeticException if any field overflows
+     * @throws UnsupportedOperationException if years or months cannot be normalized into the type
+     */
+    static void normalizedStandard(PeriodType::Values *values, size_t count, const PeriodType *type);
+    
+};
+
+CODATIME_END
+
+#endif /* defined(__CodaTime__PeriodBatch__) */
@@ -13,8 +13,6 @@
 #include "field/FieldUtils.h"
 #include "ReadablePeriod.h"
 
-#include <functional>
-
 CODATIME_BEGIN
 
 int PeriodType::getIndexedField(ReadablePeriod *period, int index) const {
@@ -22,7 +20,7 @@ int PeriodType::getIndexedField(ReadablePeriod *period, int index) const {
     return (realIndex == -1 ? 0 : period->getValue(realIndex));
 }
 
-bool PeriodType::setIndexedField(ReadablePeriod *period, int index, vector<int> values, int newValue) const {
+bool PeriodType::setIndexedField(ReadablePeriod *period, int index, Values &values, int newValue) const {
     int realIndex = iIndices[index];
     if (realIndex == -1) {
         throw UnsupportedOperationException("Field is not supported");
@@ -31,7 +29,7 @@ bool PeriodType::setIndexedField(ReadablePeriod *period, int index, vector<int>
     return true;
 }
 
-bool PeriodType::addIndexedField(ReadablePeriod *period, int index, vector<int> values, int valueToAdd) const {
+bool PeriodType::addIndexedField(ReadablePeriod *period, int index, Values &values, int valueToAdd) const {
     if (valueToAdd == 0) {
         return false;
     }
@@ -43,384 +41,198 @@ bool PeriodType::addIndexedField(ReadablePeriod *period, int index, vector<int>
     return true;
 }
 
-PeriodType::PeriodType(string name, vector<const DurationFieldType*> types, vector<int> indices) {
+PeriodType::PeriodType(string name, int mask) {
+    const DurationFieldType *standardTypes[FIELD_COUNT] = {
+        DurationFieldType::years(), DurationFieldType::months(),
+        DurationFieldType::weeks(), DurationFieldType::days(),
+        DurationFieldType::hours(), DurationFieldType::minutes(),
+        DurationFieldType::seconds(), DurationFieldType::millis(),
+    };
     iName = name;
-    iTypes = types;
-    iIndices = indices;
+    iMask = mask;
+    iIndices = vector<int>(FIELD_COUNT, -1);
+    for (int i = 0; i < FIELD_COUNT; i++) {
+        if ((mask & (1 << i)) != 0) {
+            iIndices[i] = (int) iTypes.size();
+            iTypes.push_back(standardTypes[i]);
+        }
+    }
 }
 
-PeriodType *PeriodType::standard() {
-    PeriodType *type = cStandard;
-    if (type == NULL) {
-        type = new PeriodType(
-                              string("Standard"),
-                              {
-                                  DurationFieldType::years(), DurationFieldType::months(),
-                                  DurationFieldType::weeks(), DurationFieldType::days(),
-                                  DurationFieldType::hours(), DurationFieldType::minutes(),
-                                  DurationFieldType::seconds(), DurationFieldType::millis(),
-                              },
-                              { 0, 1, 2, 3, 4, 5, 6, 7, }
-                              );
-        cStandard = type;
+const array<PeriodType*, PeriodType::TYPE_COUNT> &PeriodType::types() {
+    // initialised exactly once, thread-safe since C++11
+    static const array<PeriodType*, TYPE_COUNT> cTypes = createTypes();
+    return cTypes;
+}
+
+array<PeriodType*, PeriodType::TYPE_COUNT> PeriodType::createTypes() {
+    static const char *const removedNames[FIELD_COUNT] = {
+        "NoYears", "NoMonths", "NoWeeks", "NoDays",
+        "NoHours", "NoMinutes", "NoSeconds", "NoMillis",
+    };
+    array<PeriodType*, TYPE_COUNT> types;
+    types.fill(NULL);
+    
+    types[STANDARD_MASK] = new PeriodType("Standard", STANDARD_MASK);
+    types[YMD_TIME_MASK] = new PeriodType("YearMonthDayTime", YMD_TIME_MASK);
+    types[YMD_MASK] = new PeriodType("YearMonthDay", YMD_MASK);
+    types[YWD_TIME_MASK] = new PeriodType("YearWeekDayTime", YWD_TIME_MASK);
+    types[YWD_MASK] = new PeriodType("YearWeekDay", YWD_MASK);
+    types[YD_TIME_MASK] = new PeriodType("YearDayTime", YD_TIME_MASK);
+    types[YD_MASK] = new PeriodType("YearDay", YD_MASK);
+    types[D_TIME_MASK] = new PeriodType("DayTime", D_TIME_MASK);
+    types[TIME_MASK] = new PeriodType("Time", TIME_MASK);
+    
+    types[1 << YEAR_INDEX] = new PeriodType("Years", 1 << YEAR_INDEX);
+    types[1 << MONTH_INDEX] = new PeriodType("Months", 1 << MONTH_INDEX);
+    types[1 << WEEK_INDEX] = new PeriodType("Weeks", 1 << WEEK_INDEX);
+    types[1 << DAY_INDEX] = new PeriodType("Days", 1 << DAY_INDEX);
+    types[1 << HOUR_INDEX] = new PeriodType("Hours", 1 << HOUR_INDEX);
+    types[1 << MINUTE_INDEX] = new PeriodType("Minutes", 1 << MINUTE_INDEX);
+    types[1 << SECOND_INDEX] = new PeriodType("Seconds", 1 << SECOND_INDEX);
+    types[1 << MILLI_INDEX] = new PeriodType("Millis", 1 << MILLI_INDEX);
+    
+    // the remaining combinations are named as the standard type with fields removed
+    for (int mask = 0; mask < TYPE_COUNT; mask++) {
+        if (types[mask] == NULL) {
+            string name("Standard");
+            for (int i = 0; i < FIELD_COUNT; i++) {
+                if ((mask & (1 << i)) == 0) {
+                    name.append(removedNames[i]);
+                }
+            }
+            types[mask] = new PeriodType(name, mask);
+        }
     }
-    return type;
+    return types;
 }
 
-PeriodType *PeriodType::yearMonthDayTime() {
-    PeriodType *type = cYMDTime;
+int PeriodType::standardIndexOf(const DurationFieldType *type) {
     if (type == NULL) {
-        type = new PeriodType(
-                              "YearMonthDayTime",
-                              {
-                                  DurationFieldType::years(), DurationFieldType::months(),
-                                  DurationFieldType::days(),
-                                  DurationFieldType::hours(), DurationFieldType::minutes(),
-                                  DurationFieldType::seconds(), DurationFieldType::millis(),
-                              },
-                              { 0, 1, -1, 2, 3, 4, 5, 6, }
-                              );
-        cYMDTime = type;
+        return -1;
+    } else if (type == DurationFieldType::years()) {
+        return YEAR_INDEX;
+    } else if (type == DurationFieldType::months()) {
+        return MONTH_INDEX;
+    } else if (type == DurationFieldType::weeks()) {
+        return WEEK_INDEX;
+    } else if (type == DurationFieldType::days()) {
+        return DAY_INDEX;
+    } else if (type == DurationFieldType::hours()) {
+        return HOUR_INDEX;
+    } else if (type == DurationFieldType::minutes()) {
+        return MINUTE_INDEX;
+    } else if (type == DurationFieldType::seconds()) {
+        return SECOND_INDEX;
+    } else if (type == DurationFieldType::millis()) {
+        return MILLI_INDEX;
     }
-    return type;
+    return -1;
+}
+
+PeriodType *PeriodType::standard() {
+    return types()[STANDARD_MASK];
+}
+
+PeriodType *PeriodType::yearMonthDayTime() {
+    return types()[YMD_TIME_MASK];
 }
 
 PeriodType *PeriodType::yearMonthDay() {
-    PeriodType *type = cYMD;
-    if (type == NULL) {
-        type = new PeriodType(
-                              "YearMonthDay",
-                              {
-                                  DurationFieldType::years(), DurationFieldType::months(),
-                                  DurationFieldType::days(),
-                              },
-                              { 0, 1, -1, 2, -1, -1, -1, -1, }
-                              );
-        cYMD = type;
-    }
-    return type;
+    return types()[YMD_MASK];
 }
 
 PeriodType *PeriodType::yearWeekDayTime() {
-    PeriodType *type = cYWDTime;
-    if (type == NULL) {
-        type = new PeriodType(
-                              "YearWeekDayTime",
-                              {
-                                  DurationFieldType::years(),
-                                  DurationFieldType::weeks(), DurationFieldType::days(),
-                                  DurationFieldType::hours(), DurationFieldType::minutes(),
-                                  DurationFieldType::seconds(), DurationFieldType::millis(),
-                              },
-                              { 0, -1, 1, 2, 3, 4, 5, 6, }
-                              );
-        cYWDTime = type;
-    }
-    return type;
+    return types()[YWD_TIME_MASK];
 }
 
 PeriodType *PeriodType::yearWeekDay() {
-    PeriodType *type = cYWD;
-    if (type == NULL) {
-        type = new PeriodType(
-                              "YearWeekDay",
-                              {
-                                  DurationFieldType::years(),
-                                  DurationFieldType::weeks(), DurationFieldType::days(),
-                              },
-                              { 0, -1, 1, 2, -1, -1, -1, -1, }
-                              );
-        cYWD = type;
-    }
-    return type;
+    return types()[YWD_MASK];
 }
 
 PeriodType *PeriodType::yearDayTime() {
-    PeriodType *type = cYDTime;
-    if (type == NULL) {
-        type = new PeriodType(
-                              "YearDayTime",
-                              {
-                                  DurationFieldType::years(), DurationFieldType::days(),
-                                  DurationFieldType::hours(), DurationFieldType::minutes(),
-                                  DurationFieldType::seconds(), DurationFieldType::millis(),
-                              },
-                              { 0, -1, -1, 1, 2, 3, 4, 5, }
-                              );
-        cYDTime = type;
-    }
-    return type;
+    return types()[YD_TIME_MASK];
 }
 
 PeriodType *PeriodType::yearDay() {
-    PeriodType *type = cYD;
-    if (type == NULL) {
-        type = new PeriodType(
-                              "YearDay",
-                              {
-                                  DurationFieldType::years(), DurationFieldType::days(),
-                              },
-                              { 0, -1, -1, 1, -1, -1, -1, -1, }
-                              );
-        cYD = type;
-    }
-    return type;
+    return types()[YD_MASK];
 }
 
 PeriodType *PeriodType::dayTime() {
-    PeriodType *type = cDTime;
-    if (type == NULL) {
-        type = new PeriodType(
-                              "DayTime",
-                              {
-                                  DurationFieldType::days(),
-                                  DurationFieldType::hours(), DurationFieldType::minutes(),
-                                  DurationFieldType::seconds(), DurationFieldType::millis(),
-                              },
-                              { -1, -1, -1, 0, 1, 2, 3, 4, }
-                              );
-        cDTime = type;
-    }
-    return type;
+    return types()[D_TIME_MASK];
 }
 
 PeriodType *PeriodType::time() {
-    PeriodType *type = cTime;
-    if (type == NULL) {
-        type = new PeriodType(
-                              "Time",
-                              {
-                                  DurationFieldType::hours(), DurationFieldType::minutes(),
-                                  DurationFieldType::seconds(), DurationFieldType::millis(),
-                              },
-                              { -1, -1, -1, -1, 0, 1, 2, 3, }
-                              );
-        cTime = type;
-    }
-    return type;
+    return types()[TIME_MASK];
 }
 
 PeriodType *PeriodType::years() {
-    PeriodType *type = cYears;
-    if (type == NULL) {
-        type = new PeriodType(
-                              "Years",
-                              { DurationFieldType::years() },
-                              { 0, -1, -1, -1, -1, -1, -1, -1, }
-                              );
-        cYears = type;
-    }
-    return type;
+    return types()[1 << YEAR_INDEX];
 }
 
 PeriodType *PeriodType::months() {
-    PeriodType *type = cMonths;
-    if (type == NULL) {
-        type = new PeriodType(
-                              "Months",
-                              { DurationFieldType::months() },
-                              { -1, 0, -1, -1, -1, -1, -1, -1 }
-                              );
-        cMonths = type;
-    }
-    return type;
+    return types()[1 << MONTH_INDEX];
 }
 
 PeriodType *PeriodType::weeks() {
-    PeriodType *type = cWeeks;
-    if (type == NULL) {
-        type = new PeriodType(
-                              "Weeks",
-                              { DurationFieldType::weeks() },
-                              { -1, -1, 0, -1, -1, -1, -1, -1 }
-                              );
-        cWeeks = type;
-    }
-    return type;
+    return types()[1 << WEEK_INDEX];
 }
 
 PeriodType *PeriodType::days() {
-    PeriodType *type = cDays;
-    if (type == NULL) {
-        type = new PeriodType(
-                              "Days",
-                              { DurationFieldType::days() },
-                              { -1, -1, -1, 0, -1, -1, -1, -1 }
-                              );
-        cDays = type;
-    }
-    return type;
+    return types()[1 << DAY_INDEX];
 }
 
 PeriodType *PeriodType::hours() {
-    PeriodType *type = cHours;
-    if (type == NULL) {
-        type = new PeriodType(
-                              "Hours",
-                              { DurationFieldType::hours() },
-                              { -1, -1, -1, -1, 0, -1, -1, -1 }
-                              );
-        cHours = type;
-    }
-    return type;
+    return types()[1 << HOUR_INDEX];
 }
 
 PeriodType *PeriodType::minutes() {
-    PeriodType *type = cMinutes;
-    if (type == NULL) {
-        type = new PeriodType(
-                              "Minutes",
-                              { DurationFieldType::minutes() },
-                              { -1, -1, -1, -1, -1, 0, -1, -1 }
-                              );
-        cMinutes = type;
-    }
-    return type;
+    return types()[1 << MINUTE_INDEX];
 }
 
 PeriodType *PeriodType::seconds() {
-    PeriodType *type = cSeconds;
-    if (type == NULL) {
-        type = new PeriodType(
-                              "Seconds",
-                              { DurationFieldType::seconds() },
-                              { -1, -1, -1, -1, -1, -1, 0, -1 }
-                              );
-        cSeconds = type;
-    }
-    return type;
+    return types()[1 << SECOND_INDEX];
 }
 
 PeriodType *PeriodType::millis() {
-    PeriodType *type = cMillis;
-    if (type == NULL) {
-        type = new PeriodType(
-                              "Millis",
-                              { DurationFieldType::millis() },
-                              { -1, -1, -1, -1, -1, -1, -1, 0}
-                              );
-        cMillis = type;
-    }
-    return type;
+    return types()[1 << MILLI_INDEX];
 }
 
-// TODO: synchronized
-PeriodType *PeriodType::forFields(vector<const DurationFieldType*> types) {
-    if (!types.empty() || types.size() == 0) {
+PeriodType *PeriodType::forFields(const vector<const DurationFieldType*> &types) {
+    if (types.empty()) {
         throw IllegalArgumentException("Types array must not be NULL or empty");
     }
+    int mask = 0;
+    string unsupported;
     for (int i = 0; i < types.size(); i++) {
         if (types[i] == NULL) {
             throw IllegalArgumentException("Types array must not contain NULL");
         }
+        int index = standardIndexOf(types[i]);
+        if (index == -1 || (mask & (1 << index)) != 0) {
+            if (!unsupported.empty()) {
+                unsupported.append(", ");
+            }
+            unsupported.append(types[i]->getName());
+        } else {
+            mask |= (1 << index);
+        }
     }
-    map<PeriodType*, Object*> &cache = cTypes;
-    if (cache.empty()) {
-        cache[standard()] = standard();
-        cache[yearMonthDayTime()] = yearMonthDayTime();
-        cache[yearMonthDay()] = yearMonthDay();
-        cache[yearWeekDayTime()] = yearWeekDayTime();
-        cache[yearWeekDay()] = yearWeekDay();
-        cache[yearDayTime()] = yearDayTime();
-        cache[yearDay()] = yearDay();
-        cache[dayTime()] = dayTime();
-        cache[time()] = time();
-        cache[years()] = years();
-        cache[months()] = months();
-        cache[weeks()] = weeks();
-        cache[days()] = days();
-        cache[hours()] = hours();
-        cache[minutes()] = minutes();
-        cache[seconds()] = seconds();
-        cache[millis()] = millis();
-    }
-    
-    PeriodType *inPartType = new PeriodType(string(), types, vector<int>());
-    Object *cached = cache[inPartType];
-    
-    PeriodType *periodType = dynamic_cast<PeriodType*>(cached);
-    if (periodType != 0) {
-        return periodType;
-    }
-    if (cached != NULL) {
+    if (!unsupported.empty()) {
         string err("PeriodType does not support fields: ");
-        err.append(cached->toString());
+        err.append(unsupported);
         throw IllegalArgumentException(err);
     }
-    
-    PeriodType *type = standard();
-    typedef vector<const DurationFieldType*>::iterator iter;
-    iter it = find(types.begin(), types.end(), DurationFieldType::years());
-    
-    if (it == types.end()) {
-        type = type->withYearsRemoved();
-    } else {
-        types.erase(it);
-    }
-    
-    it = find(types.begin(), types.end(), DurationFieldType::months());
-    if (it == types.end()) {
-        type = type->withMonthsRemoved();
-    } else {
-        types.erase(it);
-    }
-    
-    it = find(types.begin(), types.end(), DurationFieldType::weeks());
-    if (it == types.end()) {
-        type = type->withWeeksRemoved();
-    } else {
-        types.erase(it);
-    }
-    
-    it = find(types.begin(), types.end(), DurationFieldType::days());
-    if (it == types.end()) {
-        type = type->withDaysRemoved();
-    } else {
-        types.erase(it);
-    }
-    
-    it = find(types.begin(), types.end(), DurationFieldType::hours());
-    if (it == types.end()) {
-        type = type->withHoursRemoved();
-    } else {
-        types.erase(it);
-    }
-    
-    it = find(types.begin(), types.end(), DurationFieldType::minutes());
-    if (it == types.end()) {
-        type = type->withMinutesRemoved();
-    } else {
-        types.erase(it);
-    }
-    
-    it = find(types.begin(), types.end(), DurationFieldType::seconds());
-    if (it == types.end()) {
-        type = type->withSecondsRemoved();
-    } else {
-        types.erase(it);
-    }
-    
-    it = find(types.begin(), types.end(), DurationFieldType::millis());
-    if (it == types.end()) {
-        type = type->withMillisRemoved();
-    } else {
-        types.erase(it);
-    }
-    if (types.size() > 0) {
-//        cache[inPartType] = list;
-        string err("PeriodType does not support fields: ");
-//        err.append(list);
+    return PeriodType::types()[mask];
+}
+
+PeriodType *PeriodType::forFieldMask(int mask) {
+    if (mask < 0 || mask >= TYPE_COUNT) {
+        string err("Invalid period type mask: ");
+        err.append(to_string(mask));
         throw IllegalArgumentException(err);
     }
-    // recheck cache in case initial array order was wrong
-    PeriodType *checkPartType = new PeriodType(string(), type->iTypes, vector<int>());
-    PeriodType *checkedType = dynamic_cast<PeriodType*>(cache[checkPartType]);
-    if (checkedType != NULL) {
-        cache[checkPartType] = checkedType;
-        return checkedType;
-    }
-    cache[checkPartType] = type;
-    return type;
+    return types()[mask];
 }
 
 //-----------------------------------------------------------------------
@@ -441,12 +253,8 @@ bool PeriodType::isSupported(const DurationFieldType *type) const {
 }
 
 int PeriodType::indexOf(const DurationFieldType *type) const {
-    for (int i = 0, isize = size(); i < isize; i++) {
-        if (iTypes[i] == type) {
-            return i;
-        }
-    }
-    return -1;
+    int index = standardIndexOf(type);
+    return (index == -1 ? -1 : iIndices[index]);
 }
 
 string PeriodType::toString() {
@@ -457,68 +265,40 @@ string PeriodType::toString() {
 }
 
 //-----------------------------------------------------------------------
-PeriodType *PeriodType::withYearsRemoved() {
-    return withFieldRemoved(0, "NoYears");
+PeriodType *PeriodType::withYearsRemoved() const {
+    return withFieldRemoved(0);
 }
 
-PeriodType *PeriodType::withMonthsRemoved() {
-    return withFieldRemoved(1, "NoMonths");
+PeriodType *PeriodType::withMonthsRemoved() const {
+    return withFieldRemoved(1);
 }
 
-PeriodType *PeriodType::withWeeksRemoved() {
-    return withFieldRemoved(2, "NoWeeks");
+PeriodType *PeriodType::withWeeksRemoved() const {
+    return withFieldRemoved(2);
 }
 
-PeriodType *PeriodType::withDaysRemoved() {
-    return withFieldRemoved(3, "NoDays");
+PeriodType *PeriodType::withDaysRemoved() const {
+    return withFieldRemoved(3);
 }
 
-PeriodType *PeriodType::withHoursRemoved() {
-    return withFieldRemoved(4, "NoHours");
+PeriodType *PeriodType::withHoursRemoved() const {
+    return withFieldRemoved(4);
 }
 
-PeriodType *PeriodType::withMinutesRemoved() {
-    return withFieldRemoved(5, "NoMinutes");
+PeriodType *PeriodType::withMinutesRemoved() const {
+    return withFieldRemoved(5);
 }
 
-PeriodType *PeriodType::withSecondsRemoved() {
-    return withFieldRemoved(6, "NoSeconds");
+PeriodType *PeriodType::withSecondsRemoved() const {
+    return withFieldRemoved(6);
 }
 
-PeriodType *PeriodType::withMillisRemoved() {
-    return withFieldRemoved(7, "NoMillis");
+PeriodType *PeriodType::withMillisRemoved() const {
+    return withFieldRemoved(7);
 }
 
-PeriodType *PeriodType::withFieldRemoved(int indicesIndex, string name) {
-    int fieldIndex = iIndices[indicesIndex];
-    if (fieldIndex == -1) {
-        return this;
-    }
-    
-    vector<const DurationFieldType*> types = vector<const DurationFieldType*>(size() - 1);
-    for (int i = 0; i < iTypes.size(); i++) {
-        if (i < fieldIndex) {
-            types[i] = iTypes[i];
-        } else if (i > fieldIndex) {
-            types[i - 1] = iTypes[i];
-        }
-    }
-    
-    vector<int> indices = vector<int>(8);
-    for (int i = 0; i < indices.size(); i++) {
-        if (i < indicesIndex) {
-            indices[i] = iIndices[i];
-        } else if (i > indicesIndex) {
-            indices[i] = (iIndices[i] == -1 ? -1 : iIndices[i] - 1);
-        } else {
-            indices[i] = -1;
-        }
-    }
-    
-    string mname(getName());
-    mname.append(name);
-    
-    return new PeriodType(mname, types, indices);
+PeriodType *PeriodType::withFieldRemoved(int indicesIndex) const {
+    return types()[iMask & ~(1 << indicesIndex)];
 }
 
 //-----------------------------------------------------------------------
@@ -530,16 +310,11 @@ bool PeriodType::equals(const Object *obj) const {
     if (other == 0) {
         return false;
     }
-    return iTypes == other->iTypes;
+    return iMask == other->iMask;
 }
 
 int PeriodType::hashCode() {
-    hash<const DurationFieldType*> hashFn;
-    int hash = 0;
-    for (int i = 0; i < iTypes.size(); i++) {
-        hash += hashFn(iTypes[i]);
-    }
-    return hash;
+    return iMask;
 }
 
 CODATIME_END
\ No newline at end of file
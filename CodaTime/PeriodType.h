@@ -13,8 +13,8 @@
 
 #include "Object.h"
 
+#include <array>
 #include <vector>
-#include <map>
 #include <string>
 
 using namespace std;
@@ -51,17 +51,17 @@ class ReadablePeriod;
  */
 class PeriodType : public virtual Object {
     
+    friend class BinaryDecoder;
+    friend class BinaryEncoder;
     friend class Period;
     friend class MutablePeriod;
+    friend class PeriodBatch;
     
 private:
     
     /** Serialization version */
     static const long long serialVersionUID = 2274324892792009998L;
     
-    /** Cache of all the known types. */
-    static map<PeriodType*, Object*> cTypes;
-    
     static const int YEAR_INDEX = 0;
     static const int MONTH_INDEX = 1;
     static const int WEEK_INDEX = 2;
@@ -71,24 +71,44 @@ private:
     static const int SECOND_INDEX = 6;
     static const int MILLI_INDEX = 7;
     
-    static PeriodType *cStandard;
-    static PeriodType *cYMDTime;
-    static PeriodType *cYMD;
-    static PeriodType *cYWDTime;
-    static PeriodType *cYWD;
-    static PeriodType *cYDTime;
-    static PeriodType *cYD;
-    static PeriodType *cDTime;
-    static PeriodType *cTime;
-    
-    static PeriodType *cYears;
-    static PeriodType *cMonths;
-    static PeriodType *cWeeks;
-    static PeriodType *cDays;
-    static PeriodType *cHours;
-    static PeriodType *cMinutes;
-    static PeriodType *cSeconds;
-    static PeriodType *cMillis;
+    /** The number of standard fields a type may support */
+    static const int FIELD_COUNT = 8;
+    /** The number of distinct types, one per field mask */
+    static const int TYPE_COUNT = 1 << FIELD_COUNT;
+    
+    static const int STANDARD_MASK = 0xFF;
+    static const int YMD_TIME_MASK = 0xFB;
+    static const int YMD_MASK = 0x0B;
+    static const int YWD_TIME_MASK = 0xFD;
+    static const int YWD_MASK = 0x0D;
+    static const int YD_TIME_MASK = 0xF9;
+    static const int YD_MASK = 0x09;
+    static const int D_TIME_MASK = 0xF8;
+    static const int TIME_MASK = 0xF0;
+    
+    /**
+     * Gets the table of all the known types, indexed by field mask.
+     * <p>
+     * The table is built once, on first use, and never modified afterwards.
+     *
+     * @return the table of types
+     */
+    static const array<PeriodType*, TYPE_COUNT> &types();
+    
+    /**
+     * Builds the table of all the known types.
+     *
+     * @return the populated table
+     */
+    static array<PeriodType*, TYPE_COUNT> createTypes();
+    
+    /**
+     * Gets the index of one of the eight standard duration field types.
+     *
+     * @param type  the type to look up, may be null
+     * @return the standard index, -1 if not a standard period field
+     */
+    static int standardIndexOf(const DurationFieldType *type);
     
     //-----------------------------------------------------------------------
     /** The name of the type */
@@ -97,6 +117,8 @@ private:
     vector<const DurationFieldType*> iTypes;
     /** The array of indices */
     vector<int> iIndices;
+    /** The mask of supported fields, bit n set if index n is supported */
+    int iMask;
     
     //-----------------------------------------------------------------------
     /**
@@ -117,7 +139,7 @@ private:
      * @param newValue  the value to set
      * @throws UnsupportedOperationException if not supported
      */
-    bool setIndexedField(ReadablePeriod *period, int index, vector<int> values, int newValue) const;
+    bool setIndexedField(ReadablePeriod *period, int index, array<int, FIELD_COUNT> &values, int newValue) const;
     
     /**
      * Adds to the indexed field part of the period.
@@ -129,30 +151,34 @@ private:
      * @return true if the array is updated
      * @throws UnsupportedOperationException if not supported
      */
-    bool addIndexedField(ReadablePeriod *period, int index, vector<int> values, int valueToAdd) const;
+    bool addIndexedField(ReadablePeriod *period, int index, array<int, FIELD_COUNT> &values, int valueToAdd) const;
     
     /**
      * Removes the field specified by indices index.
      *
      * @param indicesIndex  the index to remove
-     * @param name  the name addition
-     * @return the new type
+     * @return the type without the field
      */
-    PeriodType *withFieldRemoved(int indicesIndex, string name);
-    
-protected:
+    PeriodType *withFieldRemoved(int indicesIndex) const;
     
     /**
      * Constructor.
      *
      * @param name  the name
-     * @param types  the types
-     * @param indices  the indices
+     * @param mask  the mask of supported fields
      */
-    PeriodType(string name, vector<const DurationFieldType*> types, vector<int> indices);
+    PeriodType(string name, int mask);
     
 public:
     
+    /**
+     * Fixed size storage for the values of a period of any type.
+     * <p>
+     * Values are held in the order of the type's fields, largest first,
+     * with unused trailing entries left as zero.
+     */
+    typedef array<int, FIELD_COUNT> Values;
+    
     /**
      * Gets a type that defines all standard fields.
      * <ul>
@@ -347,8 +373,18 @@ public:
      * @return the period type
      * @since 1.1
      */
-    // TODO: synchronized
-    static PeriodType *forFields(vector<const DurationFieldType*> types);
+    static PeriodType *forFields(const vector<const DurationFieldType*> &types);
+    
+    /**
+     * Gets the period type that supports the fields in the mask.
+     * <p>
+     * Bit 0 is years, bit 1 months, through to bit 7 for millis.
+     *
+     * @param mask  the mask of fields, from 0 to 255
+     * @return the period type
+     * @throws IllegalArgumentException if the mask is out of range
+     */
+    static PeriodType *forFieldMask(int mask);
     
     //-----------------------------------------------------------------------
     /**
@@ -390,6 +426,13 @@ public:
      */
     int indexOf(const DurationFieldType *type) const;
     
+    /**
+     * Gets the mask of fields supported by this type.
+     *
+     * @return the mask, bit 0 is years through to bit 7 for millis
+     */
+    int getFieldMask() const { return iMask; }
+    
     /**
      * Gets a debugging to string.
      *
@@ -403,56 +446,56 @@ public:
      *
      * @return a new period type that supports the original set of fields except years
      */
-    PeriodType *withYearsRemoved();
+    PeriodType *withYearsRemoved() const;
     
     /**
      * Returns a version of this PeriodType instance that does not support months.
      *
      * @return a new period type that supports the original set of fields except months
      */
-    PeriodType *withMonthsRemoved();
+    PeriodType *withMonthsRemoved() const;
     
     /**
      * Returns a version of this PeriodType instance that does not support weeks.
      *
      * @return a new period type that supports the original set of fields except weeks
      */
-    PeriodType *withWeeksRemoved();
+    PeriodType *withWeeksRemoved() const;
     
     /**
      * Returns a version of this PeriodType instance that does not support days.
      *
      * @return a new period type that supports the original set of fields except days
      */
-    PeriodType *withDaysRemoved();
+    PeriodType *withDaysRemoved() const;
     
     /**
      * Returns a version of this PeriodType instance that does not support hours.
      *
      * @return a new period type that supports the original set of fields except hours
      */
-    PeriodType *withHoursRemoved();
+    PeriodType *withHoursRemoved() const;
     
     /**
      * Returns a version of this PeriodType instance that does not support minutes.
      *
      * @return a new period type that supports the original set of fields except minutes
      */
-    PeriodType *withMinutesRemoved();
+    PeriodType *withMinutesRemoved() const;
     
     /**
      * Returns a version of this PeriodType instance that does not support seconds.
      *
      * @return a new period type that supports the original set of fields except seconds
      */
-    PeriodType *withSecondsRemoved();
+    PeriodType *withSecondsRemoved() const;
     
     /**
      * Returns a version of this PeriodType instance that does not support milliseconds.
      *
      * @return a new period type that supports the original set of fields except milliseconds
      */
-    PeriodType *withMillisRemoved();
+    PeriodType *withMillisRemoved() const;
     
     //-----------------------------------------------------------------------
     /**
@@ -20,6 +20,7 @@ using namespace std;
 
 CODATIME_BEGIN
 
+class BaseLocal;
 class Chronology;
 class DateTimeFieldType;
 class DateTimeField;
@@ -109,6 +110,19 @@ public:
      */
     virtual DateTime *toDateTime(ReadableInstant *baseInstant) = 0;
     
+    /**
+     * Gets this partial as a local partial, if it is one.
+     * <p>
+     * Local partials hold their fields as local millis, so two of the same
+     * kind may be compared without reading each field. This avoids the
+     * dynamic_cast that would otherwise be needed to find out.
+     *
+     * @return this partial as a BaseLocal, NULL if it is not one
+     */
+    virtual const BaseLocal *getBaseLocal() const {
+        return NULL;
+    }
+    
     //-----------------------------------------------------------------------
     /**
      * Compares this partial with the specified object for equality based
@@ -0,0 +1,193 @@
+//
+//  Resampler.cpp
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#include "Resampler.h"
+
+#include "Chronology.h"
+#include "DateTimeField.h"
+#include "DateTimeFieldType.h"
+#include "DateTimeUtils.h"
+#include "DateTimeZone.h"
+#include "DurationField.h"
+#include "DurationFieldType.h"
+#include "Exceptions.h"
+#include "field/FieldUtils.h"
+#include "WorkerThreads.h"
+
+#include <algorithm>
+#include <string>
+
+CODATIME_BEGIN
+
+Resampler::Resampler(const DurationFieldType *unit, int multiple, Chronology *chrono) {
+    if (unit == NULL) {
+        throw IllegalArgumentException("The DurationFieldType must not be null");
+    }
+    if (multiple < 1) {
+        string err("Multiple must be at least one: ");
+        err.append(to_string(multiple));
+        throw IllegalArgumentException(err);
+    }
+    
+    // each unit is floored by the field it counts
+    const DateTimeFieldType *floorType = NULL;
+    if (unit == DurationFieldType::years()) {
+        floorType = DateTimeFieldType::year();
+    } else if (unit == DurationFieldType::months()) {
+        floorType = DateTimeFieldType::monthOfYear();
+    } else if (unit == DurationFieldType::weeks()) {
+        floorType = DateTimeFieldType::weekOfWeekyear();
+    } else if (unit == DurationFieldType::days()) {
+        floorType = DateTimeFieldType::dayOfMonth();
+    } else if (unit == DurationFieldType::hours()) {
+        floorType = DateTimeFieldType::hourOfDay();
+    } else if (unit == DurationFieldType::minutes()) {
+        floorType = DateTimeFieldType::minuteOfHour();
+    } else if (unit == DurationFieldType::seconds()) {
+        floorType = DateTimeFieldType::secondOfMinute();
+    } else if (unit == DurationFieldType::millis()) {
+        floorType = DateTimeFieldType::millisOfSecond();
+    } else {
+        string err("Unit not supported by Resampler: ");
+        err.append(unit->getName());
+        throw IllegalArgumentException(err);
+    }
+    
+    iUnit = unit;
+    iMultiple = multiple;
+    iChronology = DateTimeUtils::getChronology(chrono);
+    iZone = iChronology->getZone();
+    Chronology *local = iChronology->withUTC();
+    iFloorField = floorType->getField(local);
+    iUnitField = unit->getField(local);
+    iOrigin = iFloorField->roundFloor(0);
+}
+
+const DurationFieldType *Resampler::getUnit() const {
+    return iUnit;
+}
+
+int Resampler::getMultiple() const {
+    return iMultiple;
+}
+
+Chronology *Resampler::getChronology() const {
+    return iChronology;
+}
+
+//-----------------------------------------------------------------------
+int64_t Resampler::getBucketNumber(int64_t instant) const {
+    int64_t local = iFloorField->roundFloor(iZone->convertUTCToLocal(instant));
+    int64_t units = iUnitField->getDifferenceAsLong(local, iOrigin);
+    int64_t number = units / iMultiple;
+    if (units % iMultiple < 0) {
+        number--;
+    }
+    return number;
+}
+
+int64_t Resampler::getBucketStart(int64_t number) const {
+    int64_t local = iUnitField->add(iOrigin, FieldUtils::safeMultiply(number, iMultiple));
+    int64_t start = iZone->convertLocalToUTC(local, false);
+    // a local time in a gap is moved past the gap by its length, which can
+    // put the start after that of the next bucket, so it is moved back to
+    // the transition that ends the gap
+    int64_t gap = iZone->convertUTCToLocal(start) - local;
+    if (gap > 0) {
+        start = iZone->nextTransition(start - gap);
+    }
+    return start;
+}
+
+int64_t Resampler::roundFloor(int64_t instant) const {
+    return getBucketStart(getBucketNumber(instant));
+}
+
+//-----------------------------------------------------------------------
+void Resampler::fillBoundaries(const Resampler *resampler, int64_t firstNumber, size_t count, int64_t *boundaries) {
+    for (size_t i = 0; i < count; i++) {
+        boundaries[i] = resampler->getBucketStart(firstNumber + (int64_t) i);
+    }
+}
+
+void Resampler::assignIndexes(const int64_t *instants, size_t count, const int64_t *boundaries, size_t bucketCount, size_t *indexes) {
+    size_t bucket = upper_bound(boundaries, boundaries + bucketCount, instants[0]) - boundaries;
+    bucket = (bucket == 0 ? 0 : bucket - 1);
+    for (size_t i = 0; i < count; i++) {
+        while (bucket + 1 < bucketCount && boundaries[bucket + 1] <= instants[i]) {
+            bucket++;
+        }
+        indexes[i] = bucket;
+    }
+}
+
+void Resampler::resample(const int64_t *instants, size_t count, vector<int64_t> &boundaries, vector<size_t> &indexes) const {
+    resample(instants, count, boundaries, indexes, 1);
+}
+
+void Resampler::resample(const int64_t *instants, size_t count, vector<int64_t> &boundaries, vector<size_t> &indexes, int threads) const {
+    boundaries.clear();
+    indexes.clear();
+    if (count == 0) {
+        return;
+    }
+    if (is_sorted(instants, instants + count) == false) {
+        throw IllegalArgumentException("The instants must be sorted");
+    }
+    
+    size_t chunks = (threads < 1 ? 1 : (size_t) threads);
+    chunks = min(chunks, count);
+    size_t chunkSize = (count + chunks - 1) / chunks;
+    chunks = (count + chunkSize - 1) / chunkSize;
+    
+    // bucket numbers are found from local time, so each partition finds its
+    // own; a fall back transition can move local time backwards, so they are
+    // kept in order
+    vector<int64_t> numbers = vector<int64_t>(chunks + 1);
+    numbers[0] = getBucketNumber(instants[0]);
+    for (size_t c = 1; c < chunks; c++) {
+        numbers[c] = max(numbers[c - 1], getBucketNumber(instants[c * chunkSize]));
+    }
+    int64_t lastNumber = max(numbers[chunks - 1], getBucketNumber(instants[count - 1]));
+    // the numbers are ordered, so the unsigned difference cannot overflow
+    uint64_t span = ((uint64_t) lastNumber) - ((uint64_t) numbers[0]);
+    if (span >= MAX_BUCKET_COUNT) {
+        string err("The instants span too many buckets: ");
+        err.append(to_string(span + 1));
+        err.append(", the limit is ");
+        err.append(to_string((uint64_t) MAX_BUCKET_COUNT));
+        throw IllegalArgumentException(err);
+    }
+    numbers[chunks] = lastNumber + 1;
+    size_t bucketCount = (size_t) span + 1;
+    
+    // the outer boundaries are found here first, so that any overflow is
+    // thrown on the calling thread rather than a worker
+    boundaries.resize(bucketCount + 1);
+    boundaries[0] = getBucketStart(numbers[0]);
+    boundaries[bucketCount] = getBucketStart(lastNumber + 1);
+    
+    WorkerThreads workers(chunks - 1);
+    for (size_t c = 1; c < chunks; c++) {
+        size_t offset = (size_t) (numbers[c] - numbers[0]);
+        workers.start(fillBoundaries, this, numbers[c], (size_t) (numbers[c + 1] - numbers[c]), &boundaries[offset]);
+    }
+    fillBoundaries(this, numbers[0], (size_t) (numbers[1] - numbers[0]), &boundaries[0]);
+    workers.join();
+    
+    indexes.resize(count);
+    for (size_t c = 1; c < chunks; c++) {
+        size_t start = c * chunkSize;
+        size_t end = min(count, start + chunkSize);
+        workers.start(assignIndexes, instants + start, end - start, &boundaries[0], bucketCount, &indexes[start]);
+    }
+    assignIndexes(instants, min(count, chunkSize), &boundaries[0], bucketCount, &indexes[0]);
+    workers.join();
+}
+
+CODATIME_END
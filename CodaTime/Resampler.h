@@ -0,0 +1,139 @@
+//
+//  Resampler.h
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#ifndef __CodaTime__Resampler__
+#define __CodaTime__Resampler__
+
+#include "CodaTimeMacros.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using namespace std;
+
+CODATIME_BEGIN
+
+class Chronology;
+class DateTimeField;
+class DateTimeZone;
+class DurationField;
+class DurationFieldType;
+
+/**
+ * Resampler assigns sorted instants to calendar buckets, such as days in a
+ * time zone, ISO weeks or months.
+ * <p>
+ * A bucket is a whole number of one unit, from years down to millis, laid
+ * out on the local time-line of the chronology's zone. A day bucket runs
+ * from local midnight to local midnight, so it is 23 or 25 hours long when
+ * the zone changes offset. Multiples of a unit are aligned to the local
+ * epoch, so three months gives calendar quarters and six hours starts at
+ * midnight and noon. Weeks start on Monday.
+ * <p>
+ * {@link #resample} produces the boundaries of every bucket from the first
+ * instant to the last, including empty buckets, and the bucket of each
+ * instant. The boundaries are found from the bucket number of each local
+ * time, so the input can be split into partitions that run in parallel
+ * without walking the calendar from the start. The instants are then
+ * assigned in a single pass per partition.
+ * <p>
+ * Buckets that start in a daylight savings gap start at the end of the gap,
+ * the instant of the transition, so a bucket that lies entirely within a gap
+ * is empty and the boundaries never decrease.
+ * <p>
+ * Resampler is thread-safe and immutable.
+ */
+class Resampler {
+    
+private:
+    
+    const DurationFieldType *iUnit;
+    int iMultiple;
+    Chronology *iChronology;
+    DateTimeZone *iZone;
+    const DateTimeField *iFloorField;
+    const DurationField *iUnitField;
+    int64_t iOrigin;
+    
+    int64_t getBucketNumber(int64_t instant) const;
+    int64_t getBucketStart(int64_t number) const;
+    
+    static void fillBoundaries(const Resampler *resampler, int64_t firstNumber, size_t count, int64_t *boundaries);
+    static void assignIndexes(const int64_t *instants, size_t count, const int64_t *boundaries, size_t bucketCount, size_t *indexes);
+    
+public:
+    
+    /**
+     * The most buckets that one call to {@link #resample} will produce.
+     * This bounds the boundaries vector at 128MB, so a fine unit over a
+     * long span of instants is reported rather than exhausting memory.
+     */
+    static const size_t MAX_BUCKET_COUNT = 1 << 24;
+    
+    /**
+     * Creates a resampler.
+     *
+     * @param unit  the unit of each bucket, from years to millis except halfdays and weekyears
+     * @param multiple  the number of units in each bucket, at least one
+     * @param chrono  the chronology, null means ISO in the default zone
+     * @throws IllegalArgumentException if the unit is null or not supported, or the multiple is less than one
+     */
+    Resampler(const DurationFieldType *unit, int multiple, Chronology *chrono);
+    
+    const DurationFieldType *getUnit() const;
+    
+    int getMultiple() const;
+    
+    Chronology *getChronology() const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Gets the start of the bucket containing an instant.
+     *
+     * @param instant  the instant
+     * @return the start of its bucket
+     */
+    int64_t roundFloor(int64_t instant) const;
+    
+    /**
+     * Assigns instants to buckets.
+     * <p>
+     * The boundaries hold the start of each bucket, from the bucket of the
+     * first instant to the bucket of the last, followed by the end of the
+     * last bucket. Bucket <code>i</code> therefore runs from
+     * <code>boundaries[i]</code> inclusive to <code>boundaries[i + 1]</code>
+     * exclusive. Both vectors are cleared if there are no instants.
+     *
+     * @param instants  the instants, in ascending order
+     * @param count  the number of instants
+     * @param boundaries  the vector to populate with the bucket boundaries
+     * @param indexes  the vector to populate with the bucket of each instant
+     * @throws IllegalArgumentException if the instants are not sorted, or span more than MAX_BUCKET_COUNT buckets
+     */
+    void resample(const int64_t *instants, size_t count, vector<int64_t> &boundaries, vector<size_t> &indexes) const;
+    
+    /**
+     * Assigns instants to buckets, splitting the work across threads.
+     * <p>
+     * The result is the same as {@link #resample(const int64_t *, size_t, vector<int64_t> &, vector<size_t> &)}.
+     *
+     * @param instants  the instants, in ascending order
+     * @param count  the number of instants
+     * @param boundaries  the vector to populate with the bucket boundaries
+     * @param indexes  the vector to populate with the bucket of each instant
+     * @param threads  the number of threads to use, including the calling thread
+     * @throws IllegalArgumentException if the instants are not sorted, or span more than MAX_BUCKET_COUNT buckets
+     */
+    void resample(const int64_t *instants, size_t count, vector<int64_t> &boundaries, vector<size_t> &indexes, int threads) const;
+    
+};
+
+CODATIME_END
+
+#endif /* defined(__CodaTime__Resampler__) */
@@ -0,0 +1,133 @@
+//
+//  Seconds.cpp
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#include "Seconds.h"
+
+#include "DateTimeConstants.h"
+#include "Days.h"
+#include "Duration.h"
+#include "DurationFieldType.h"
+#include "Hours.h"
+#include "Minutes.h"
+#include "Period.h"
+#include "PeriodType.h"
+#include "Weeks.h"
+#include "field/FieldUtils.h"
+
+#include <climits>
+
+CODATIME_BEGIN
+
+const Seconds Seconds::ZERO = Seconds(0);
+const Seconds Seconds::ONE = Seconds(1);
+const Seconds Seconds::TWO = Seconds(2);
+const Seconds Seconds::THREE = Seconds(3);
+const Seconds Seconds::MAX_VALUE = Seconds(INT_MAX);
+const Seconds Seconds::MIN_VALUE = Seconds(INT_MIN);
+
+//-----------------------------------------------------------------------
+Seconds Seconds::secondsBetween(ReadableInstant *start, ReadableInstant *end) {
+    return Seconds(BaseSingleFieldPeriod::between(start, end, DurationFieldType::seconds()));
+}
+
+Seconds Seconds::secondsBetween(ReadablePartial *start, ReadablePartial *end) {
+    return Seconds(BaseSingleFieldPeriod::between(start, end, DurationFieldType::seconds()));
+}
+
+Seconds Seconds::secondsIn(ReadableInterval *interval) {
+    return Seconds(BaseSingleFieldPeriod::between(interval, DurationFieldType::seconds()));
+}
+
+Seconds Seconds::standardSecondsIn(ReadablePeriod *period) {
+    return Seconds(BaseSingleFieldPeriod::standardPeriodIn(period, DateTimeConstants::MILLIS_PER_SECOND));
+}
+
+//-----------------------------------------------------------------------
+const DurationFieldType *Seconds::getFieldType() const {
+    return DurationFieldType::seconds();
+}
+
+PeriodType *Seconds::getPeriodType() const {
+    return PeriodType::seconds();
+}
+
+//-----------------------------------------------------------------------
+Weeks Seconds::toStandardWeeks() const {
+    return Weeks::weeks(getValue() / DateTimeConstants::SECONDS_PER_WEEK);
+}
+
+Days Seconds::toStandardDays() const {
+    return Days::days(getValue() / DateTimeConstants::SECONDS_PER_DAY);
+}
+
+Hours Seconds::toStandardHours() const {
+    return Hours::hours(getValue() / DateTimeConstants::SECONDS_PER_HOUR);
+}
+
+Minutes Seconds::toStandardMinutes() const {
+    return Minutes::minutes(getValue() / DateTimeConstants::SECONDS_PER_MINUTE);
+}
+
+Duration *Seconds::toStandardDuration() const {
+    int64_t seconds = getValue();  // assign to a int64_t
+    return new Duration(seconds * DateTimeConstants::MILLIS_PER_SECOND);
+}
+
+Period *Seconds::toPeriod() const {
+    return Period::seconds(getValue());
+}
+
+//-----------------------------------------------------------------------
+Seconds Seconds::plus(int seconds) const {
+    if (seconds == 0) {
+        return *this;
+    }
+    return Seconds::seconds(FieldUtils::safeAdd(getValue(), seconds));
+}
+
+Seconds Seconds::plus(const Seconds &seconds) const {
+    return plus(seconds.getValue());
+}
+
+Seconds Seconds::minus(int seconds) const {
+    return plus(FieldUtils::safeNegate(seconds));
+}
+
+Seconds Seconds::minus(const Seconds &seconds) const {
+    return minus(seconds.getValue());
+}
+
+//-----------------------------------------------------------------------
+Seconds Seconds::multipliedBy(int scalar) const {
+    return Seconds::seconds(multipliedValue(scalar));
+}
+
+Seconds Seconds::dividedBy(int divisor) const {
+    if (divisor == 1) {
+        return *this;
+    }
+    return Seconds::seconds(dividedValue(divisor));
+}
+
+Seconds Seconds::negated() const {
+    return Seconds::seconds(FieldUtils::safeNegate(getValue()));
+}
+
+int Seconds::hashCode() const {
+    int total = 17;
+    total = 27 * total + getValue();
+    total = 27 * total + getFieldType()->hashCode();
+    return total;
+}
+
+//-----------------------------------------------------------------------
+string Seconds::toString() const {
+    return BaseSingleFieldPeriod::toString("PT", 'S');
+}
+
+CODATIME_END
@@ -0,0 +1,349 @@
+//
+//  Seconds.h
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#ifndef __CodaTime__Seconds__
+#define __CodaTime__Seconds__
+
+#include "CodaTimeMacros.h"
+
+#include "base/BaseSingleFieldPeriod.h"
+
+#include <string>
+
+using namespace std;
+
+CODATIME_BEGIN
+
+class Days;
+class Duration;
+class DurationFieldType;
+class Hours;
+class Minutes;
+class Period;
+class PeriodType;
+class ReadableInstant;
+class ReadableInterval;
+class ReadablePartial;
+class ReadablePeriod;
+class Weeks;
+
+/**
+ * An immutable time period representing a number of seconds.
+ * <p>
+ * <code>Seconds</code> is an immutable period that can only store seconds.
+ * It does not store years, months or hours for example. As such it is a
+ * type-safe way of representing a number of seconds in an application.
+ * <p>
+ * The number of seconds is set in the constructor, and may be queried using
+ * <code>getSeconds()</code>. Basic mathematical operations are provided -
+ * <code>plus()</code>, <code>minus()</code>, <code>multipliedBy()</code> and
+ * <code>dividedBy()</code>.
+ * <p>
+ * <code>Seconds</code> is a value type holding a single int. It should be passed
+ * and returned by value rather than allocated.
+ * <p>
+ * Seconds is thread-safe and immutable.
+ *
+ * @author Stephen Colebourne
+ * @since 1.4
+ */
+class Seconds : public BaseSingleFieldPeriod {
+    
+public:
+    
+    /** Constant representing zero seconds. */
+    static const Seconds ZERO;
+    /** Constant representing one second. */
+    static const Seconds ONE;
+    /** Constant representing two seconds. */
+    static const Seconds TWO;
+    /** Constant representing three seconds. */
+    static const Seconds THREE;
+    /** Constant representing the maximum number of seconds that can be stored in this object. */
+    static const Seconds MAX_VALUE;
+    /** Constant representing the minimum number of seconds that can be stored in this object. */
+    static const Seconds MIN_VALUE;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Creates a new instance representing the specified number of seconds.
+     *
+     * @param seconds  the number of seconds to represent
+     */
+    constexpr Seconds(int seconds) : BaseSingleFieldPeriod(seconds) {
+    }
+    
+    /**
+     * Obtains an instance of <code>Seconds</code>.
+     *
+     * @param seconds  the number of seconds to obtain an instance for
+     * @return the instance of Seconds
+     */
+    static constexpr Seconds seconds(int seconds) {
+        return Seconds(seconds);
+    }
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Creates a <code>Seconds</code> representing the number of whole seconds
+     * between the two specified datetimes. This method correctly handles
+     * any daylight savings time changes that may occur during the interval.
+     * <p>
+     * The difference is read directly from the seconds field of the start's
+     * chronology, no intermediate <code>Period</code> is created.
+     *
+     * @param start  the start instant, must not be null
+     * @param end  the end instant, must not be null
+     * @return the period in seconds
+     * @throws IllegalArgumentException if the instants are null or invalid
+     */
+    static Seconds secondsBetween(ReadableInstant *start, ReadableInstant *end);
+    
+    /**
+     * Creates a <code>Seconds</code> representing the number of whole seconds
+     * between the two specified partial datetimes.
+     * <p>
+     * The two partials must contain the same fields, for example you can specify
+     * two <code>LocalDate</code> objects.
+     *
+     * @param start  the start partial date, must not be null
+     * @param end  the end partial date, must not be null
+     * @return the period in seconds
+     * @throws IllegalArgumentException if the partials are null or invalid
+     */
+    static Seconds secondsBetween(ReadablePartial *start, ReadablePartial *end);
+    
+    /**
+     * Creates a <code>Seconds</code> representing the number of whole seconds
+     * in the specified interval.
+     *
+     * @param interval  the interval to extract seconds from, null returns zero
+     * @return the period in seconds
+     * @throws IllegalArgumentException if the partials are null or invalid
+     */
+    static Seconds secondsIn(ReadableInterval *interval);
+    
+    /**
+     * Creates a new <code>Seconds</code> representing the number of complete
+     * standard length seconds in the specified period.
+     * <p>
+     * This factory method converts all fields from the period to seconds using standardised
+     * durations for each field. Only those fields which have a precise duration in
+     * the ISO UTC chronology can be converted.
+     *
+     * @param period  the period to get the number of seconds from, null returns zero
+     * @return the period in seconds
+     * @throws IllegalArgumentException if the period contains imprecise duration values
+     */
+    static Seconds standardSecondsIn(ReadablePeriod *period);
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Gets the duration field type, which is <code>seconds</code>.
+     *
+     * @return the period type
+     */
+    const DurationFieldType *getFieldType() const;
+    
+    /**
+     * Gets the period type, which is <code>seconds</code>.
+     *
+     * @return the period type
+     */
+    PeriodType *getPeriodType() const;
+    
+    /**
+     * Gets the number of seconds that this period represents.
+     *
+     * @return the number of seconds in the period
+     */
+    constexpr int getSeconds() const {
+        return getValue();
+    }
+    
+    /**
+     * Converts this period in seconds to a period in weeks assuming a
+     * seconds per week standard.
+     * <p>
+     * The result is the number of whole weeks, truncated towards zero.
+     *
+     * @return a period representing the number of whole weeks for this number of seconds
+     */
+    Weeks toStandardWeeks() const;
+    
+    /**
+     * Converts this period in seconds to a period in days assuming a
+     * seconds per day standard.
+     * <p>
+     * The result is the number of whole days, truncated towards zero.
+     *
+     * @return a period representing the number of whole days for this number of seconds
+     */
+    Days toStandardDays() const;
+    
+    /**
+     * Converts this period in seconds to a period in hours assuming a
+     * seconds per hour standard.
+     * <p>
+     * The result is the number of whole hours, truncated towards zero.
+     *
+     * @return a period representing the number of whole hours for this number of seconds
+     */
+    Hours toStandardHours() const;
+    
+    /**
+     * Converts this period in seconds to a period in minutes assuming a
+     * seconds per minute standard.
+     * <p>
+     * The result is the number of whole minutes, truncated towards zero.
+     *
+     * @return a period representing the number of whole minutes for this number of seconds
+     */
+    Minutes toStandardMinutes() const;
+    
+    /**
+     * Converts this period in seconds to a duration in milliseconds assuming a
+     * millis per second standard.
+     *
+     * @return a duration equivalent to this number of seconds
+     */
+    Duration *toStandardDuration() const;
+    
+    /**
+     * Converts this period to a <code>Period</code> with the standard period type.
+     *
+     * @return a period representing the same number of seconds
+     */
+    Period *toPeriod() const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Returns a new instance with the specified number of seconds added.
+     *
+     * @param seconds  the amount of seconds to add, may be negative
+     * @return the new period plus the specified number of seconds
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Seconds plus(int seconds) const;
+    
+    /**
+     * Returns a new instance with the specified number of seconds added.
+     *
+     * @param seconds  the amount of seconds to add, may be negative
+     * @return the new period plus the specified number of seconds
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Seconds plus(const Seconds &seconds) const;
+    
+    /**
+     * Returns a new instance with the specified number of seconds taken away.
+     *
+     * @param seconds  the amount of seconds to take away, may be negative
+     * @return the new period minus the specified number of seconds
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Seconds minus(int seconds) const;
+    
+    /**
+     * Returns a new instance with the specified number of seconds taken away.
+     *
+     * @param seconds  the amount of seconds to take away, may be negative
+     * @return the new period minus the specified number of seconds
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Seconds minus(const Seconds &seconds) const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Returns a new instance with the seconds multiplied by the specified scalar.
+     *
+     * @param scalar  the amount to multiply by, may be negative
+     * @return the new period multiplied by the specified scalar
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Seconds multipliedBy(int scalar) const;
+    
+    /**
+     * Returns a new instance with the seconds divided by the specified divisor.
+     * The calculation uses integer division, thus 3 divided by 2 is 1.
+     *
+     * @param divisor  the amount to divide by, may be negative
+     * @return the new period divided by the specified divisor
+     * @throws ArithmeticException if the divisor is zero
+     */
+    Seconds dividedBy(int divisor) const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Returns a new instance with the seconds value negated.
+     *
+     * @return the new period with a negated value
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Seconds negated() const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Is this seconds instance greater than the specified number of seconds.
+     *
+     * @param other  the other period
+     * @return true if this seconds instance is greater than the specified one
+     */
+    constexpr bool isGreaterThan(const Seconds &other) const {
+        return getValue() > other.getValue();
+    }
+    
+    /**
+     * Is this seconds instance less than the specified number of seconds.
+     *
+     * @param other  the other period
+     * @return true if this seconds instance is less than the specified one
+     */
+    constexpr bool isLessThan(const Seconds &other) const {
+        return getValue() < other.getValue();
+    }
+    
+    /**
+     * Compares this period to another of the same type.
+     *
+     * @param other  the other period
+     * @return negative if this is less, zero if equal, positive if greater
+     */
+    constexpr int compareTo(const Seconds &other) const {
+        return (getValue() > other.getValue() ? 1 : (getValue() < other.getValue() ? -1 : 0));
+    }
+    
+    constexpr bool equals(const Seconds &other) const {
+        return getValue() == other.getValue();
+    }
+    
+    constexpr bool operator==(const Seconds &other) const {
+        return getValue() == other.getValue();
+    }
+    
+    constexpr bool operator!=(const Seconds &other) const {
+        return getValue() != other.getValue();
+    }
+    
+    int hashCode() const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Gets this instance as a string in the ISO8601 duration format.
+     * <p>
+     * For example, "PT4S" represents 4 seconds.
+     *
+     * @return the value as an ISO8601 string
+     */
+    string toString() const;
+    
+};
+
+CODATIME_END
+
+#endif /* defined(__CodaTime__Seconds__) */
@@ -0,0 +1,133 @@
+//
+//  Weeks.cpp
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#include "Weeks.h"
+
+#include "DateTimeConstants.h"
+#include "Days.h"
+#include "Duration.h"
+#include "DurationFieldType.h"
+#include "Hours.h"
+#include "Minutes.h"
+#include "Period.h"
+#include "PeriodType.h"
+#include "Seconds.h"
+#include "field/FieldUtils.h"
+
+#include <climits>
+
+CODATIME_BEGIN
+
+const Weeks Weeks::ZERO = Weeks(0);
+const Weeks Weeks::ONE = Weeks(1);
+const Weeks Weeks::TWO = Weeks(2);
+const Weeks Weeks::THREE = Weeks(3);
+const Weeks Weeks::MAX_VALUE = Weeks(INT_MAX);
+const Weeks Weeks::MIN_VALUE = Weeks(INT_MIN);
+
+//-----------------------------------------------------------------------
+Weeks Weeks::weeksBetween(ReadableInstant *start, ReadableInstant *end) {
+    return Weeks(BaseSingleFieldPeriod::between(start, end, DurationFieldType::weeks()));
+}
+
+Weeks Weeks::weeksBetween(ReadablePartial *start, ReadablePartial *end) {
+    return Weeks(BaseSingleFieldPeriod::between(start, end, DurationFieldType::weeks()));
+}
+
+Weeks Weeks::weeksIn(ReadableInterval *interval) {
+    return Weeks(BaseSingleFieldPeriod::between(interval, DurationFieldType::weeks()));
+}
+
+Weeks Weeks::standardWeeksIn(ReadablePeriod *period) {
+    return Weeks(BaseSingleFieldPeriod::standardPeriodIn(period, DateTimeConstants::MILLIS_PER_WEEK));
+}
+
+//-----------------------------------------------------------------------
+const DurationFieldType *Weeks::getFieldType() const {
+    return DurationFieldType::weeks();
+}
+
+PeriodType *Weeks::getPeriodType() const {
+    return PeriodType::weeks();
+}
+
+//-----------------------------------------------------------------------
+Days Weeks::toStandardDays() const {
+    return Days::days(FieldUtils::safeMultiply(getValue(), DateTimeConstants::DAYS_PER_WEEK));
+}
+
+Hours Weeks::toStandardHours() const {
+    return Hours::hours(FieldUtils::safeMultiply(getValue(), DateTimeConstants::HOURS_PER_WEEK));
+}
+
+Minutes Weeks::toStandardMinutes() const {
+    return Minutes::minutes(FieldUtils::safeMultiply(getValue(), DateTimeConstants::MINUTES_PER_WEEK));
+}
+
+Seconds Weeks::toStandardSeconds() const {
+    return Seconds::seconds(FieldUtils::safeMultiply(getValue(), DateTimeConstants::SECONDS_PER_WEEK));
+}
+
+Duration *Weeks::toStandardDuration() const {
+    int64_t weeks = getValue();  // assign to a int64_t
+    return new Duration(weeks * DateTimeConstants::MILLIS_PER_WEEK);
+}
+
+Period *Weeks::toPeriod() const {
+    return Period::weeks(getValue());
+}
+
+//-----------------------------------------------------------------------
+Weeks Weeks::plus(int weeks) const {
+    if (weeks == 0) {
+        return *this;
+    }
+    return Weeks::weeks(FieldUtils::safeAdd(getValue(), weeks));
+}
+
+Weeks Weeks::plus(const Weeks &weeks) const {
+    return plus(weeks.getValue());
+}
+
+Weeks Weeks::minus(int weeks) const {
+    return plus(FieldUtils::safeNegate(weeks));
+}
+
+Weeks Weeks::minus(const Weeks &weeks) const {
+    return minus(weeks.getValue());
+}
+
+//-----------------------------------------------------------------------
+Weeks Weeks::multipliedBy(int scalar) const {
+    return Weeks::weeks(multipliedValue(scalar));
+}
+
+Weeks Weeks::dividedBy(int divisor) const {
+    if (divisor == 1) {
+        return *this;
+    }
+    return Weeks::weeks(dividedValue(divisor));
+}
+
+Weeks Weeks::negated() const {
+    return Weeks::weeks(FieldUtils::safeNegate(getValue()));
+}
+
+int Weeks::hashCode() const {
+    int total = 17;
+    total = 27 * total + getValue();
+    total = 27 * total + getFieldType()->hashCode();
+    return total;
+}
+
+//-----------------------------------------------------------------------
+string Weeks::toString() const {
+    return BaseSingleFieldPeriod::toString("P", 'W');
+}
+
+CODATIME_END
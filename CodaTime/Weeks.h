@@ -0,0 +1,345 @@
+//
+//  Weeks.h
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#ifndef __CodaTime__Weeks__
+#define __CodaTime__Weeks__
+
+#include "CodaTimeMacros.h"
+
+#include "base/BaseSingleFieldPeriod.h"
+
+#include <string>
+
+using namespace std;
+
+CODATIME_BEGIN
+
+class Days;
+class Duration;
+class DurationFieldType;
+class Hours;
+class Minutes;
+class Period;
+class PeriodType;
+class ReadableInstant;
+class ReadableInterval;
+class ReadablePartial;
+class ReadablePeriod;
+class Seconds;
+
+/**
+ * An immutable time period representing a number of weeks.
+ * <p>
+ * <code>Weeks</code> is an immutable period that can only store weeks.
+ * It does not store years, months or hours for example. As such it is a
+ * type-safe way of representing a number of weeks in an application.
+ * <p>
+ * The number of weeks is set in the constructor, and may be queried using
+ * <code>getWeeks()</code>. Basic mathematical operations are provided -
+ * <code>plus()</code>, <code>minus()</code>, <code>multipliedBy()</code> and
+ * <code>dividedBy()</code>.
+ * <p>
+ * <code>Weeks</code> is a value type holding a single int. It should be passed
+ * and returned by value rather than allocated.
+ * <p>
+ * Weeks is thread-safe and immutable.
+ *
+ * @author Stephen Colebourne
+ * @since 1.4
+ */
+class Weeks : public BaseSingleFieldPeriod {
+    
+public:
+    
+    /** Constant representing zero weeks. */
+    static const Weeks ZERO;
+    /** Constant representing one week. */
+    static const Weeks ONE;
+    /** Constant representing two weeks. */
+    static const Weeks TWO;
+    /** Constant representing three weeks. */
+    static const Weeks THREE;
+    /** Constant representing the maximum number of weeks that can be stored in this object. */
+    static const Weeks MAX_VALUE;
+    /** Constant representing the minimum number of weeks that can be stored in this object. */
+    static const Weeks MIN_VALUE;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Creates a new instance representing the specified number of weeks.
+     *
+     * @param weeks  the number of weeks to represent
+     */
+    constexpr Weeks(int weeks) : BaseSingleFieldPeriod(weeks) {
+    }
+    
+    /**
+     * Obtains an instance of <code>Weeks</code>.
+     *
+     * @param weeks  the number of weeks to obtain an instance for
+     * @return the instance of Weeks
+     */
+    static constexpr Weeks weeks(int weeks) {
+        return Weeks(weeks);
+    }
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Creates a <code>Weeks</code> representing the number of whole weeks
+     * between the two specified datetimes. This method correctly handles
+     * any daylight savings time changes that may occur during the interval.
+     * <p>
+     * The difference is read directly from the weeks field of the start's
+     * chronology, no intermediate <code>Period</code> is created.
+     *
+     * @param start  the start instant, must not be null
+     * @param end  the end instant, must not be null
+     * @return the period in weeks
+     * @throws IllegalArgumentException if the instants are null or invalid
+     */
+    static Weeks weeksBetween(ReadableInstant *start, ReadableInstant *end);
+    
+    /**
+     * Creates a <code>Weeks</code> representing the number of whole weeks
+     * between the two specified partial datetimes.
+     * <p>
+     * The two partials must contain the same fields, for example you can specify
+     * two <code>LocalDate</code> objects.
+     *
+     * @param start  the start partial date, must not be null
+     * @param end  the end partial date, must not be null
+     * @return the period in weeks
+     * @throws IllegalArgumentException if the partials are null or invalid
+     */
+    static Weeks weeksBetween(ReadablePartial *start, ReadablePartial *end);
+    
+    /**
+     * Creates a <code>Weeks</code> representing the number of whole weeks
+     * in the specified interval.
+     *
+     * @param interval  the interval to extract weeks from, null returns zero
+     * @return the period in weeks
+     * @throws IllegalArgumentException if the partials are null or invalid
+     */
+    static Weeks weeksIn(ReadableInterval *interval);
+    
+    /**
+     * Creates a new <code>Weeks</code> representing the number of complete
+     * standard length weeks in the specified period.
+     * <p>
+     * This factory method converts all fields from the period to weeks using standardised
+     * durations for each field. Only those fields which have a precise duration in
+     * the ISO UTC chronology can be converted.
+     *
+     * @param period  the period to get the number of weeks from, null returns zero
+     * @return the period in weeks
+     * @throws IllegalArgumentException if the period contains imprecise duration values
+     */
+    static Weeks standardWeeksIn(ReadablePeriod *period);
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Gets the duration field type, which is <code>weeks</code>.
+     *
+     * @return the period type
+     */
+    const DurationFieldType *getFieldType() const;
+    
+    /**
+     * Gets the period type, which is <code>weeks</code>.
+     *
+     * @return the period type
+     */
+    PeriodType *getPeriodType() const;
+    
+    /**
+     * Gets the number of weeks that this period represents.
+     *
+     * @return the number of weeks in the period
+     */
+    constexpr int getWeeks() const {
+        return getValue();
+    }
+    
+    /**
+     * Converts this period in weeks to a period in days assuming a
+     * days per week standard.
+     *
+     * @return a period representing the number of days for this number of weeks
+     * @throws ArithmeticException if the number of days is too large to be represented
+     */
+    Days toStandardDays() const;
+    
+    /**
+     * Converts this period in weeks to a period in hours assuming a
+     * hours per week standard.
+     *
+     * @return a period representing the number of hours for this number of weeks
+     * @throws ArithmeticException if the number of hours is too large to be represented
+     */
+    Hours toStandardHours() const;
+    
+    /**
+     * Converts this period in weeks to a period in minutes assuming a
+     * minutes per week standard.
+     *
+     * @return a period representing the number of minutes for this number of weeks
+     * @throws ArithmeticException if the number of minutes is too large to be represented
+     */
+    Minutes toStandardMinutes() const;
+    
+    /**
+     * Converts this period in weeks to a period in seconds assuming a
+     * seconds per week standard.
+     *
+     * @return a period representing the number of seconds for this number of weeks
+     * @throws ArithmeticException if the number of seconds is too large to be represented
+     */
+    Seconds toStandardSeconds() const;
+    
+    /**
+     * Converts this period in weeks to a duration in milliseconds assuming a
+     * millis per week standard.
+     *
+     * @return a duration equivalent to this number of weeks
+     */
+    Duration *toStandardDuration() const;
+    
+    /**
+     * Converts this period to a <code>Period</code> with the standard period type.
+     *
+     * @return a period representing the same number of weeks
+     */
+    Period *toPeriod() const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Returns a new instance with the specified number of weeks added.
+     *
+     * @param weeks  the amount of weeks to add, may be negative
+     * @return the new period plus the specified number of weeks
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Weeks plus(int weeks) const;
+    
+    /**
+     * Returns a new instance with the specified number of weeks added.
+     *
+     * @param weeks  the amount of weeks to add, may be negative
+     * @return the new period plus the specified number of weeks
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Weeks plus(const Weeks &weeks) const;
+    
+    /**
+     * Returns a new instance with the specified number of weeks taken away.
+     *
+     * @param weeks  the amount of weeks to take away, may be negative
+     * @return the new period minus the specified number of weeks
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Weeks minus(int weeks) const;
+    
+    /**
+     * Returns a new instance with the specified number of weeks taken away.
+     *
+     * @param weeks  the amount of weeks to take away, may be negative
+     * @return the new period minus the specified number of weeks
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Weeks minus(const Weeks &weeks) const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Returns a new instance with the weeks multiplied by the specified scalar.
+     *
+     * @param scalar  the amount to multiply by, may be negative
+     * @return the new period multiplied by the specified scalar
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Weeks multipliedBy(int scalar) const;
+    
+    /**
+     * Returns a new instance with the weeks divided by the specified divisor.
+     * The calculation uses integer division, thus 3 divided by 2 is 1.
+     *
+     * @param divisor  the amount to divide by, may be negative
+     * @return the new period divided by the specified divisor
+     * @throws ArithmeticException if the divisor is zero
+     */
+    Weeks dividedBy(int divisor) const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Returns a new instance with the weeks value negated.
+     *
+     * @return the new period with a negated value
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Weeks negated() const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Is this weeks instance greater than the specified number of weeks.
+     *
+     * @param other  the other period
+     * @return true if this weeks instance is greater than the specified one
+     */
+    constexpr bool isGreaterThan(const Weeks &other) const {
+        return getValue() > other.getValue();
+    }
+    
+    /**
+     * Is this weeks instance less than the specified number of weeks.
+     *
+     * @param other  the other period
+     * @return true if this weeks instance is less than the specified one
+     */
+    constexpr bool isLessThan(const Weeks &other) const {
+        return getValue() < other.getValue();
+    }
+    
+    /**
+     * Compares this period to another of the same type.
+     *
+     * @param other  the other period
+     * @return negative if this is less, zero if equal, positive if greater
+     */
+    constexpr int compareTo(const Weeks &other) const {
+        return (getValue() > other.getValue() ? 1 : (getValue() < other.getValue() ? -1 : 0));
+    }
+    
+    constexpr bool equals(const Weeks &other) const {
+        return getValue() == other.getValue();
+    }
+    
+    constexpr bool operator==(const Weeks &other) const {
+        return getValue() == other.getValue();
+    }
+    
+    constexpr bool operator!=(const Weeks &other) const {
+        return getValue() != other.getValue();
+    }
+    
+    int hashCode() const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Gets this instance as a string in the ISO8601 duration format.
+     * <p>
+     * For example, "P4W" represents 4 weeks.
+     *
+     * @return the value as an ISO8601 string
+     */
+    string toString() const;
+    
+};
+
+CODATIME_END
+
+#endif /* defined(__CodaTime__Weeks__) */
@@ -0,0 +1,94 @@
+//
+//  WorkerThreads.h
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#ifndef __CodaTime__WorkerThreads__
+#define __CodaTime__WorkerThreads__
+
+#include "CodaTimeMacros.h"
+
+#include <cstddef>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+CODATIME_BEGIN
+
+/**
+ * WorkerThreads holds the threads started for one parallel operation and
+ * joins any still running when it is destroyed.
+ * <p>
+ * A <code>std::thread</code> that is destroyed while joinable terminates
+ * the process, so a plain vector of threads cannot be left by an exception,
+ * such as the <code>system_error</code> thrown when a later thread fails to
+ * start. Joining in the destructor lets the exception propagate once the
+ * started workers have finished.
+ * <p>
+ * Space for every thread is reserved up front, so that storing a started
+ * thread never reallocates.
+ * <p>
+ * WorkerThreads is not thread-safe, it is used from the starting thread.
+ */
+class WorkerThreads {
+    
+private:
+    
+    vector<thread> iThreads;
+    
+    WorkerThreads(const WorkerThreads &other);
+    WorkerThreads &operator=(const WorkerThreads &other);
+    
+public:
+    
+    /**
+     * Constructor.
+     *
+     * @param capacity  the most threads that will be started
+     */
+    WorkerThreads(size_t capacity) {
+        iThreads.reserve(capacity);
+    }
+    
+    ~WorkerThreads() {
+        join();
+    }
+    
+    /**
+     * Starts a thread running the function with the arguments.
+     *
+     * @param function  the function to run
+     * @param args  the arguments to pass
+     * @throws system_error if the thread could not be started
+     */
+    template<class Function, class... Args>
+    void start(Function &&function, Args&&... args) {
+        if (iThreads.size() == iThreads.capacity()) {
+            iThreads.reserve(iThreads.size() * 2 + 1);
+        }
+        iThreads.emplace_back(forward<Function>(function), forward<Args>(args)...);
+    }
+    
+    /**
+     * Waits for every started thread to finish.
+     * The threads are forgotten, so more can be started afterwards.
+     */
+    void join() {
+        for (size_t i = 0; i < iThreads.size(); i++) {
+            if (iThreads[i].joinable()) {
+                iThreads[i].join();
+            }
+        }
+        iThreads.clear();
+    }
+    
+};
+
+CODATIME_END
+
+#endif /* defined(__CodaTime__WorkerThreads__) */
@@ -0,0 +1,102 @@
+//
+//  Years.cpp
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#include "Years.h"
+
+#include "DateTimeConstants.h"
+#include "DurationFieldType.h"
+#include "Period.h"
+#include "PeriodType.h"
+#include "field/FieldUtils.h"
+
+#include <climits>
+
+CODATIME_BEGIN
+
+const Years Years::ZERO = Years(0);
+const Years Years::ONE = Years(1);
+const Years Years::TWO = Years(2);
+const Years Years::THREE = Years(3);
+const Years Years::MAX_VALUE = Years(INT_MAX);
+const Years Years::MIN_VALUE = Years(INT_MIN);
+
+//-----------------------------------------------------------------------
+Years Years::yearsBetween(ReadableInstant *start, ReadableInstant *end) {
+    return Years(BaseSingleFieldPeriod::between(start, end, DurationFieldType::years()));
+}
+
+Years Years::yearsBetween(ReadablePartial *start, ReadablePartial *end) {
+    return Years(BaseSingleFieldPeriod::between(start, end, DurationFieldType::years()));
+}
+
+Years Years::yearsIn(ReadableInterval *interval) {
+    return Years(BaseSingleFieldPeriod::between(interval, DurationFieldType::years()));
+}
+
+//-----------------------------------------------------------------------
+const DurationFieldType *Years::getFieldType() const {
+    return DurationFieldType::years();
+}
+
+PeriodType *Years::getPeriodType() const {
+    return PeriodType::years();
+}
+
+Period *Years::toPeriod() const {
+    return Period::years(getValue());
+}
+
+//-----------------------------------------------------------------------
+Years Years::plus(int years) const {
+    if (years == 0) {
+        return *this;
+    }
+    return Years::years(FieldUtils::safeAdd(getValue(), years));
+}
+
+Years Years::plus(const Years &years) const {
+    return plus(years.getValue());
+}
+
+Years Years::minus(int years) const {
+    return plus(FieldUtils::safeNegate(years));
+}
+
+Years Years::minus(const Years &years) const {
+    return minus(years.getValue());
+}
+
+//-----------------------------------------------------------------------
+Years Years::multipliedBy(int scalar) const {
+    return Years::years(multipliedValue(scalar));
+}
+
+Years Years::dividedBy(int divisor) const {
+    if (divisor == 1) {
+        return *this;
+    }
+    return Years::years(dividedValue(divisor));
+}
+
+Years Years::negated() const {
+    return Years::years(FieldUtils::safeNegate(getValue()));
+}
+
+int Years::hashCode() const {
+    int total = 17;
+    total = 27 * total + getValue();
+    total = 27 * total + getFieldType()->hashCode();
+    return total;
+}
+
+//-----------------------------------------------------------------------
+string Years::toString() const {
+    return BaseSingleFieldPeriod::toString("P", 'Y');
+}
+
+CODATIME_END
@@ -0,0 +1,281 @@
+//
+//  Years.h
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#ifndef __CodaTime__Years__
+#define __CodaTime__Years__
+
+#include "CodaTimeMacros.h"
+
+#include "base/BaseSingleFieldPeriod.h"
+
+#include <string>
+
+using namespace std;
+
+CODATIME_BEGIN
+
+class DurationFieldType;
+class Period;
+class PeriodType;
+class ReadableInstant;
+class ReadableInterval;
+class ReadablePartial;
+
+/**
+ * An immutable time period representing a number of years.
+ * <p>
+ * <code>Years</code> is an immutable period that can only store years.
+ * It does not store years, months or hours for example. As such it is a
+ * type-safe way of representing a number of years in an application.
+ * <p>
+ * The number of years is set in the constructor, and may be queried using
+ * <code>getYears()</code>. Basic mathematical operations are provided -
+ * <code>plus()</code>, <code>minus()</code>, <code>multipliedBy()</code> and
+ * <code>dividedBy()</code>.
+ * <p>
+ * <code>Years</code> is a value type holding a single int. It should be passed
+ * and returned by value rather than allocated.
+ * <p>
+ * Years is thread-safe and immutable.
+ *
+ * @author Stephen Colebourne
+ * @since 1.4
+ */
+class Years : public BaseSingleFieldPeriod {
+    
+public:
+    
+    /** Constant representing zero years. */
+    static const Years ZERO;
+    /** Constant representing one year. */
+    static const Years ONE;
+    /** Constant representing two years. */
+    static const Years TWO;
+    /** Constant representing three years. */
+    static const Years THREE;
+    /** Constant representing the maximum number of years that can be stored in this object. */
+    static const Years MAX_VALUE;
+    /** Constant representing the minimum number of years that can be stored in this object. */
+    static const Years MIN_VALUE;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Creates a new instance representing the specified number of years.
+     *
+     * @param years  the number of years to represent
+     */
+    constexpr Years(int years) : BaseSingleFieldPeriod(years) {
+    }
+    
+    /**
+     * Obtains an instance of <code>Years</code>.
+     *
+     * @param years  the number of years to obtain an instance for
+     * @return the instance of Years
+     */
+    static constexpr Years years(int years) {
+        return Years(years);
+    }
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Creates a <code>Years</code> representing the number of whole years
+     * between the two specified datetimes. This method correctly handles
+     * any daylight savings time changes that may occur during the interval.
+     * <p>
+     * The difference is read directly from the years field of the start's
+     * chronology, no intermediate <code>Period</code> is created.
+     *
+     * @param start  the start instant, must not be null
+     * @param end  the end instant, must not be null
+     * @return the period in years
+     * @throws IllegalArgumentException if the instants are null or invalid
+     */
+    static Years yearsBetween(ReadableInstant *start, ReadableInstant *end);
+    
+    /**
+     * Creates a <code>Years</code> representing the number of whole years
+     * between the two specified partial datetimes.
+     * <p>
+     * The two partials must contain the same fields, for example you can specify
+     * two <code>LocalDate</code> objects.
+     *
+     * @param start  the start partial date, must not be null
+     * @param end  the end partial date, must not be null
+     * @return the period in years
+     * @throws IllegalArgumentException if the partials are null or invalid
+     */
+    static Years yearsBetween(ReadablePartial *start, ReadablePartial *end);
+    
+    /**
+     * Creates a <code>Years</code> representing the number of whole years
+     * in the specified interval.
+     *
+     * @param interval  the interval to extract years from, null returns zero
+     * @return the period in years
+     * @throws IllegalArgumentException if the partials are null or invalid
+     */
+    static Years yearsIn(ReadableInterval *interval);
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Gets the duration field type, which is <code>years</code>.
+     *
+     * @return the period type
+     */
+    const DurationFieldType *getFieldType() const;
+    
+    /**
+     * Gets the period type, which is <code>years</code>.
+     *
+     * @return the period type
+     */
+    PeriodType *getPeriodType() const;
+    
+    /**
+     * Gets the number of years that this period represents.
+     *
+     * @return the number of years in the period
+     */
+    constexpr int getYears() const {
+        return getValue();
+    }
+    
+    /**
+     * Converts this period to a <code>Period</code> with the standard period type.
+     *
+     * @return a period representing the same number of years
+     */
+    Period *toPeriod() const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Returns a new instance with the specified number of years added.
+     *
+     * @param years  the amount of years to add, may be negative
+     * @return the new period plus the specified number of years
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Years plus(int years) const;
+    
+    /**
+     * Returns a new instance with the specified number of years added.
+     *
+     * @param years  the amount of years to add, may be negative
+     * @return the new period plus the specified number of years
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Years plus(const Years &years) const;
+    
+    /**
+     * Returns a new instance with the specified number of years taken away.
+     *
+     * @param years  the amount of years to take away, may be negative
+     * @return the new period minus the specified number of years
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Years minus(int years) const;
+    
+    /**
+     * Returns a new instance with the specified number of years taken away.
+     *
+     * @param years  the amount of years to take away, may be negative
+     * @return the new period minus the specified number of years
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Years minus(const Years &years) const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Returns a new instance with the years multiplied by the specified scalar.
+     *
+     * @param scalar  the amount to multiply by, may be negative
+     * @return the new period multiplied by the specified scalar
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Years multipliedBy(int scalar) const;
+    
+    /**
+     * Returns a new instance with the years divided by the specified divisor.
+     * The calculation uses integer division, thus 3 divided by 2 is 1.
+     *
+     * @param divisor  the amount to divide by, may be negative
+     * @return the new period divided by the specified divisor
+     * @throws ArithmeticException if the divisor is zero
+     */
+    Years dividedBy(int divisor) const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Returns a new instance with the years value negated.
+     *
+     * @return the new period with a negated value
+     * @throws ArithmeticException if the result overflows an int
+     */
+    Years negated() const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Is this years instance greater than the specified number of years.
+     *
+     * @param other  the other period
+     * @return true if this years instance is greater than the specified one
+     */
+    constexpr bool isGreaterThan(const Years &other) const {
+        return getValue() > other.getValue();
+    }
+    
+    /**
+     * Is this years instance less than the specified number of years.
+     *
+     * @param other  the other period
+     * @return true if this years instance is less than the specified one
+     */
+    constexpr bool isLessThan(const Years &other) const {
+        return getValue() < other.getValue();
+    }
+    
+    /**
+     * Compares this period to another of the same type.
+     *
+     * @param other  the other period
+     * @return negative if this is less, zero if equal, positive if greater
+     */
+    constexpr int compareTo(const Years &other) const {
+        return (getValue() > other.getValue() ? 1 : (getValue() < other.getValue() ? -1 : 0));
+    }
+    
+    constexpr bool equals(const Years &other) const {
+        return getValue() == other.getValue();
+    }
+    
+    constexpr bool operator==(const Years &other) const {
+        return getValue() == other.getValue();
+    }
+    
+    constexpr bool operator!=(const Years &other) const {
+        return getValue() != other.getValue();
+    }
+    
+    int hashCode() const;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Gets this instance as a string in the ISO8601 duration format.
+     * <p>
+     * For example, "P4Y" represents 4 years.
+     *
+     * @return the value as an ISO8601 string
+     */
+    string toString() const;
+    
+};
+
+CODATIME_END
+
+#endif /* defined(__CodaTime__Years__) */
@@ -39,21 +39,21 @@ int AbstractDuration::compareTo(const ReadableDuration *other) const {
 
 bool AbstractDuration::isEqual(ReadableDuration *duration) {
     if (duration == NULL) {
-        duration = Duration::ZERO;
+        duration = Duration::ZERO();
     }
     return compareTo(duration) == 0;
 }
 
 bool AbstractDuration::isLongerThan(ReadableDuration *duration) {
     if (duration == NULL) {
-        duration = Duration::ZERO;
+        duration = Duration::ZERO();
     }
     return compareTo(duration) > 0;
 }
 
 bool AbstractDuration::isShorterThan(ReadableDuration *duration) {
     if (duration == NULL) {
-        duration = Duration::ZERO;
+        duration = Duration::ZERO();
     }
     return compareTo(duration) < 0;
 }
@@ -146,7 +146,7 @@ int64_t AbstractInterval::toDurationMillis() {
 Duration *AbstractInterval::toDuration() {
     int64_t durMillis = toDurationMillis();
     if (durMillis == 0) {
-        return Duration::ZERO;
+        return Duration::ZERO();
     } else {
         return new Duration(durMillis);
     }
@@ -11,7 +11,7 @@
 
 #include "CodaTimeMacros.h"
 
-#include "Readableinterval.h"
+#include "ReadableInterval.h"
 
 #include <string>
 
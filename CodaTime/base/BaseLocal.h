@@ -12,6 +12,9 @@
 #include "CodaTimeMacros.h"
 
 #include "AbstractPartial.h"
+#include "Chronology.h"
+
+#include <typeinfo>
 
 CODATIME_BEGIN
 
@@ -31,6 +34,10 @@ CODATIME_BEGIN
 class BaseLocal : public AbstractPartial {
     
     friend class BasePeriod;
+    friend class BinaryEncoder;
+    friend class BaseSingleFieldPeriod;
+    friend class PackedLocalDate;
+    friend class PackedLocalTime;
     
 private:
     
@@ -62,6 +69,97 @@ protected:
      * @return the number of milliseconds since 1970-01-01T00:00:00
      */
     virtual int64_t getLocalMillis() const = 0;
+    
+    /**
+     * Gets the other partial as a local partial that can be compared to this
+     * one on local millis alone.
+     * <p>
+     * That is the case when it is the same class in the same chronology.
+     * Chronologies are usually shared instances, so identity is checked
+     * before equality.
+     *
+     * @param partial  the partial to check, not null
+     * @return the partial as a BaseLocal, NULL if it must be compared by field
+     */
+    const BaseLocal *getComparableLocal(const ReadablePartial *partial) const {
+        const BaseLocal *other = partial->getBaseLocal();
+        if (other == NULL || typeid(*other) != typeid(*this)) {
+            return NULL;
+        }
+        Chronology *chrono = getChronology();
+        Chronology *otherChrono = other->getChronology();
+        if (chrono != otherChrono && chrono->equals(otherChrono) == false) {
+            return NULL;
+        }
+        return other;
+    }
+    
+public:
+    
+    const BaseLocal *getBaseLocal() const {
+        return this;
+    }
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Compares this partial with another returning true if they are the
+     * same class, the chronologies are equal and the local millis are equal.
+     * <p>
+     * Unlike Joda-Time, a local partial is never equal to a partial of
+     * another class, such as a <code>Partial</code> with the same field
+     * types and values. This keeps equals consistent with the hash code,
+     * which is taken from the local millis.
+     *
+     * @param partial  an object to check against
+     * @return true if the class, chronology and local millis are equal
+     */
+    bool equals(const Object *partial) const {
+        if (this == partial) {
+            return true;
+        }
+        const ReadablePartial *other = dynamic_cast<const ReadablePartial*>(partial);
+        if (other == 0) {
+            return false;
+        }
+        const BaseLocal *local = getComparableLocal(other);
+        return local != NULL && getLocalMillis() == local->getLocalMillis();
+    }
+    
+    /**
+     * Compares this partial with another returning an integer
+     * indicating the order.
+     * <p>
+     * A partial of the same class in the same chronology is compared on
+     * local millis alone, otherwise the fields are compared in order.
+     *
+     * @param partial  an object to check against
+     * @return negative if this is less, zero if equal, positive if greater
+     * @throws ClassCastException if the partial has field types that don't match
+     */
+    int compareTo(const ReadablePartial *partial) const {
+        const BaseLocal *local = getComparableLocal(partial);
+        if (local != NULL) {
+            int64_t millis = getLocalMillis();
+            int64_t otherMillis = local->getLocalMillis();
+            return (millis < otherMillis ? -1 : (millis == otherMillis ? 0 : 1));
+        }
+        return AbstractPartial::compareTo(partial);
+    }
+    
+    /**
+     * Gets a hash code for the partial that is compatible with the
+     * equals method.
+     * <p>
+     * The hash is taken from the local millis and the chronology, rather
+     * than from each field. This relies on equals only matching partials
+     * of the same class.
+     *
+     * @return a suitable hash code
+     */
+    int hashCode() {
+        int64_t millis = getLocalMillis();
+        return 23 * (int) (millis ^ (int64_t) ((uint64_t) millis >> 32)) + getChronology()->hashCode();
+    }
 };
 
 CODATIME_END
@@ -23,9 +23,12 @@
 
 CODATIME_BEGIN
 
-const BasePeriod::DummyPeriod *BasePeriod::DUMMY_PERIOD = new DummyPeriod();
+const BasePeriod::DummyPeriod *BasePeriod::DUMMY_PERIOD() {
+    static const DummyPeriod *const cDummyPeriod = new DummyPeriod();
+    return cDummyPeriod;
+}
 
-void BasePeriod::checkAndUpdate(const DurationFieldType *type, vector<int> values, int newValue) {
+void BasePeriod::checkAndUpdate(const DurationFieldType *type, PeriodType::Values &values, int newValue) {
     int index = indexOf(type);
     if (index == -1) {
         if (newValue != 0) {
@@ -37,7 +40,7 @@ void BasePeriod::checkAndUpdate(const DurationFieldType *type, vector<int> value
 }
 
 void BasePeriod::setPeriodInternal(ReadablePeriod *period) {
-    vector<int> newValues = vector<int>(size());
+    PeriodType::Values newValues = PeriodType::Values();
     for (int i = 0, isize = period->size(); i < isize; i++) {
         const DurationFieldType *type = period->getFieldType(i);
         int value = period->getValue(i);
@@ -46,9 +49,9 @@ void BasePeriod::setPeriodInternal(ReadablePeriod *period) {
     setValues(newValues);
 }
 
-vector<int> BasePeriod::setPeriodInternal(int years, int months, int weeks, int days,
+PeriodType::Values BasePeriod::setPeriodInternal(int years, int months, int weeks, int days,
                               int hours, int minutes, int seconds, int millis) {
-    vector<int> newValues = vector<int>(size());
+    PeriodType::Values newValues = PeriodType::Values();
     checkAndUpdate(DurationFieldType::years(), newValues, years);
     checkAndUpdate(DurationFieldType::months(), newValues, months);
     checkAndUpdate(DurationFieldType::weeks(), newValues, weeks);
@@ -79,7 +82,7 @@ BasePeriod::BasePeriod(ReadableInstant *startInstant, ReadableInstant *endInstan
     type = checkPeriodType(type);
     if (startInstant == NULL && endInstant == NULL) {
         iType = type;
-        iValues = vector<int>(size());
+        iValues.fill(0);
     } else {
         int64_t startMillis = DateTimeUtils::getInstantMillis(startInstant);
         int64_t endMillis = DateTimeUtils::getInstantMillis(endInstant);
@@ -150,9 +153,10 @@ BasePeriod::BasePeriod(int64_t duration) {
     // calculation uses period type from a period object (bad design)
     // thus we use a dummy period object with the time type
     iType = PeriodType::standard();
-    vector<int> values = ISOChronology::getInstanceUTC()->get(DUMMY_PERIOD, duration);
-    iValues = vector<int>(8);
-    iValues = values;
+    PeriodType::Values values = ISOChronology::getInstanceUTC()->get(DUMMY_PERIOD(), duration);
+    // the dummy period holds hours, minutes, seconds and millis
+    iValues.fill(0);
+    copy(values.begin(), values.begin() + 4, iValues.begin() + 4);
 }
 
 BasePeriod::BasePeriod(int64_t duration, const PeriodType *type, Chronology *chrono) {
@@ -171,15 +175,15 @@ BasePeriod::BasePeriod(Object *period, const PeriodType *type, Chronology *chron
     ReadWritablePeriod *thisReadWrite = dynamic_cast<ReadWritablePeriod*>(this);
     
     if (thisReadWrite != 0) {
-        iValues = vector<int>(size());
+        iValues.fill(0);
         chrono = DateTimeUtils::getChronology(chrono);
         converter->setInto(thisReadWrite, period, chrono);
     } else {
-        iValues = (new MutablePeriod(period, type, chrono))->getValues();
+        iValues = MutablePeriod(period, type, chrono).getValueArray();
     }
 }
 
-BasePeriod::BasePeriod(vector<int> values, const PeriodType *type) {
+BasePeriod::BasePeriod(const PeriodType::Values &values, const PeriodType *type) {
     iType = type;
     iValues = values;
 }
@@ -190,7 +194,7 @@ const PeriodType *BasePeriod::checkPeriodType(const PeriodType *type) {
 
 void BasePeriod::setPeriod(ReadablePeriod *period) {
     if (period == NULL) {
-        setValues(vector<int>(size()));
+        setValues(PeriodType::Values());
     } else {
         setPeriodInternal(period);
     }
@@ -198,7 +202,26 @@ void BasePeriod::setPeriod(ReadablePeriod *period) {
 
 void BasePeriod::setPeriod(int years, int months, int weeks, int days,
                int hours, int minutes, int seconds, int millis) {
-    vector<int> newValues = setPeriodInternal(years, months, weeks, days, hours, minutes, seconds, millis);
+    PeriodType::Values newValues = setPeriodInternal(years, months, weeks, days, hours, minutes, seconds, millis);
+    setValues(newValues);
+}
+
+void BasePeriod::setFields(const PeriodType::Values &values, int fieldMask) {
+    int typeMask = iType->getFieldMask();
+    PeriodType::Values newValues = iValues;
+    for (int i = 0, index = 0, isize = (int) values.size(); i < isize; i++) {
+        bool supported = ((typeMask >> i) & 1) != 0;
+        if ((fieldMask >> i) & 1) {
+            if (supported) {
+                newValues[index] = values[i];
+            } else if (values[i] != 0) {
+                throw IllegalArgumentException("Period does not support field '" + PeriodType::standard()->getFieldType(i)->getName() + "'");
+            }
+        }
+        if (supported) {
+            index++;
+        }
+    }
     setValues(newValues);
 }
 
@@ -206,7 +229,7 @@ void BasePeriod::setField(const DurationFieldType *field, int value) {
     setFieldInto(iValues, field, value);
 }
 
-void BasePeriod::setFieldInto(vector<int> values, const DurationFieldType *field, int value) {
+void BasePeriod::setFieldInto(PeriodType::Values &values, const DurationFieldType *field, int value) {
     int index = indexOf(field);
     if (index == -1) {
         if (value != 0 || field == NULL) {
@@ -224,7 +247,7 @@ void BasePeriod::addField(const DurationFieldType *field, int value) {
     addFieldInto(iValues, field, value);
 }
 
-void BasePeriod::addFieldInto(vector<int> values, const DurationFieldType *field, int value) {
+void BasePeriod::addFieldInto(PeriodType::Values &values, const DurationFieldType *field, int value) {
     int index = indexOf(field);
     if (index == -1) {
         if (value != 0 || field == NULL) {
@@ -240,26 +263,36 @@ void BasePeriod::addFieldInto(vector<int> values, const DurationFieldType *field
 
 void BasePeriod::mergePeriod(ReadablePeriod *period) {
     if (period != NULL) {
-        setValues(mergePeriodInto(getValues(), period));
+        PeriodType::Values values = iValues;
+        mergePeriodInto(values, period);
+        setValues(values);
     }
 }
 
-vector<int> BasePeriod::mergePeriodInto(vector<int> values, ReadablePeriod *period) {
+void BasePeriod::mergePeriodInto(PeriodType::Values &values, ReadablePeriod *period) {
     for (int i = 0, isize = period->size(); i < isize; i++) {
         const DurationFieldType *type = period->getFieldType(i);
         int value = period->getValue(i);
         checkAndUpdate(type, values, value);
     }
-    return values;
 }
 
 void BasePeriod::addPeriod(ReadablePeriod *period) {
     if (period != NULL) {
-        setValues(addPeriodInto(getValues(), period));
+        PeriodType::Values values = iValues;
+        addPeriodInto(values, period);
+        setValues(values);
     }
 }
 
-vector<int> BasePeriod::addPeriodInto(vector<int> values, ReadablePeriod *period) {
+void BasePeriod::addPeriodInto(PeriodType::Values &values, ReadablePeriod *period) {
+    if (period->getPeriodType() == iType) {
+        // same fields in the same order, so add lane by lane
+        for (int i = 0, isize = period->size(); i < isize; i++) {
+            values[i] = FieldUtils::safeAdd(values[i], period->getValue(i));
+        }
+        return;
+    }
     for (int i = 0, isize = period->size(); i < isize; i++) {
         const DurationFieldType *type = period->getFieldType(i);
         int value = period->getValue(i);
@@ -271,18 +304,44 @@ vector<int> BasePeriod::addPeriodInto(vector<int> values, ReadablePeriod *period
                 err.append("'");
                 throw IllegalArgumentException(err);
             } else {
-                values[index] = FieldUtils::safeAdd(getValue(index), value);
+                values[index] = FieldUtils::safeAdd(values[index], value);
             }
         }
     }
-    return values;
+}
+
+void BasePeriod::addValues(const PeriodType::Values &values) {
+    PeriodType::Values newValues = iValues;
+    for (int i = 0, isize = size(); i < isize; i++) {
+        newValues[i] = FieldUtils::safeAdd(newValues[i], values[i]);
+    }
+    iValues = newValues;
+}
+
+void BasePeriod::addFields(const PeriodType::Values &values, int fieldMask) {
+    int typeMask = iType->getFieldMask();
+    PeriodType::Values newValues = iValues;
+    for (int i = 0, index = 0, isize = (int) values.size(); i < isize; i++) {
+        bool supported = ((typeMask >> i) & 1) != 0;
+        if ((fieldMask >> i) & 1) {
+            if (supported) {
+                newValues[index] = FieldUtils::safeAdd(newValues[index], values[i]);
+            } else if (values[i] != 0) {
+                throw IllegalArgumentException("Period does not support field '" + PeriodType::standard()->getFieldType(i)->getName() + "'");
+            }
+        }
+        if (supported) {
+            index++;
+        }
+    }
+    setValues(newValues);
 }
 
 void BasePeriod::setValue(int index, int value) {
     iValues[index] = value;
 }
 
-void BasePeriod::setValues(vector<int> values) {
+void BasePeriod::setValues(const PeriodType::Values &values) {
     iValues = values;
 }
 
@@ -30,7 +30,8 @@ class DurationFieldType;
 
 /**
  * BasePeriod is an abstract implementation of ReadablePeriod that stores
- * data in a <code>PeriodType</code> and an <code>vector<int></code>.
+ * data in a <code>PeriodType</code> and a fixed size <code>PeriodType::Values</code>
+ * array held inline, so copying or updating a period never allocates.
  * <p>
  * This class should generally not be used directly by API users.
  * The {@link ReadablePeriod} interface should be used when different
@@ -60,14 +61,14 @@ private:
         }
     };
     
-    /** Serialization version */
-    static const DummyPeriod *DUMMY_PERIOD;
+    /** Gets the dummy period, created on first use and never destroyed */
+    static const DummyPeriod *DUMMY_PERIOD();
     
     /** The type of period */
     const PeriodType *iType;
     
-    /** The values */
-    vector<int> iValues;
+    /** The values, in the order of the type's fields */
+    PeriodType::Values iValues;
     
     //-----------------------------------------------------------------------
     /**
@@ -78,7 +79,7 @@ private:
      * @param values  the array to update
      * @param newValue  the new value to store if successful
      */
-    void checkAndUpdate(const DurationFieldType *type, vector<int> values, int newValue);
+    void checkAndUpdate(const DurationFieldType *type, PeriodType::Values &values, int newValue);
     
     /**
      * method called from constructor.
@@ -88,7 +89,7 @@ private:
     /**
      * method called from constructor.
      */
-    vector<int> setPeriodInternal(int years, int months, int weeks, int days,
+    PeriodType::Values setPeriodInternal(int years, int months, int weeks, int days,
                                   int hours, int minutes, int seconds, int millis);
     
 protected:
@@ -211,10 +212,10 @@ protected:
      * Constructor used when we trust ourselves.
      * Do not expose publically.
      *
-     * @param values  the values to use, not null, not cloned
+     * @param values  the values to use
      * @param type  which set of fields this period supports, not null
      */
-    BasePeriod(vector<int> values, const PeriodType *type);
+    BasePeriod(const PeriodType::Values &values, const PeriodType *type);
     
     //-----------------------------------------------------------------------
     /**
@@ -252,6 +253,15 @@ protected:
     void setPeriod(int years, int months, int weeks, int days,
                    int hours, int minutes, int seconds, int millis);
     
+    /**
+     * Sets some of the standard fields in one go, leaving the others unchanged.
+     *
+     * @param values  the values in standard order, years first
+     * @param fieldMask  the fields to set, bit i set for standard field i
+     * @throws IllegalArgumentException if an unsupported field's value is non-zero
+     */
+    void setFields(const PeriodType::Values &values, int fieldMask);
+    
     //-----------------------------------------------------------------------
     /**
      * Sets the value of a field in this period.
@@ -270,7 +280,7 @@ protected:
      * @param value  the value to set
      * @throws IllegalArgumentException if field is null or not supported.
      */
-    void setFieldInto(vector<int> values, const DurationFieldType *field, int value);
+    void setFieldInto(PeriodType::Values &values, const DurationFieldType *field, int value);
     
     /**
      * Adds the value of a field in this period.
@@ -289,7 +299,7 @@ protected:
      * @param value  the value to set
      * @throws IllegalArgumentException if field is is null or not supported.
      */
-    void addFieldInto(vector<int> values, const DurationFieldType *field, int value);
+    void addFieldInto(PeriodType::Values &values, const DurationFieldType *field, int value);
     
     /**
      * Merges the fields from another period.
@@ -302,12 +312,11 @@ protected:
     /**
      * Merges the fields from another period.
      *
-     * @param values  the array of values to update
+     * @param values  the array of values to update in place
      * @param period  the period to add from, not null
-     * @return the updated values
      * @throws IllegalArgumentException if an unsupported field's value is non-zero
      */
-    vector<int> mergePeriodInto(vector<int> values, ReadablePeriod *period);
+    void mergePeriodInto(PeriodType::Values &values, ReadablePeriod *period);
     
     /**
      * Adds the fields from another period.
@@ -320,12 +329,32 @@ protected:
     /**
      * Adds the fields from another period.
      *
-     * @param values  the array of values to update
+     * @param values  the array of values to update in place
      * @param period  the period to add from, not null
-     * @return the updated values
      * @throws IllegalArgumentException if an unsupported field's value is non-zero
      */
-    vector<int> addPeriodInto(vector<int> values, ReadablePeriod *period);
+    void addPeriodInto(PeriodType::Values &values, ReadablePeriod *period);
+    
+    /**
+     * Adds an array of values, in the order of this period's type, to this period.
+     * <p>
+     * All the fields are checked before any is changed, and nothing is allocated,
+     * so this is suitable for accumulating in a loop.
+     *
+     * @param values  the values to add, indexed as this period's fields
+     * @throws ArithmeticException if the addition exceeds the capacity of the period
+     */
+    void addValues(const PeriodType::Values &values);
+    
+    /**
+     * Adds some of the standard fields in one go, leaving the others unchanged.
+     *
+     * @param values  the values in standard order, years first
+     * @param fieldMask  the fields to add, bit i set for standard field i
+     * @throws IllegalArgumentException if an unsupported field's value is non-zero
+     * @throws ArithmeticException if the addition exceeds the capacity of the period
+     */
+    void addFields(const PeriodType::Values &values, int fieldMask);
     
     //-----------------------------------------------------------------------
     /**
@@ -340,13 +369,18 @@ protected:
     /**
      * Sets the values of all fields.
      * <p>
-     * In version 2.0 and later, this method copies the array into the original.
-     * This is because the instance variable has been changed to be const to satisfy the Java Memory Model.
-     * This only impacts subclasses that are mutable.
+     * This method copies the array into the inline storage.
      *
      * @param values  the array of values
      */
-    void setValues(vector<int> values);
+    void setValues(const PeriodType::Values &values);
+    
+    /**
+     * Gets the inline array of values, without copying into a vector.
+     *
+     * @return the values, in the order of the period type's fields
+     */
+    const PeriodType::Values &getValueArray() const { return iValues; }
     
 public:
     
@@ -359,9 +393,9 @@ public:
     bool isSupported(const DurationFieldType *type) { return AbstractPeriod::isSupported(type); }
     
     bool equals(const Object *period) const { return AbstractPeriod::equals(period); }
-
+    
     int hashCode() { return AbstractPeriod::hashCode(); }
-
+    
     string toString() { return AbstractPeriod::toString(); }
     
     int indexOf(const DurationFieldType *type) { return AbstractPeriod::indexOf(type); }
@@ -0,0 +1,114 @@
+//
+//  BaseSingleFieldPeriod.cpp
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#include "BaseSingleFieldPeriod.h"
+
+#include "base/BaseLocal.h"
+#include "chrono/ISOChronology.h"
+#include "Chronology.h"
+#include "DateTimeUtils.h"
+#include "DurationField.h"
+#include "DurationFieldType.h"
+#include "Exceptions.h"
+#include "field/FieldUtils.h"
+#include "ReadableInstant.h"
+#include "ReadableInterval.h"
+#include "ReadablePartial.h"
+#include "ReadablePeriod.h"
+
+#include <typeinfo>
+
+CODATIME_BEGIN
+
+int BaseSingleFieldPeriod::between(ReadableInstant *start, ReadableInstant *end, const DurationFieldType *field) {
+    if (start == NULL || end == NULL) {
+        throw IllegalArgumentException("ReadableInstant objects must not be NULL");
+    }
+    Chronology *chrono = DateTimeUtils::getInstantChronology(start);
+    return field->getField(chrono)->getDifference(end->getMillis(), start->getMillis());
+}
+
+int BaseSingleFieldPeriod::between(ReadablePartial *start, ReadablePartial *end, const DurationFieldType *field) {
+    if (start == NULL || end == NULL) {
+        throw IllegalArgumentException("ReadablePartial objects must not be NULL");
+    }
+    
+    BaseLocal *startLocal = dynamic_cast<BaseLocal*>(start);
+    BaseLocal *endLocal = dynamic_cast<BaseLocal*>(end);
+    if (startLocal != 0 && endLocal != 0 && typeid(*start) == typeid(*end)) {
+        // for performance, local types already hold their fields as local millis
+        Chronology *chrono = DateTimeUtils::getChronology(start->getChronology())->withUTC();
+        return field->getField(chrono)->getDifference(endLocal->getLocalMillis(), startLocal->getLocalMillis());
+    }
+    
+    if (start->size() != end->size()) {
+        throw IllegalArgumentException("ReadablePartial objects must have the same set of fields");
+    }
+    for (int i = 0, isize = start->size(); i < isize; i++) {
+        if (start->getFieldType(i) != end->getFieldType(i)) {
+            throw IllegalArgumentException("ReadablePartial objects must have the same set of fields");
+        }
+    }
+    if (DateTimeUtils::isContiguous(start) == false) {
+        throw IllegalArgumentException("ReadablePartial objects must be contiguous");
+    }
+    Chronology *chrono = DateTimeUtils::getChronology(start->getChronology())->withUTC();
+    return field->getField(chrono)->getDifference(chrono->set(end, START_1972), chrono->set(start, START_1972));
+}
+
+int BaseSingleFieldPeriod::between(ReadableInterval *interval, const DurationFieldType *field) {
+    if (interval == NULL) {
+        return 0;
+    }
+    Chronology *chrono = DateTimeUtils::getChronology(interval->getChronology());
+    return field->getField(chrono)->getDifference(interval->getEndMillis(), interval->getStartMillis());
+}
+
+int BaseSingleFieldPeriod::standardPeriodIn(ReadablePeriod *period, int64_t millisPerUnit) {
+    if (period == NULL) {
+        return 0;
+    }
+    Chronology *iso = ISOChronology::getInstanceUTC();
+    int64_t duration = 0LL;
+    for (int i = 0; i < period->size(); i++) {
+        int value = period->getValue(i);
+        if (value != 0) {
+            const DurationField *field = period->getFieldType(i)->getField(iso);
+            if (field->isPrecise() == false) {
+                string err("Cannot convert period to duration as ");
+                err.append(field->getName());
+                err.append(" is not precise in the period ");
+                err.append(period->toString());
+                throw IllegalArgumentException(err);
+            }
+            duration = FieldUtils::safeAdd(duration, FieldUtils::safeMultiply(field->getUnitMillis(), value));
+        }
+    }
+    return FieldUtils::safeToInt(duration / millisPerUnit);
+}
+
+//-----------------------------------------------------------------------
+int BaseSingleFieldPeriod::multipliedValue(int scalar) const {
+    return FieldUtils::safeMultiply(iPeriod, scalar);
+}
+
+int BaseSingleFieldPeriod::dividedValue(int divisor) const {
+    if (divisor == 0) {
+        throw ArithmeticException("Cannot divide a period by zero");
+    }
+    return FieldUtils::safeToInt(FieldUtils::safeDivide((int64_t) iPeriod, (int64_t) divisor));
+}
+
+string BaseSingleFieldPeriod::toString(const char *prefix, char suffix) const {
+    string str(prefix);
+    str.append(to_string(iPeriod));
+    str.append(1, suffix);
+    return str;
+}
+
+CODATIME_END
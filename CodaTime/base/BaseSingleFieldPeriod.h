@@ -0,0 +1,150 @@
+//
+//  BaseSingleFieldPeriod.h
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#ifndef __CodaTime__BaseSingleFieldPeriod__
+#define __CodaTime__BaseSingleFieldPeriod__
+
+#include "CodaTimeMacros.h"
+
+#include <string>
+
+using namespace std;
+
+CODATIME_BEGIN
+
+class DurationFieldType;
+class ReadableInstant;
+class ReadableInterval;
+class ReadablePartial;
+class ReadablePeriod;
+
+/**
+ * BaseSingleFieldPeriod is the base for periods that store a single int,
+ * such as <code>Days</code> or <code>Hours</code>.
+ * <p>
+ * Unlike <code>BasePeriod</code> these are plain values, with no virtual
+ * methods and no heap storage. They are intended to be passed and returned
+ * by value and are as cheap to copy as an int.
+ * <p>
+ * BaseSingleFieldPeriod is thread-safe and immutable, and all subclasses must be as well.
+ *
+ * @author Stephen Colebourne
+ * @since 1.4
+ */
+class BaseSingleFieldPeriod {
+    
+private:
+    
+    /** The period in the units of this period */
+    int iPeriod;
+    
+protected:
+    
+    /** The start of 1972, a leap year, used when calculating between partials */
+    static const int64_t START_1972 = 2LL * 365LL * 86400LL * 1000LL;
+    
+    /**
+     * Calculates the number of whole units between the two specified datetimes.
+     *
+     * @param start  the start instant, validated to not be null
+     * @param end  the end instant, validated to not be null
+     * @param field  the field type to use, must not be null
+     * @return the period
+     * @throws IllegalArgumentException if the instants are null or invalid
+     */
+    static int between(ReadableInstant *start, ReadableInstant *end, const DurationFieldType *field);
+    
+    /**
+     * Calculates the number of whole units between the two specified partial datetimes.
+     * <p>
+     * The two partials must contain the same fields, for example you can specify
+     * two <code>LocalDate</code> objects. Local types are compared directly on
+     * their local millis, without setting each field in turn.
+     *
+     * @param start  the start partial date, validated to not be null
+     * @param end  the end partial date, validated to not be null
+     * @param field  the field type to use, must not be null
+     * @return the period
+     * @throws IllegalArgumentException if the partials are null or invalid
+     */
+    static int between(ReadablePartial *start, ReadablePartial *end, const DurationFieldType *field);
+    
+    /**
+     * Calculates the number of whole units in the specified interval.
+     *
+     * @param interval  the interval to query, null returns zero
+     * @param field  the field type to use, must not be null
+     * @return the period
+     */
+    static int between(ReadableInterval *interval, const DurationFieldType *field);
+    
+    /**
+     * Creates a new instance representing the number of complete standard length units
+     * in the specified period.
+     * <p>
+     * This factory method converts all fields from the period to hours using standardised
+     * durations for each field. Only those fields which have a precise duration in
+     * the ISO UTC chronology can be converted.
+     *
+     * @param period  the period to get the number of hours from, null returns zero
+     * @param millisPerUnit  the number of milliseconds in one standard unit of this period
+     * @return the number of units
+     * @throws IllegalArgumentException if the period contains imprecise duration values
+     */
+    static int standardPeriodIn(ReadablePeriod *period, int64_t millisPerUnit);
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Creates a new instance representing the specified period.
+     *
+     * @param period  the period to represent
+     */
+    constexpr BaseSingleFieldPeriod(int period) : iPeriod(period) {
+    }
+    
+    /**
+     * Gets the amount of time this period represents.
+     *
+     * @return the amount of time this period represents
+     */
+    constexpr int getValue() const {
+        return iPeriod;
+    }
+    
+    /**
+     * Multiplies the value by a scalar.
+     *
+     * @param scalar  the amount to multiply by
+     * @return the result
+     * @throws ArithmeticException if the result overflows an int
+     */
+    int multipliedValue(int scalar) const;
+    
+    /**
+     * Divides the value by a divisor, truncating towards zero.
+     *
+     * @param divisor  the amount to divide by, must not be zero
+     * @return the result
+     * @throws ArithmeticException if the divisor is zero or the result overflows
+     */
+    int dividedValue(int divisor) const;
+    
+    /**
+     * Formats the value as an ISO8601 period with a single field.
+     *
+     * @param prefix  the text before the value, such as "PT"
+     * @param suffix  the designator after the value, such as 'H'
+     * @return the ISO8601 string
+     */
+    string toString(const char *prefix, char suffix) const;
+    
+};
+
+CODATIME_END
+
+#endif /* defined(__CodaTime__BaseSingleFieldPeriod__) */
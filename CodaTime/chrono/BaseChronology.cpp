@@ -97,9 +97,9 @@ int64_t BaseChronology::set(ReadablePartial *partial, int64_t instant) {
 }
 
 //-----------------------------------------------------------------------
-vector<int> BaseChronology::get(ReadablePeriod *period, int64_t startInstant, int64_t endInstant) {
+PeriodType::Values BaseChronology::get(ReadablePeriod *period, int64_t startInstant, int64_t endInstant) {
     int size = period->size();
-    vector<int> values = vector<int>(size);
+    PeriodType::Values values = PeriodType::Values();
     if (startInstant != endInstant) {
         for (int i = 0; i < size; i++) {
             const DurationField *field = period->getFieldType(i)->getField(this);
@@ -111,9 +111,9 @@ vector<int> BaseChronology::get(ReadablePeriod *period, int64_t startInstant, in
     return values;
 }
 
-vector<int> BaseChronology::get(ReadablePeriod *period, int64_t duration) {
+PeriodType::Values BaseChronology::get(ReadablePeriod *period, int64_t duration) {
     int size = period->size();
-    vector<int> values = vector<int>(size);
+    PeriodType::Values values = PeriodType::Values();
     if (duration != 0) {
         int64_t current = 0;
         for (int i = 0; i < size; i++) {
@@ -180,7 +180,7 @@ public:
      * @param endInstant  the start instant of an interval to query
      * @return the values of the period extracted from the interval
      */
-    vector<int> get(ReadablePeriod *period, int64_t startInstant, int64_t endInstant);
+    PeriodType::Values get(ReadablePeriod *period, int64_t startInstant, int64_t endInstant);
     
     /**
      * Gets the values of a period from an interval.
@@ -189,7 +189,7 @@ public:
      * @param duration  the duration to query
      * @return the values of the period extracted from the duration
      */
-    vector<int> get(ReadablePeriod *period, int64_t duration);
+    PeriodType::Values get(ReadablePeriod *period, int64_t duration);
     
     /**
      * Adds the period to the instant, specifying the number of times to add.
@@ -10,12 +10,110 @@
 
 #include "chrono/BasicYearDateTimeField.h"
 #include "chrono/GJLocaleSymbols.h"
+#include "CodaTimeStats.h"
+#include "CodaTimeTrace.h"
 #include "DateTimeFieldType.h"
 #include "DateTimeZone.h"
 #include "DurationFieldType.h"
+#include "field/DividedDateTimeField.h"
+#include "field/OffsetDateTimeField.h"
+#include "field/RemainderDateTimeField.h"
 
 CODATIME_BEGIN
 
+//-----------------------------------------------------------------------
+// the fields are built on first use and never destroyed, so that loading the
+// library runs no initializer and exiting runs no destructor
+const DurationField *BasicChronology::millisField() {
+    return MillisDurationField::getInstance();
+}
+
+const DurationField *BasicChronology::secondsField() {
+    static const PreciseDurationField *const cField = new PreciseDurationField(DurationFieldType::seconds(), DateTimeConstants::MILLIS_PER_SECOND);
+    return cField;
+}
+
+const DurationField *BasicChronology::minutesField() {
+    static const PreciseDurationField *const cField = new PreciseDurationField(DurationFieldType::minutes(), DateTimeConstants::MILLIS_PER_MINUTE);
+    return cField;
+}
+
+const DurationField *BasicChronology::hoursField() {
+    static const PreciseDurationField *const cField = new PreciseDurationField(DurationFieldType::hours(), DateTimeConstants::MILLIS_PER_HOUR);
+    return cField;
+}
+
+const DurationField *BasicChronology::halfdaysField() {
+    static const PreciseDurationField *const cField = new PreciseDurationField(DurationFieldType::halfdays(), DateTimeConstants::MILLIS_PER_DAY / 2);
+    return cField;
+}
+
+const DurationField *BasicChronology::daysField() {
+    static const PreciseDurationField *const cField = new PreciseDurationField(DurationFieldType::days(), DateTimeConstants::MILLIS_PER_DAY);
+    return cField;
+}
+
+const DurationField *BasicChronology::weeksField() {
+    static const PreciseDurationField *const cField = new PreciseDurationField(DurationFieldType::weeks(), DateTimeConstants::MILLIS_PER_WEEK);
+    return cField;
+}
+
+const DateTimeField *BasicChronology::millisOfSecondField() {
+    static const PreciseDateTimeField *const cField = new PreciseDateTimeField(DateTimeFieldType::millisOfSecond(), millisField(), secondsField());
+    return cField;
+}
+
+const DateTimeField *BasicChronology::millisOfDayField() {
+    static const PreciseDateTimeField *const cField = new PreciseDateTimeField(DateTimeFieldType::millisOfDay(), millisField(), daysField());
+    return cField;
+}
+
+const DateTimeField *BasicChronology::secondOfMinuteField() {
+    static const PreciseDateTimeField *const cField = new PreciseDateTimeField(DateTimeFieldType::secondOfMinute(), secondsField(), minutesField());
+    return cField;
+}
+
+const DateTimeField *BasicChronology::secondOfDayField() {
+    static const PreciseDateTimeField *const cField = new PreciseDateTimeField(DateTimeFieldType::secondOfDay(), secondsField(), daysField());
+    return cField;
+}
+
+const DateTimeField *BasicChronology::minuteOfHourField() {
+    static const PreciseDateTimeField *const cField = new PreciseDateTimeField(DateTimeFieldType::minuteOfHour(), minutesField(), hoursField());
+    return cField;
+}
+
+const DateTimeField *BasicChronology::minuteOfDayField() {
+    static const PreciseDateTimeField *const cField = new PreciseDateTimeField(DateTimeFieldType::minuteOfDay(), minutesField(), daysField());
+    return cField;
+}
+
+const DateTimeField *BasicChronology::hourOfDayField() {
+    static const PreciseDateTimeField *const cField = new PreciseDateTimeField(DateTimeFieldType::hourOfDay(), hoursField(), daysField());
+    return cField;
+}
+
+const DateTimeField *BasicChronology::hourOfHalfdayField() {
+    static const PreciseDateTimeField *const cField = new PreciseDateTimeField(DateTimeFieldType::hourOfHalfday(), hoursField(), halfdaysField());
+    return cField;
+}
+
+const DateTimeField *BasicChronology::clockhourOfDayField() {
+    static const ZeroIsMaxDateTimeField *const cField = new ZeroIsMaxDateTimeField(hourOfDayField(), DateTimeFieldType::clockhourOfDay());
+    return cField;
+}
+
+const DateTimeField *BasicChronology::clockhourOfHalfdayField() {
+    static const ZeroIsMaxDateTimeField *const cField = new ZeroIsMaxDateTimeField(hourOfHalfdayField(), DateTimeFieldType::clockhourOfHalfday());
+    return cField;
+}
+
+const DateTimeField *BasicChronology::halfdayOfDayField() {
+    static const HalfdayField *const cField = new HalfdayField();
+    return cField;
+}
+
+//-----------------------------------------------------------------------
 string BasicChronology::HalfdayField::getAsText(int fieldValue, Locale *locale) const {
     return GJLocaleSymbols::forLocale(locale)->halfdayValueToText(fieldValue);
 }
@@ -30,7 +128,9 @@ int BasicChronology::HalfdayField::getMaximumTextLength(Locale *locale) {
 
 BasicChronology::BasicChronology(Chronology *base, Object *param, int minDaysInFirstWeek) : AssembledChronology(base, param) {
     
-    iYearInfoCache.resize(CACHE_SIZE);
+    for (int i = 0; i < CACHE_SIZE; i++) {
+        iYearInfoCache[i].store(NULL, memory_order_relaxed);
+    }
     
     if (minDaysInFirstWeek < 1 || minDaysInFirstWeek > 7) {
         string str("Invalid min days in first week: ");
@@ -42,11 +142,20 @@ BasicChronology::BasicChronology(Chronology *base, Object *param, int minDaysInF
 }
 
 // Although accessed by multiple threads, this method doesn't need to be synchronized.
+// Two threads may both calculate a year, and the loser's info is simply replaced.
+// Replaced infos are never deleted, as another thread may still be reading them.
 BasicChronology::YearInfo *BasicChronology::getYearInfo(int year) {
-    YearInfo *info = iYearInfoCache[year & CACHE_MASK];
-    if (info == NULL || info->iYear != year) {
-        info = new YearInfo(year, calculateFirstDayOfYearMillis(year));
-        iYearInfoCache[year & CACHE_MASK] = info;
+    atomic<YearInfo*> &entry = iYearInfoCache[year & CACHE_MASK];
+    YearInfo *info = entry.load(memory_order_acquire);
+    if (info != NULL && info->iYear == year) {
+        CODATIME_STATS_HIT(YEAR_INFO);
+        return info;
+    }
+    CODATIME_TRACE_SPAN(span, YEAR_INFO_MISS, year, string());
+    info = new YearInfo(year, calculateFirstDayOfYearMillis(year));
+    CODATIME_STATS_MISS(YEAR_INFO, sizeof(YearInfo));
+    if (entry.exchange(info, memory_order_acq_rel) != NULL) {
+        CODATIME_STATS_EVICTION(YEAR_INFO, sizeof(YearInfo));
     }
     return info;
 }
@@ -278,7 +387,7 @@ DateTimeZone *BasicChronology::getZone() const {
     if ((base = getBase()) != NULL) {
         return base->getZone();
     }
-    return DateTimeZone::UTC;
+    return DateTimeZone::UTC();
 }
 
 int64_t BasicChronology::getDateTimeMillis(int year, int monthOfYear, int dayOfMonth, int millisOfDay) {
@@ -378,25 +487,25 @@ void BasicChronology::assemble(Fields *fields) {
     // First copy fields that are the same for all Gregorian and Julian
     // chronologies.
     
-    fields->millis = cMillisField;
-    fields->seconds = cSecondsField;
-    fields->minutes = cMinutesField;
-    fields->hours = cHoursField;
-    fields->halfdays = cHalfdaysField;
-    fields->days = cDaysField;
-    fields->weeks = cWeeksField;
+    fields->millis = millisField();
+    fields->seconds = secondsField();
+    fields->minutes = minutesField();
+    fields->hours = hoursField();
+    fields->halfdays = halfdaysField();
+    fields->days = daysField();
+    fields->weeks = weeksField();
     
-    fields->millisOfSecond = cMillisOfSecondField;
-    fields->millisOfDay = cMillisOfDayField;
-    fields->secondOfMinute = cSecondOfMinuteField;
-    fields->secondOfDay = cSecondOfDayField;
-    fields->minuteOfHour = cMinuteOfHourField;
-    fields->minuteOfDay = cMinuteOfDayField;
-    fields->hourOfDay = cHourOfDayField;
-    fields->hourOfHalfday = cHourOfHalfdayField;
-    fields->clockhourOfDay = cClockhourOfDayField;
-    fields->clockhourOfHalfday = cClockhourOfHalfdayField;
-    fields->halfdayOfDay = cHalfdayOfDayField;
+    fields->millisOfSecond = millisOfSecondField();
+    fields->millisOfDay = millisOfDayField();
+    fields->secondOfMinute = secondOfMinuteField();
+    fields->secondOfDay = secondOfDayField();
+    fields->minuteOfHour = minuteOfHourField();
+    fields->minuteOfDay = minuteOfDayField();
+    fields->hourOfDay = hourOfDayField();
+    fields->hourOfHalfday = hourOfHalfdayField();
+    fields->clockhourOfDay = clockhourOfDayField();
+    fields->clockhourOfHalfday = clockhourOfHalfdayField();
+    fields->halfdayOfDay = halfdayOfDayField();
     
     // Now create fields that have unique behavior for Gregorian and Julian
     // chronologies.
@@ -409,7 +518,7 @@ void BasicChronology::assemble(Fields *fields) {
     fields->centuryOfEra = new DividedDateTimeField(field, DateTimeFieldType::centuryOfEra(), 100);
     fields->centuries = fields->centuryOfEra->getDurationField();
     
-    field = new RemainderDateTimeField((DividedDateTimeField) fields->centuryOfEra);
+    field = new RemainderDateTimeField((const DividedDateTimeField*) fields->centuryOfEra);
     fields->yearOfCentury = new OffsetDateTimeField(field, DateTimeFieldType::yearOfCentury(), 1);
     
     fields->era = new GJEraDateTimeField(this);
@@ -18,6 +18,7 @@
 #include "field/PreciseDurationField.h"
 #include "field/ZeroIsMaxDateTimeField.h"
 
+#include <atomic>
 #include <vector>
 
 using namespace std;
@@ -47,25 +48,27 @@ private:
     /** Serialization lock */
     static const long long serialVersionUID = 8283225332206808863L;
     
-    static const DurationField *cMillisField;
-    static const DurationField *cSecondsField;
-    static const DurationField *cMinutesField;
-    static const DurationField *cHoursField;
-    static const DurationField *cHalfdaysField;
-    static const DurationField *cDaysField;
-    static const DurationField *cWeeksField;
-    
-    static const DateTimeField *cMillisOfSecondField;
-    static const DateTimeField *cMillisOfDayField;
-    static const DateTimeField *cSecondOfMinuteField;
-    static const DateTimeField *cSecondOfDayField;
-    static const DateTimeField *cMinuteOfHourField;
-    static const DateTimeField *cMinuteOfDayField;
-    static const DateTimeField *cHourOfDayField;
-    static const DateTimeField *cHourOfHalfdayField;
-    static const DateTimeField *cClockhourOfDayField;
-    static const DateTimeField *cClockhourOfHalfdayField;
-    static const DateTimeField *cHalfdayOfDayField;
+    // The fields shared by every instance are built on first use rather than
+    // by a static initializer, so they are safe to use from any other one.
+    static const DurationField *millisField();
+    static const DurationField *secondsField();
+    static const DurationField *minutesField();
+    static const DurationField *hoursField();
+    static const DurationField *halfdaysField();
+    static const DurationField *daysField();
+    static const DurationField *weeksField();
+    
+    static const DateTimeField *millisOfSecondField();
+    static const DateTimeField *millisOfDayField();
+    static const DateTimeField *secondOfMinuteField();
+    static const DateTimeField *secondOfDayField();
+    static const DateTimeField *minuteOfHourField();
+    static const DateTimeField *minuteOfDayField();
+    static const DateTimeField *hourOfDayField();
+    static const DateTimeField *hourOfHalfdayField();
+    static const DateTimeField *clockhourOfDayField();
+    static const DateTimeField *clockhourOfHalfdayField();
+    static const DateTimeField *halfdayOfDayField();
     
     class HalfdayField : public PreciseDateTimeField {
         
@@ -75,7 +78,7 @@ private:
         
     public:
         
-        HalfdayField() : PreciseDateTimeField(DateTimeFieldType::halfdayOfDay(), cHalfdaysField, cDaysField) {
+        HalfdayField() : PreciseDateTimeField(DateTimeFieldType::halfdayOfDay(), halfdaysField(), daysField()) {
         }
         
         string getAsText(int fieldValue, Locale *locale) const;
@@ -97,62 +100,11 @@ private:
         }
     };
     
-    struct StaticBlock {
-        StaticBlock() {
-            cMillisField = MillisDurationField::INSTANCE;
-            cSecondsField = new PreciseDurationField
-            (DurationFieldType::seconds(), DateTimeConstants::MILLIS_PER_SECOND);
-            cMinutesField = new PreciseDurationField
-            (DurationFieldType::minutes(), DateTimeConstants::MILLIS_PER_MINUTE);
-            cHoursField = new PreciseDurationField
-            (DurationFieldType::hours(), DateTimeConstants::MILLIS_PER_HOUR);
-            cHalfdaysField = new PreciseDurationField
-            (DurationFieldType::halfdays(), DateTimeConstants::MILLIS_PER_DAY / 2);
-            cDaysField = new PreciseDurationField
-            (DurationFieldType::days(), DateTimeConstants::MILLIS_PER_DAY);
-            cWeeksField = new PreciseDurationField
-            (DurationFieldType::weeks(), DateTimeConstants::MILLIS_PER_WEEK);
-            
-            cMillisOfSecondField = new PreciseDateTimeField
-            (DateTimeFieldType::millisOfSecond(), cMillisField, cSecondsField);
-            
-            cMillisOfDayField = new PreciseDateTimeField
-            (DateTimeFieldType::millisOfDay(), cMillisField, cDaysField);
-            
-            cSecondOfMinuteField = new PreciseDateTimeField
-            (DateTimeFieldType::secondOfMinute(), cSecondsField, cMinutesField);
-            
-            cSecondOfDayField = new PreciseDateTimeField
-            (DateTimeFieldType::secondOfDay(), cSecondsField, cDaysField);
-            
-            cMinuteOfHourField = new PreciseDateTimeField
-            (DateTimeFieldType::minuteOfHour(), cMinutesField, cHoursField);
-            
-            cMinuteOfDayField = new PreciseDateTimeField
-            (DateTimeFieldType::minuteOfDay(), cMinutesField, cDaysField);
-            
-            cHourOfDayField = new PreciseDateTimeField
-            (DateTimeFieldType::hourOfDay(), cHoursField, cDaysField);
-            
-            cHourOfHalfdayField = new PreciseDateTimeField
-            (DateTimeFieldType::hourOfHalfday(), cHoursField, cHalfdaysField);
-            
-            cClockhourOfDayField = new ZeroIsMaxDateTimeField
-            (cHourOfDayField, DateTimeFieldType::clockhourOfDay());
-            
-            cClockhourOfHalfdayField = new ZeroIsMaxDateTimeField
-            (cHourOfHalfdayField, DateTimeFieldType::clockhourOfHalfday());
-            
-            cHalfdayOfDayField = new HalfdayField();
-        }
-    };
-    
-    static StaticBlock staticBlock;
-    
     static const int CACHE_SIZE = 1 << 10;
     static const int CACHE_MASK = CACHE_SIZE - 1;
     
-    vector<YearInfo*> iYearInfoCache;
+    /** Cache of year info, published atomically as other threads read it without a lock */
+    atomic<YearInfo*> iYearInfoCache[CACHE_SIZE];
     
     int iMinDaysInFirstWeek;
     
@@ -493,7 +445,7 @@ protected:
      * @return the updated millis
      */
     virtual int64_t setYear(int64_t instant, int year) = 0;
-
+    
 };
 
 CODATIME_END
@@ -14,8 +14,6 @@
 #include "chrono/BasicChronology.h"
 #include "DateTimeConstants.h"
 
-#include <vector>
-
 using namespace std;
 
 CODATIME_BEGIN
@@ -42,35 +40,47 @@ private:
     
     // These arrays are NOT public. We trust ourselves not to alter the array.
     // They use zero-based array indexes so the that valid range of months is
-    // automatically checked.
-    static const vector<int> MIN_DAYS_PER_MONTH_ARRAY;
-    static const vector<int> MAX_DAYS_PER_MONTH_ARRAY;
-    static vector<int64_t> MIN_TOTAL_MILLIS_BY_MONTH_ARRAY;
-    static vector<int64_t> MAX_TOTAL_MILLIS_BY_MONTH_ARRAY;
-    static const int64_t FEB_29 = (31L + 29 - 1) * DateTimeConstants::MILLIS_PER_DAY;
+    // automatically checked. They are constant initialized, so they are ready
+    // before any code runs and need no static initializer.
+    static const int *minDaysPerMonth() {
+        static const int DAYS[12] = {
+            31,28,31,30,31,30,31,31,30,31,30,31
+        };
+        return DAYS;
+    }
     
-    struct StaticBlock {
-        StaticBlock() {
-            MIN_TOTAL_MILLIS_BY_MONTH_ARRAY.resize(12);
-            MAX_TOTAL_MILLIS_BY_MONTH_ARRAY.resize(12);
-            
-            int64_t minSum = 0;
-            int64_t maxSum = 0;
-            for (int i = 0; i < 11; i++) {
-                int64_t millis = MIN_DAYS_PER_MONTH_ARRAY[i]
-                * (int64_t)DateTimeConstants::MILLIS_PER_DAY;
-                minSum += millis;
-                MIN_TOTAL_MILLIS_BY_MONTH_ARRAY[i + 1] = minSum;
-                
-                millis = MAX_DAYS_PER_MONTH_ARRAY[i]
-                * (int64_t)DateTimeConstants::MILLIS_PER_DAY;
-                maxSum += millis;
-                MAX_TOTAL_MILLIS_BY_MONTH_ARRAY[i + 1] = maxSum;
-            }
-        }
-    };
+    static const int *maxDaysPerMonth() {
+        static const int DAYS[12] = {
+            31,29,31,30,31,30,31,31,30,31,30,31
+        };
+        return DAYS;
+    }
     
-    static StaticBlock staticBlock;
+    static const int64_t *minTotalMillisByMonth() {
+        static const int64_t MILLIS[12] = {
+            0LL * DateTimeConstants::MILLIS_PER_DAY, 31LL * DateTimeConstants::MILLIS_PER_DAY,
+            59LL * DateTimeConstants::MILLIS_PER_DAY, 90LL * DateTimeConstants::MILLIS_PER_DAY,
+            120LL * DateTimeConstants::MILLIS_PER_DAY, 151LL * DateTimeConstants::MILLIS_PER_DAY,
+            181LL * DateTimeConstants::MILLIS_PER_DAY, 212LL * DateTimeConstants::MILLIS_PER_DAY,
+            243LL * DateTimeConstants::MILLIS_PER_DAY, 273LL * DateTimeConstants::MILLIS_PER_DAY,
+            304LL * DateTimeConstants::MILLIS_PER_DAY, 334LL * DateTimeConstants::MILLIS_PER_DAY,
+        };
+        return MILLIS;
+    }
+    
+    static const int64_t *maxTotalMillisByMonth() {
+        static const int64_t MILLIS[12] = {
+            0LL * DateTimeConstants::MILLIS_PER_DAY, 31LL * DateTimeConstants::MILLIS_PER_DAY,
+            60LL * DateTimeConstants::MILLIS_PER_DAY, 91LL * DateTimeConstants::MILLIS_PER_DAY,
+            121LL * DateTimeConstants::MILLIS_PER_DAY, 152LL * DateTimeConstants::MILLIS_PER_DAY,
+            182LL * DateTimeConstants::MILLIS_PER_DAY, 213LL * DateTimeConstants::MILLIS_PER_DAY,
+            244LL * DateTimeConstants::MILLIS_PER_DAY, 274LL * DateTimeConstants::MILLIS_PER_DAY,
+            305LL * DateTimeConstants::MILLIS_PER_DAY, 335LL * DateTimeConstants::MILLIS_PER_DAY,
+        };
+        return MILLIS;
+    }
+    
+    static const int64_t FEB_29 = (31L + 29 - 1) * DateTimeConstants::MILLIS_PER_DAY;
     
 protected:
     
@@ -123,15 +133,15 @@ protected:
      */
     int getDaysInYearMonth(int year, int month) {
         if (isLeapYear(year)) {
-            return MAX_DAYS_PER_MONTH_ARRAY[month - 1];
+            return maxDaysPerMonth()[month - 1];
         } else {
-            return MIN_DAYS_PER_MONTH_ARRAY[month - 1];
+            return minDaysPerMonth()[month - 1];
         }
     }
     
     //-----------------------------------------------------------------------
     int getDaysInMonthMax(int month) {
-        return MAX_DAYS_PER_MONTH_ARRAY[month - 1];
+        return maxDaysPerMonth()[month - 1];
     }
     
     //-----------------------------------------------------------------------
@@ -142,9 +152,9 @@ protected:
     //-----------------------------------------------------------------------
     int64_t getTotalMillisByYearMonth(int year, int month) {
         if (isLeapYear(year)) {
-            return MAX_TOTAL_MILLIS_BY_MONTH_ARRAY[month - 1];
+            return maxTotalMillisByMonth()[month - 1];
         } else {
-            return MIN_TOTAL_MILLIS_BY_MONTH_ARRAY[month - 1];
+            return minTotalMillisByMonth()[month - 1];
         }
     }
     
@@ -205,14 +215,6 @@ protected:
     
 };
 
-const vector<int> BasicGJChronology::MIN_DAYS_PER_MONTH_ARRAY = {
-    31,28,31,30,31,30,31,31,30,31,30,31
-};
-
-const vector<int> BasicGJChronology::MAX_DAYS_PER_MONTH_ARRAY = {
-    31,29,31,30,31,30,31,31,30,31,30,31
-};
-
 CODATIME_END
 
 #endif
@@ -11,13 +11,16 @@
 
 #include "CodaTimeMacros.h"
 
+#include "CodaTimeStats.h"
 #include "CodaTimeUtils.h"
 #include "DateTimeFieldType.h"
 #include "Exceptions.h"
 #include "Locale.h"
 
+#include <atomic>
 #include <vector>
 #include <map>
+#include <mutex>
 #include <string>
 
 using namespace std;
@@ -36,9 +39,23 @@ private:
     
     static const int FAST_CACHE_SIZE = 64;
     
-    static vector<GJLocaleSymbols*> cFastCache;
+    /** Gets the cache, created on first use and never destroyed */
+    static map<Locale*, GJLocaleSymbols*> &getCache() {
+        static map<Locale*, GJLocaleSymbols*> *const cCache = new map<Locale*, GJLocaleSymbols*>();
+        return *cCache;
+    }
     
-    static map<Locale*, GJLocaleSymbols*> cCache;
+    /** Gets the fast cache, zero initialized before any code runs */
+    static atomic<GJLocaleSymbols*> *getFastCache() {
+        static atomic<GJLocaleSymbols*> cFastCache[FAST_CACHE_SIZE];
+        return cFastCache;
+    }
+    
+    /** Gets the lock for the cache, created on first use and never destroyed */
+    static mutex &getCacheLock() {
+        static mutex *const cCacheLock = new mutex();
+        return *cCacheLock;
+    }
     
     static void addSymbols(map<string, int, CodaTimeUtils::InsensitiveCompare> &map, vector<string> symbols, vector<int> integers) {
         for (int i = (int) symbols.size(); --i >= 0; ) {
@@ -140,19 +157,23 @@ public:
             locale = Locale::getDefault();
         }
         int index = 0; // TODO: Fix this -> System.identityHashCode(locale) & (FAST_CACHE_SIZE - 1);
-        GJLocaleSymbols *symbols = cFastCache[index];
+        GJLocaleSymbols *symbols = getFastCache()[index].load(memory_order_acquire);
         if (symbols != NULL && symbols->iLocale == locale) {
+            CODATIME_STATS_HIT(LOCALE_SYMBOLS);
             return symbols;
         }
-        // TODO: synchronize
-//        synchronized (cCache) {
-            symbols = cCache[locale];
+        {
+            lock_guard<mutex> lock(getCacheLock());
+            symbols = getCache()[locale];
             if (symbols == NULL) {
                 symbols = new GJLocaleSymbols(locale);
-                cCache[locale] = symbols;
+                getCache()[locale] = symbols;
+                CODATIME_STATS_MISS(LOCALE_SYMBOLS, sizeof(GJLocaleSymbols));
+            } else {
+                CODATIME_STATS_HIT(LOCALE_SYMBOLS);
             }
-//        }
-        cFastCache[index] = symbols;
+        }
+        getFastCache()[index].store(symbols, memory_order_release);
         return symbols;
     }
     
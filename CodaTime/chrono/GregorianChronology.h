@@ -12,11 +12,13 @@
 #include "CodaTimeMacros.h"
 
 #include "chrono/BasicGJChronology.h"
+#include "CodaTimeStats.h"
 #include "DateTimeConstants.h"
 #include "DateTimeZone.h"
 #include "Exceptions.h"
 
 #include <map>
+#include <mutex>
 #include <vector>
 
 using namespace std;
@@ -64,19 +66,17 @@ private:
     /** The highest year that can be fully supported. */
     static const int MAX_YEAR = 292278993;
     
-    /** Singleton instance of a UTC GregorianChronology */
-    static GregorianChronology *INSTANCE_UTC;
-    
-    /** Cache of zone to chronology arrays */
-    static map<DateTimeZone*, vector<GregorianChronology*>> cCache;
-    
-    struct StaticBlock {
-        StaticBlock() {
-            INSTANCE_UTC = getInstance(DateTimeZone::UTC);
-        }
-    };
+    /** Gets the cache of zone to chronology arrays, created on first use and never destroyed */
+    static map<DateTimeZone*, vector<GregorianChronology*>> &getCache() {
+        static map<DateTimeZone*, vector<GregorianChronology*>> *const cCache = new map<DateTimeZone*, vector<GregorianChronology*>>();
+        return *cCache;
+    }
     
-    static StaticBlock staticBlock;
+    /** Gets the lock for the cache, created on first use and never destroyed */
+    static mutex &getCacheLock() {
+        static mutex *const cCacheLock = new mutex();
+        return *cCacheLock;
+    }
     
     // Constructors and instance variables
     //-----------------------------------------------------------------------
@@ -95,7 +95,7 @@ private:
         int minDays = getMinimumDaysInFirstWeek();
         minDays = (minDays == 0 ? 4 : minDays);  // handle rename of BaseGJChronology
         return (base == NULL) ?
-        getInstance(DateTimeZone::UTC, minDays) :
+        getInstance(DateTimeZone::UTC(), minDays) :
         getInstance(base->getZone(), minDays);
     }
     
@@ -156,7 +156,8 @@ public:
      * @return a singleton UTC instance of the chronology
      */
     static GregorianChronology *getInstanceUTC() {
-        return INSTANCE_UTC;
+        static GregorianChronology *cInstanceUTC = getInstance(DateTimeZone::UTC());
+        return cInstanceUTC;
     }
     
     /**
@@ -189,29 +190,31 @@ public:
         if (zone == NULL) {
             zone = DateTimeZone::getDefault();
         }
-        GregorianChronology *chrono = NULL;
-        //TODO: synchronized
-//        synchronized (cCache) {
-            vector<GregorianChronology*> &chronos = cCache.get(zone);
-            if (chronos.empty()) {
-                chronos.resize(7);
-                cCache[zone] = chronos;
-            }
-            try {
-                chrono = chronos[minDaysInFirstWeek - 1];
-            } catch (ArrayIndexOutOfBoundsException e) {
-                throw IllegalArgumentException("Invalid min days in first week: " + to_string(minDaysInFirstWeek));
-            }
-            if (chrono == NULL) {
-                if (zone == DateTimeZone::UTC) {
-                    chrono = new GregorianChronology(NULL, NULL, minDaysInFirstWeek);
-                } else {
-                    chrono = getInstance(DateTimeZone::UTC, minDaysInFirstWeek);
-                    chrono = new GregorianChronology(ZonedChronology::getInstance(chrono, zone), NULL, minDaysInFirstWeek);
-                }
-                chronos[minDaysInFirstWeek - 1] = chrono;
+        if (minDaysInFirstWeek < 1 || minDaysInFirstWeek > 7) {
+            throw IllegalArgumentException("Invalid min days in first week: " + to_string(minDaysInFirstWeek));
+        }
+        // the UTC instance is found first, as the lock is not reentrant
+        GregorianChronology *utc = NULL;
+        if (zone != DateTimeZone::UTC()) {
+            utc = getInstance(DateTimeZone::UTC(), minDaysInFirstWeek);
+        }
+        lock_guard<mutex> lock(getCacheLock());
+        vector<GregorianChronology*> &chronos = getCache()[zone];
+        if (chronos.empty()) {
+            chronos.resize(7);
+        }
+        GregorianChronology *chrono = chronos[minDaysInFirstWeek - 1];
+        if (chrono == NULL) {
+            if (utc == NULL) {
+                chrono = new GregorianChronology(NULL, NULL, minDaysInFirstWeek);
+            } else {
+                chrono = new GregorianChronology(ZonedChronology::getInstance(utc, zone), NULL, minDaysInFirstWeek);
             }
-//        }
+            chronos[minDaysInFirstWeek - 1] = chrono;
+            CODATIME_STATS_MISS(GREGORIAN_CHRONOLOGY, sizeof(GregorianChronology));
+        } else {
+            CODATIME_STATS_HIT(GREGORIAN_CHRONOLOGY);
+        }
         return chrono;
     }
     
@@ -223,7 +226,7 @@ public:
      * @return the chronology in UTC
      */
     Chronology *withUTC() {
-        return INSTANCE_UTC;
+        return getInstanceUTC();
     }
     
     /**
@@ -8,8 +8,26 @@
 
 #include "ISOChronology.h"
 
+#include "CodaTimeStats.h"
+#include "DateTimeFieldType.h"
+#include "field/DividedDateTimeField.h"
+#include "field/RemainderDateTimeField.h"
+
 CODATIME_BEGIN
 
+atomic<ISOChronology*> ISOChronology::cFastCache[FAST_CACHE_SIZE];
+
+// the cache and its lock are never destroyed, so exiting runs no destructor
+map<DateTimeZone*, ISOChronology*> &ISOChronology::getCache() {
+    static map<DateTimeZone*, ISOChronology*> *const cCache = new map<DateTimeZone*, ISOChronology*>();
+    return *cCache;
+}
+
+mutex &ISOChronology::getCacheLock() {
+    static mutex *const cCacheLock = new mutex();
+    return *cCacheLock;
+}
+
 /**
  * Gets an instance of the ISOChronology.
  * The time zone of the returned instance is UTC.
@@ -17,7 +35,8 @@ CODATIME_BEGIN
  * @return a singleton UTC instance of the chronology
  */
 ISOChronology *ISOChronology::getInstanceUTC() {
-    return INSTANCE_UTC;
+    static ISOChronology *cInstanceUTC = new ISOChronology(GregorianChronology::getInstanceUTC());
+    return cInstanceUTC;
 }
 
 /**
@@ -39,20 +58,29 @@ ISOChronology *ISOChronology::getInstance(DateTimeZone *zone) {
     if (zone == NULL) {
         zone = DateTimeZone::getDefault();
     }
+    if (zone == DateTimeZone::UTC()) {
+        return getInstanceUTC();
+    }
     int index = 0;//System.identityHashCode(zone) & (FAST_CACHE_SIZE - 1);
-    ISOChronology *chrono = cFastCache[index];
+    ISOChronology *chrono = cFastCache[index].load(memory_order_acquire);
     if (chrono != NULL && chrono->getZone() == zone) {
+        CODATIME_STATS_HIT(ISO_CHRONOLOGY);
         return chrono;
     }
-    // TODO: synchronized
-//    synchronized (cCache) {
-        chrono = cCache[zone];
+    ISOChronology *utc = getInstanceUTC();
+    {
+        lock_guard<mutex> lock(getCacheLock());
+        map<DateTimeZone*, ISOChronology*> &cache = getCache();
+        chrono = cache[zone];
         if (chrono == NULL) {
-            chrono = new ISOChronology(ZonedChronology::getInstance(INSTANCE_UTC, zone));
-            cCache[zone] = chrono;
+            chrono = new ISOChronology(ZonedChronology::getInstance(utc, zone));
+            cache[zone] = chrono;
+            CODATIME_STATS_MISS(ISO_CHRONOLOGY, sizeof(ISOChronology));
+        } else {
+            CODATIME_STATS_HIT(ISO_CHRONOLOGY);
         }
-//    }
-    cFastCache[index] = chrono;
+    }
+    cFastCache[index].store(chrono, memory_order_release);
     return chrono;
 }
 
@@ -94,13 +122,13 @@ string ISOChronology::toString() {
 }
 
 void ISOChronology::assemble(Fields *fields) {
-    if (getBase()->getZone() == DateTimeZone::UTC) {
+    if (getBase()->getZone() == DateTimeZone::UTC()) {
         // Use zero based century and year of century.
         fields->centuryOfEra = new DividedDateTimeField(ISOYearOfEraDateTimeField::INSTANCE, DateTimeFieldType::centuryOfEra(), 100);
         fields->centuries = fields->centuryOfEra->getDurationField();
         
-        fields->yearOfCentury = new RemainderDateTimeField((DividedDateTimeField*) fields->centuryOfEra, DateTimeFieldType::yearOfCentury());
-        fields->weekyearOfCentury = new RemainderDateTimeField((DividedDateTimeField*) fields->centuryOfEra, fields->weekyears, DateTimeFieldType::weekyearOfCentury());
+        fields->yearOfCentury = new RemainderDateTimeField((const DividedDateTimeField*) fields->centuryOfEra, DateTimeFieldType::yearOfCentury());
+        fields->weekyearOfCentury = new RemainderDateTimeField((const DividedDateTimeField*) fields->centuryOfEra, fields->weekyears, DateTimeFieldType::weekyearOfCentury());
     }
 }
 
@@ -130,9 +158,8 @@ bool ISOChronology::equals(const Object *obj) const {
  * @since 1.6
  */
 int ISOChronology::hashCode() {
-    string iso("ISO");
-    hash<string> hash;
-    return hash(iso) * 11 + getZone()->hashCode();
+    static const int ISO_HASH = (int) hash<string>()("ISO");
+    return ISO_HASH * 11 + getZone()->hashCode();
 }
 
 //-----------------------------------------------------------------------
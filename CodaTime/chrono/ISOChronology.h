@@ -15,9 +15,11 @@
 #include "chrono/GregorianChronology.h"
 #include "DateTimeZone.h"
 
+#include <atomic>
+#include <map>
+#include <mutex>
 #include <string>
 #include <vector>
-#include <map>
 
 using namespace std;
 
@@ -30,26 +32,16 @@ private:
     /** Serialization lock */
     static const long long serialVersionUID = -6212696554273812441L;
     
-    /** Singleton instance of a UTC ISOChronology */
-    static ISOChronology *INSTANCE_UTC;
-    
     static const int FAST_CACHE_SIZE = 64;
     
-    /** Fast cache of zone to chronology */
-    static vector<ISOChronology*> cFastCache;
-    
-    /** Cache of zone to chronology */
-    static map<DateTimeZone*, ISOChronology*> cCache;
+    /** Fast cache of zone to chronology, zero initialized before any code runs */
+    static atomic<ISOChronology*> cFastCache[FAST_CACHE_SIZE];
     
-    struct StaticBlock {
-        StaticBlock() {
-            cFastCache.resize(FAST_CACHE_SIZE);
-            INSTANCE_UTC = new ISOChronology(GregorianChronology::getInstanceUTC());
-            cCache[DateTimeZone::UTC] = INSTANCE_UTC;
-        }
-    };
+    /** Cache of zone to chronology, created on first use */
+    static map<DateTimeZone*, ISOChronology*> &getCache();
     
-    static StaticBlock staticBlock;
+    /** Lock for the cache, created on first use */
+    static mutex &getCacheLock();
     
     /**
      * Restricted constructor
@@ -69,7 +61,7 @@ public:
      * @return the chronology in UTC
      */
     Chronology *withUTC() {
-        return INSTANCE_UTC;
+        return getInstanceUTC();
     }
     
     Chronology *withZone(DateTimeZone *zone);
@@ -346,7 +346,7 @@ public:
      * @since 1.2
      */
     Interval *toInterval() {
-        DateTimeField *field = getField();
+        const DateTimeField *field = getField();
         int64_t start = field->roundFloor(getMillis());
         int64_t end = field->add(start, 1);
         Interval *interval = new Interval(start, end);
@@ -471,7 +471,7 @@ protected:
      * @return the chronology
      * @since 1.4
      */
-    Chronology *getChronology() const {
+    virtual Chronology *getChronology() const {
         throw UnsupportedOperationException("The method getChronology() was added in v1.4 and needs to be implemented by subclasses of AbstractReadableInstantFieldProperty");
     }
 
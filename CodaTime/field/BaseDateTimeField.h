@@ -15,7 +15,7 @@
 #include "DateTimeFieldType.h"
 #include "Exceptions.h"
 #include "field/FieldUtils.h"
-#include "Readablepartial.h"
+#include "ReadablePartial.h"
 
 #include <vector>
 #include <string>
@@ -0,0 +1,348 @@
+//
+//  DividedDateTimeField.h
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#ifndef CodaTime_DividedDateTimeField_h
+#define CodaTime_DividedDateTimeField_h
+
+#include "CodaTimeMacros.h"
+
+#include "DateTimeField.h"
+#include "DateTimeFieldType.h"
+#include "DurationField.h"
+#include "Exceptions.h"
+#include "field/DecoratedDateTimeField.h"
+#include "field/FieldUtils.h"
+#include "field/OffsetDateTimeField.h"
+#include "field/ScaledDurationField.h"
+
+#include <cstdint>
+
+using namespace std;
+
+CODATIME_BEGIN
+
+/**
+ * Floor division of field values by a fixed divisor.
+ * <p>
+ * The divisor is turned into a multiplier and a shift when constructed, so
+ * that dividing a value is a multiplication instead of an integer division.
+ * The quotient is rounded towards negative infinity, so that -1 divided by
+ * 100 is -1 and the remainder is always between zero and the divisor.
+ * <p>
+ * FieldDivisor is thread-safe and immutable.
+ */
+class FieldDivisor {
+    
+private:
+    
+    int iDivisor;
+    uint64_t iMultiplier;
+    int iShift;
+    
+public:
+    
+    /**
+     * Constructor.
+     *
+     * @param divisor  the divisor, at least one
+     * @throws IllegalArgumentException if the divisor is less than one
+     */
+    FieldDivisor(int divisor) {
+        if (divisor < 1) {
+            throw IllegalArgumentException("The divisor must be at least 1");
+        }
+        int bits = 0;
+        while ((((int64_t) 1) << bits) < divisor) {
+            bits++;
+        }
+        // ceil(2^(31 + bits) / divisor) is exact for every 31 bit numerator
+        iDivisor = divisor;
+        iShift = 31 + bits;
+        iMultiplier = ((((uint64_t) 1) << iShift) + divisor - 1) / divisor;
+    }
+    
+    /**
+     * Divides a value, rounding towards negative infinity.
+     *
+     * @param value  the value to divide
+     * @return the quotient
+     */
+    int divide(int value) const {
+        if (value >= 0) {
+            return (int) ((((uint64_t) value) * iMultiplier) >> iShift);
+        }
+        return -1 - (int) ((((uint64_t) (-1 - value)) * iMultiplier) >> iShift);
+    }
+    
+    /**
+     * Gets the remainder of dividing a value, which is never negative.
+     *
+     * @param value  the value to divide
+     * @return the remainder, from zero to one less than the divisor
+     */
+    int remainder(int value) const {
+        return (int) (value - ((int64_t) divide(value)) * iDivisor);
+    }
+    
+    /**
+     * Gets the divisor.
+     *
+     * @return the divisor
+     */
+    int getDivisor() const {
+        return iDivisor;
+    }
+    
+};
+
+/**
+ * Divides a DateTimeField such that the retrieved values are reduced by a
+ * fixed divisor. The field's unit duration is scaled accordingly, but the
+ * field's range duration is unchanged.
+ * <p>
+ * When the wrapped field is an {@link OffsetDateTimeField} that keeps the
+ * bounds of its own wrapped field, such as the year of era offset by 99 that
+ * the century of era is divided from, the offset is applied here instead, so
+ * that reading the field calls the underlying field directly.
+ * <p>
+ * DividedDateTimeField is thread-safe and immutable.
+ *
+ * @see RemainderDateTimeField
+ *
+ * @author Stephen Colebourne
+ * @author Brian S O'Neill
+ * @since 1.0
+ */
+class DividedDateTimeField : public DecoratedDateTimeField {
+    
+private:
+    
+    static const long long serialVersionUID = 8318475124230605365L;
+    
+    FieldDivisor iDivisor;
+    int iWrappedOffset;
+    const DurationField *iDurationField;
+    
+    int iMin;
+    int iMax;
+    const DurationField *iRangeDurationField;
+    
+    static const DateTimeField *getUnderlyingField(const DateTimeField *field) {
+        const OffsetDateTimeField *offsetField = dynamic_cast<const OffsetDateTimeField*>(field);
+        if (offsetField != NULL && offsetField->hasWrappedBounds()) {
+            return offsetField->getWrappedField();
+        }
+        return field;
+    }
+    
+    static int getUnderlyingOffset(const DateTimeField *field) {
+        const OffsetDateTimeField *offsetField = dynamic_cast<const OffsetDateTimeField*>(field);
+        if (offsetField != NULL && offsetField->hasWrappedBounds()) {
+            return offsetField->getOffset();
+        }
+        return 0;
+    }
+    
+    static int checkDivisor(int divisor) {
+        if (divisor < 2) {
+            throw IllegalArgumentException("The divisor must be at least 2");
+        }
+        return divisor;
+    }
+    
+    void init(const DateTimeField *field, const DurationField *rangeField,
+              const DateTimeFieldType *type, int divisor) {
+        const DurationField *unitField = field->getDurationField();
+        if (unitField == NULL) {
+            iDurationField = NULL;
+        } else {
+            iDurationField = new ScaledDurationField(unitField, type->getDurationType(), divisor);
+        }
+        
+        iRangeDurationField = rangeField;
+        iWrappedOffset = getUnderlyingOffset(field);
+        iMin = iDivisor.divide(field->getMinimumValue());
+        iMax = iDivisor.divide(field->getMaximumValue());
+    }
+    
+public:
+    
+    /**
+     * Constructor.
+     *
+     * @param field  the field to wrap, like "year()".
+     * @param type  the field type this field will actually use
+     * @param divisor  divisor, such as 100 years in a century
+     * @throws IllegalArgumentException if divisor is less than two
+     */
+    DividedDateTimeField(const DateTimeField *field, const DateTimeFieldType *type, int divisor) :
+        DecoratedDateTimeField(getUnderlyingField(field), type), iDivisor(checkDivisor(divisor)) {
+        init(field, field->getRangeDurationField(), type, divisor);
+    }
+    
+    /**
+     * Constructor.
+     *
+     * @param field  the field to wrap, like "year()".
+     * @param rangeField  the range field, NULL to derive
+     * @param type  the field type this field will actually use
+     * @param divisor  divisor, such as 100 years in a century
+     * @throws IllegalArgumentException if divisor is less than two
+     */
+    DividedDateTimeField(const DateTimeField *field, const DurationField *rangeField,
+                         const DateTimeFieldType *type, int divisor) :
+        DecoratedDateTimeField(getUnderlyingField(field), type), iDivisor(checkDivisor(divisor)) {
+        init(field, rangeField, type, divisor);
+    }
+    
+    const DurationField *getRangeDurationField() const {
+        if (iRangeDurationField != NULL) {
+            return iRangeDurationField;
+        }
+        return DecoratedDateTimeField::getRangeDurationField();
+    }
+    
+    /**
+     * Get the amount of scaled units from the specified time instant.
+     *
+     * @param instant  the time instant in millis to query.
+     * @return the amount of scaled units extracted from the input.
+     */
+    int get(int64_t instant) const {
+        return iDivisor.divide(getWrappedField()->get(instant) + iWrappedOffset);
+    }
+    
+    /**
+     * Add the specified amount of scaled units to the specified time
+     * instant. The amount added may be negative.
+     *
+     * @param instant  the time instant in millis to update.
+     * @param amount  the amount of scaled units to add (can be negative).
+     * @return the updated time instant.
+     */
+    int64_t add(int64_t instant, int amount) const {
+        return getWrappedField()->add(instant, amount * iDivisor.getDivisor());
+    }
+    
+    /**
+     * Add the specified amount of scaled units to the specified time
+     * instant. The amount added may be negative.
+     *
+     * @param instant  the time instant in millis to update.
+     * @param amount  the amount of scaled units to add (can be negative).
+     * @return the updated time instant.
+     */
+    int64_t add(int64_t instant, int64_t amount) const {
+        return getWrappedField()->add(instant, amount * iDivisor.getDivisor());
+    }
+    
+    /**
+     * Add to the scaled component of the specified time instant,
+     * wrapping around within that component if necessary.
+     *
+     * @param instant  the time instant in millis to update.
+     * @param amount  the amount of scaled units to add (can be negative).
+     * @return the updated time instant.
+     */
+    int64_t addWrapField(int64_t instant, int amount) const {
+        return set(instant, FieldUtils::getWrappedValue(get(instant), amount, iMin, iMax));
+    }
+    
+    int getDifference(int64_t minuendInstant, int64_t subtrahendInstant) const {
+        return getWrappedField()->getDifference(minuendInstant, subtrahendInstant) / iDivisor.getDivisor();
+    }
+    
+    int64_t getDifferenceAsLong(int64_t minuendInstant, int64_t subtrahendInstant) const {
+        return getWrappedField()->getDifferenceAsLong(minuendInstant, subtrahendInstant) / iDivisor.getDivisor();
+    }
+    
+    /**
+     * Set the specified amount of scaled units to the specified time instant.
+     *
+     * @param instant  the time instant in millis to update.
+     * @param value  value of scaled units to set.
+     * @return the updated time instant.
+     * @throws IllegalArgumentException if value is too large or too small.
+     */
+    int64_t set(int64_t instant, int value) const {
+        FieldUtils::verifyValueBounds(this, value, iMin, iMax);
+        const DateTimeField *field = getWrappedField();
+        int remainder = iDivisor.remainder(field->get(instant) + iWrappedOffset);
+        return field->set(instant, value * iDivisor.getDivisor() + remainder - iWrappedOffset);
+    }
+    
+    /**
+     * Returns a scaled version of the wrapped field's unit duration field.
+     */
+    const DurationField *getDurationField() const {
+        return iDurationField;
+    }
+    
+    /**
+     * Get the minimum value for the field.
+     *
+     * @return the minimum value
+     */
+    int getMinimumValue() const {
+        return iMin;
+    }
+    
+    /**
+     * Get the maximum value for the field.
+     *
+     * @return the maximum value
+     */
+    int getMaximumValue() const {
+        return iMax;
+    }
+    
+    int64_t roundFloor(int64_t instant) const {
+        const DateTimeField *field = getWrappedField();
+        int value = field->get(instant) + iWrappedOffset;
+        int floor = value - iDivisor.remainder(value);
+        return field->roundFloor(field->set(instant, floor - iWrappedOffset));
+    }
+    
+    int64_t remainder(int64_t instant) const {
+        return set(instant, get(getWrappedField()->remainder(instant)));
+    }
+    
+    /**
+     * Returns the divisor applied, in the field's units.
+     *
+     * @return the divisor
+     */
+    int getDivisor() const {
+        return iDivisor.getDivisor();
+    }
+    
+    /**
+     * Returns the offset added to the values of the wrapped field before
+     * they are divided, which is that of an offset field given to the
+     * constructor and otherwise zero.
+     *
+     * @return the offset
+     */
+    int getWrappedOffset() const {
+        return iWrappedOffset;
+    }
+    
+    /**
+     * Returns the divisor in the form used to divide values.
+     *
+     * @return the divisor
+     */
+    const FieldDivisor &getFieldDivisor() const {
+        return iDivisor;
+    }
+    
+};
+
+CODATIME_END
+
+#endif
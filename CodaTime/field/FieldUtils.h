@@ -16,6 +16,7 @@
 #include "Exceptions.h"
 #include "Object.h"
 
+#include <climits>
 #include <string>
 
 using namespace std;
@@ -46,13 +46,21 @@ private:
      * Deserialize to the singleton.
      */
     Object *readResolve() {
-        return INSTANCE;
+        return getInstance();
     }
     
 public:
     
-    /** Singleton instance. */
-    static DurationField *INSTANCE;
+    /**
+     * Gets the singleton instance, which is created on first use and never
+     * destroyed.
+     *
+     * @return the singleton
+     */
+    static DurationField *getInstance() {
+        static MillisDurationField *const cInstance = new MillisDurationField();
+        return cInstance;
+    }
     
     //------------------------------------------------------------------------
     const DurationFieldType *getType() const {
@@ -177,8 +185,6 @@ public:
     
 };
 
-DurationField *MillisDurationField::INSTANCE = new MillisDurationField();
-
 CODATIME_END
 
 #endif
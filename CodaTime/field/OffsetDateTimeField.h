@@ -0,0 +1,239 @@
+//
+//  OffsetDateTimeField.h
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#ifndef CodaTime_OffsetDateTimeField_h
+#define CodaTime_OffsetDateTimeField_h
+
+#include "CodaTimeMacros.h"
+
+#include "DateTimeField.h"
+#include "Exceptions.h"
+#include "field/DecoratedDateTimeField.h"
+#include "field/FieldUtils.h"
+
+#include <climits>
+
+using namespace std;
+
+CODATIME_BEGIN
+
+/**
+ * Generic offset adjusting datetime field.
+ * <p>
+ * OffsetDateTimeField is thread-safe and immutable.
+ *
+ * @author Brian S O'Neill
+ * @since 1.0
+ */
+class OffsetDateTimeField : public DecoratedDateTimeField {
+    
+private:
+    
+    static const long long serialVersionUID = 3145790132623583142L;
+    
+    int iOffset;
+    
+    int iMin;
+    int iMax;
+    
+    void init(const DateTimeField *field, int offset, int minValue, int maxValue) {
+        if (offset == 0) {
+            throw IllegalArgumentException("The offset cannot be zero");
+        }
+        
+        iOffset = offset;
+        
+        int fieldMin = field->getMinimumValue() + offset;
+        int fieldMax = field->getMaximumValue() + offset;
+        iMin = (minValue < fieldMin ? fieldMin : minValue);
+        iMax = (maxValue > fieldMax ? fieldMax : maxValue);
+    }
+    
+public:
+    
+    /**
+     * Constructor.
+     *
+     * @param field  the field to wrap, like "year()".
+     * @param offset  offset to add to field values
+     * @throws IllegalArgumentException if offset is zero
+     */
+    OffsetDateTimeField(const DateTimeField *field, int offset) : DecoratedDateTimeField(field, (field == NULL ? NULL : field->getType())) {
+        init(field, offset, INT_MIN, INT_MAX);
+    }
+    
+    /**
+     * Constructor.
+     *
+     * @param field  the field to wrap, like "year()".
+     * @param type  the field type this field actually uses
+     * @param offset  offset to add to field values
+     * @throws IllegalArgumentException if offset is zero
+     */
+    OffsetDateTimeField(const DateTimeField *field, const DateTimeFieldType *type, int offset) : DecoratedDateTimeField(field, type) {
+        init(field, offset, INT_MIN, INT_MAX);
+    }
+    
+    /**
+     * Constructor.
+     *
+     * @param field  the field to wrap, like "year()".
+     * @param type  the field type this field actually uses
+     * @param offset  offset to add to field values
+     * @param minValue  minimum allowed value
+     * @param maxValue  maximum allowed value
+     * @throws IllegalArgumentException if offset is zero
+     */
+    OffsetDateTimeField(const DateTimeField *field, const DateTimeFieldType *type, int offset,
+                        int minValue, int maxValue) : DecoratedDateTimeField(field, type) {
+        init(field, offset, minValue, maxValue);
+    }
+    
+    /**
+     * Get the amount of offset units from the specified time instant.
+     *
+     * @param instant  the time instant in millis to query.
+     * @return the amount of units extracted from the input.
+     */
+    int get(int64_t instant) const {
+        return getWrappedField()->get(instant) + iOffset;
+    }
+    
+    /**
+     * Add the specified amount of offset units to the specified time
+     * instant. The amount added may be negative.
+     *
+     * @param instant  the time instant in millis to update.
+     * @param amount  the amount of units to add (can be negative).
+     * @return the updated time instant.
+     */
+    int64_t add(int64_t instant, int amount) const {
+        instant = getWrappedField()->add(instant, amount);
+        FieldUtils::verifyValueBounds(this, get(instant), iMin, iMax);
+        return instant;
+    }
+    
+    /**
+     * Add the specified amount of offset units to the specified time
+     * instant. The amount added may be negative.
+     *
+     * @param instant  the time instant in millis to update.
+     * @param amount  the amount of units to add (can be negative).
+     * @return the updated time instant.
+     */
+    int64_t add(int64_t instant, int64_t amount) const {
+        instant = getWrappedField()->add(instant, amount);
+        FieldUtils::verifyValueBounds(this, get(instant), iMin, iMax);
+        return instant;
+    }
+    
+    /**
+     * Add to the offset component of the specified time instant,
+     * wrapping around within that component if necessary.
+     *
+     * @param instant  the time instant in millis to update.
+     * @param amount  the amount of units to add (can be negative).
+     * @return the updated time instant.
+     */
+    int64_t addWrapField(int64_t instant, int amount) const {
+        return set(instant, FieldUtils::getWrappedValue(get(instant), amount, iMin, iMax));
+    }
+    
+    /**
+     * Set the specified amount of offset units to the specified time instant.
+     *
+     * @param instant  the time instant in millis to update.
+     * @param value  value of units to set.
+     * @return the updated time instant.
+     * @throws IllegalArgumentException if value is too large or too small.
+     */
+    int64_t set(int64_t instant, int value) const {
+        FieldUtils::verifyValueBounds(this, value, iMin, iMax);
+        return getWrappedField()->set(instant, value - iOffset);
+    }
+    
+    bool isLeap(int64_t instant) const {
+        return getWrappedField()->isLeap(instant);
+    }
+    
+    int getLeapAmount(int64_t instant) const {
+        return getWrappedField()->getLeapAmount(instant);
+    }
+    
+    const DurationField *getLeapDurationField() const {
+        return getWrappedField()->getLeapDurationField();
+    }
+    
+    /**
+     * Get the minimum value for the field.
+     *
+     * @return the minimum value
+     */
+    int getMinimumValue() const {
+        return iMin;
+    }
+    
+    /**
+     * Get the maximum value for the field.
+     *
+     * @return the maximum value
+     */
+    int getMaximumValue() const {
+        return iMax;
+    }
+    
+    int64_t roundFloor(int64_t instant) const {
+        return getWrappedField()->roundFloor(instant);
+    }
+    
+    int64_t roundCeiling(int64_t instant) const {
+        return getWrappedField()->roundCeiling(instant);
+    }
+    
+    int64_t roundHalfFloor(int64_t instant) const {
+        return getWrappedField()->roundHalfFloor(instant);
+    }
+    
+    int64_t roundHalfCeiling(int64_t instant) const {
+        return getWrappedField()->roundHalfCeiling(instant);
+    }
+    
+    int64_t roundHalfEven(int64_t instant) const {
+        return getWrappedField()->roundHalfEven(instant);
+    }
+    
+    int64_t remainder(int64_t instant) const {
+        return getWrappedField()->remainder(instant);
+    }
+    
+    /**
+     * Returns the offset added to the field values.
+     *
+     * @return the offset
+     */
+    int getOffset() const {
+        return iOffset;
+    }
+    
+    /**
+     * Checks whether the bounds of this field are just those of the wrapped
+     * field moved by the offset, so that a field derived from this one can
+     * apply the offset to the wrapped field itself.
+     *
+     * @return true if no narrower bounds were given
+     */
+    bool hasWrappedBounds() const {
+        return iMin == getWrappedField()->getMinimumValue() + iOffset &&
+            iMax == getWrappedField()->getMaximumValue() + iOffset;
+    }
+    
+};
+
+CODATIME_END
+
+#endif
@@ -0,0 +1,264 @@
+//
+//  RemainderDateTimeField.h
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#ifndef CodaTime_RemainderDateTimeField_h
+#define CodaTime_RemainderDateTimeField_h
+
+#include "CodaTimeMacros.h"
+
+#include "DateTimeField.h"
+#include "DateTimeFieldType.h"
+#include "DurationField.h"
+#include "Exceptions.h"
+#include "field/DecoratedDateTimeField.h"
+#include "field/DividedDateTimeField.h"
+#include "field/FieldUtils.h"
+#include "field/ScaledDurationField.h"
+
+using namespace std;
+
+CODATIME_BEGIN
+
+/**
+ * Counterpart remainder datetime field to {@link DividedDateTimeField}. The
+ * field's unit duration is unchanged, but the range duration is scaled
+ * accordingly.
+ * <p>
+ * A remainder field made from a divided field reads the same underlying
+ * field as the divided field, with the same offset, see
+ * {@link DividedDateTimeField#getWrappedOffset()}.
+ * <p>
+ * RemainderDateTimeField is thread-safe and immutable.
+ *
+ * @see DividedDateTimeField
+ *
+ * @author Brian S O'Neill
+ * @since 1.0
+ */
+class RemainderDateTimeField : public DecoratedDateTimeField {
+    
+private:
+    
+    static const long long serialVersionUID = 5708241235177666790L;
+    
+    FieldDivisor iDivisor;
+    int iWrappedOffset;
+    const DurationField *iDurationField;
+    const DurationField *iRangeField;
+    
+    static int checkDivisor(int divisor) {
+        if (divisor < 2) {
+            throw IllegalArgumentException("The divisor must be at least 2");
+        }
+        return divisor;
+    }
+    
+    static const DividedDateTimeField *checkDividedField(const DividedDateTimeField *dividedField) {
+        if (dividedField == NULL) {
+            throw IllegalArgumentException("The divided field must not be NULL");
+        }
+        return dividedField;
+    }
+    
+public:
+    
+    /**
+     * Constructor.
+     *
+     * @param field  the field to wrap, like "year()".
+     * @param type  the field type this field actually uses
+     * @param divisor  divisor, such as 100 years in a century
+     * @throws IllegalArgumentException if divisor is less than two
+     */
+    RemainderDateTimeField(const DateTimeField *field, const DateTimeFieldType *type, int divisor) :
+        DecoratedDateTimeField(field, type), iDivisor(checkDivisor(divisor)) {
+        const DurationField *rangeField = field->getDurationField();
+        if (rangeField == NULL) {
+            iRangeField = NULL;
+        } else {
+            iRangeField = new ScaledDurationField(rangeField, type->getRangeDurationType(), divisor);
+        }
+        iDurationField = field->getDurationField();
+        iWrappedOffset = 0;
+    }
+    
+    /**
+     * Constructor.
+     *
+     * @param field  the field to wrap, like "year()".
+     * @param rangeField  the range field
+     * @param type  the field type this field actually uses
+     * @param divisor  divisor, such as 100 years in a century
+     * @throws IllegalArgumentException if divisor is less than two
+     */
+    RemainderDateTimeField(const DateTimeField *field, const DurationField *rangeField,
+                           const DateTimeFieldType *type, int divisor) :
+        DecoratedDateTimeField(field, type), iDivisor(checkDivisor(divisor)) {
+        iRangeField = rangeField;
+        iDurationField = field->getDurationField();
+        iWrappedOffset = 0;
+    }
+    
+    /**
+     * Construct a RemainderDateTimeField that compliments the given
+     * DividedDateTimeField.
+     *
+     * @param dividedField  complimentary divided field, like "century()".
+     */
+    RemainderDateTimeField(const DividedDateTimeField *dividedField) :
+        DecoratedDateTimeField(checkDividedField(dividedField)->getWrappedField(), dividedField->getType()),
+        iDivisor(dividedField->getFieldDivisor()) {
+        iDurationField = dividedField->getWrappedField()->getDurationField();
+        iRangeField = dividedField->getDurationField();
+        iWrappedOffset = dividedField->getWrappedOffset();
+    }
+    
+    /**
+     * Construct a RemainderDateTimeField that compliments the given
+     * DividedDateTimeField.
+     *
+     * @param dividedField  complimentary divided field, like "century()".
+     * @param type  the field type this field actually uses
+     */
+    RemainderDateTimeField(const DividedDateTimeField *dividedField, const DateTimeFieldType *type) :
+        DecoratedDateTimeField(checkDividedField(dividedField)->getWrappedField(), type),
+        iDivisor(dividedField->getFieldDivisor()) {
+        iDurationField = dividedField->getWrappedField()->getDurationField();
+        iRangeField = dividedField->getDurationField();
+        iWrappedOffset = dividedField->getWrappedOffset();
+    }
+    
+    /**
+     * Construct a RemainderDateTimeField that compliments the given
+     * DividedDateTimeField.
+     * This constructor allows the duration field to be set.
+     *
+     * @param dividedField  complimentary divided field, like "century()".
+     * @param durationField  the duration field
+     * @param type  the field type this field actually uses
+     */
+    RemainderDateTimeField(const DividedDateTimeField *dividedField, const DurationField *durationField,
+                           const DateTimeFieldType *type) :
+        DecoratedDateTimeField(checkDividedField(dividedField)->getWrappedField(), type),
+        iDivisor(dividedField->getFieldDivisor()) {
+        iDurationField = durationField;
+        iRangeField = dividedField->getDurationField();
+        iWrappedOffset = dividedField->getWrappedOffset();
+    }
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Get the remainder from the specified time instant.
+     *
+     * @param instant  the time instant in millis to query.
+     * @return the remainder extracted from the input.
+     */
+    int get(int64_t instant) const {
+        return iDivisor.remainder(getWrappedField()->get(instant) + iWrappedOffset);
+    }
+    
+    /**
+     * Add the specified amount to the specified time instant, wrapping around
+     * within the remainder range if necessary. The amount added may be
+     * negative.
+     *
+     * @param instant  the time instant in millis to update.
+     * @param amount  the amount to add (can be negative).
+     * @return the updated time instant.
+     */
+    int64_t addWrapField(int64_t instant, int amount) const {
+        return set(instant, FieldUtils::getWrappedValue(get(instant), amount, 0, iDivisor.getDivisor() - 1));
+    }
+    
+    /**
+     * Set the specified amount of remainder units to the specified time instant.
+     *
+     * @param instant  the time instant in millis to update.
+     * @param value  value of remainder units to set.
+     * @return the updated time instant.
+     * @throws IllegalArgumentException if value is too large or too small.
+     */
+    int64_t set(int64_t instant, int value) const {
+        FieldUtils::verifyValueBounds(this, value, 0, iDivisor.getDivisor() - 1);
+        const DateTimeField *field = getWrappedField();
+        int wrapped = field->get(instant) + iWrappedOffset;
+        int floor = wrapped - iDivisor.remainder(wrapped);
+        return field->set(instant, floor + value - iWrappedOffset);
+    }
+    
+    /**
+     * Returns the wrapped field's unit duration field.
+     */
+    const DurationField *getDurationField() const {
+        return iDurationField;
+    }
+    
+    /**
+     * Returns a scaled version of the wrapped field's unit duration field.
+     */
+    const DurationField *getRangeDurationField() const {
+        return iRangeField;
+    }
+    
+    /**
+     * Get the minimum value for the field, which is always zero.
+     *
+     * @return the minimum value of zero.
+     */
+    int getMinimumValue() const {
+        return 0;
+    }
+    
+    /**
+     * Get the maximum value for the field, which is always one less than the
+     * divisor.
+     *
+     * @return the maximum value
+     */
+    int getMaximumValue() const {
+        return iDivisor.getDivisor() - 1;
+    }
+    
+    int64_t roundFloor(int64_t instant) const {
+        return getWrappedField()->roundFloor(instant);
+    }
+    
+    int64_t roundCeiling(int64_t instant) const {
+        return getWrappedField()->roundCeiling(instant);
+    }
+    
+    int64_t roundHalfFloor(int64_t instant) const {
+        return getWrappedField()->roundHalfFloor(instant);
+    }
+    
+    int64_t roundHalfCeiling(int64_t instant) const {
+        return getWrappedField()->roundHalfCeiling(instant);
+    }
+    
+    int64_t roundHalfEven(int64_t instant) const {
+        return getWrappedField()->roundHalfEven(instant);
+    }
+    
+    int64_t remainder(int64_t instant) const {
+        return getWrappedField()->remainder(instant);
+    }
+    
+    /**
+     * Returns the divisor applied, in the field's units.
+     *
+     * @return the divisor
+     */
+    int getDivisor() const {
+        return iDivisor.getDivisor();
+    }
+    
+};
+
+CODATIME_END
+
+#endif
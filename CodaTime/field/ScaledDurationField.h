@@ -0,0 +1,189 @@
+//
+//  ScaledDurationField.h
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#ifndef CodaTime_ScaledDurationField_h
+#define CodaTime_ScaledDurationField_h
+
+#include "CodaTimeMacros.h"
+
+#include "DurationField.h"
+#include "Exceptions.h"
+#include "field/BaseDurationField.h"
+#include "field/FieldUtils.h"
+
+CODATIME_BEGIN
+
+/**
+ * Scales a DurationField such that it's unit millis becomes larger in
+ * magnitude.
+ * <p>
+ * ScaledDurationField is thread-safe and immutable.
+ *
+ * @see PreciseDurationField
+ *
+ * @author Brian S O'Neill
+ * @since 1.0
+ */
+class ScaledDurationField : public BaseDurationField {
+    
+private:
+    
+    static const long long serialVersionUID = -3205227092378684157L;
+    
+    /** The DurationField being wrapped */
+    DurationField *iField;
+    /** The scalar */
+    int iScalar;
+    
+public:
+    
+    /**
+     * Constructor
+     *
+     * @param field  the field to wrap, like "year()".
+     * @param type  the type this field will actually use
+     * @param scalar  scalar, such as 100 years in a century
+     * @throws IllegalArgumentException if scalar is zero or one.
+     */
+    ScaledDurationField(const DurationField *field, const DurationFieldType *type, int scalar) : BaseDurationField(type) {
+        if (field == NULL) {
+            throw IllegalArgumentException("The field must not be NULL");
+        }
+        if (!field->isSupported()) {
+            throw IllegalArgumentException("The field must be supported");
+        }
+        if (scalar == 0 || scalar == 1) {
+            throw IllegalArgumentException("The scalar must not be 0 or 1");
+        }
+        // the wrapped field is immutable, the non-const methods only query it
+        iField = const_cast<DurationField*>(field);
+        iScalar = scalar;
+    }
+    
+    /**
+     * Gets the wrapped duration field.
+     *
+     * @return the wrapped DurationField
+     */
+    const DurationField *getWrappedField() const {
+        return iField;
+    }
+    
+    const bool isPrecise() const {
+        return iField->isPrecise();
+    }
+    
+    int getValue(int64_t duration) {
+        return iField->getValue(duration) / iScalar;
+    }
+    
+    int64_t getValueAsLong(int64_t duration) {
+        return iField->getValueAsLong(duration) / iScalar;
+    }
+    
+    int getValue(int64_t duration, int64_t instant) {
+        return iField->getValue(duration, instant) / iScalar;
+    }
+    
+    int64_t getValueAsLong(int64_t duration, int64_t instant) {
+        return iField->getValueAsLong(duration, instant) / iScalar;
+    }
+    
+    int64_t getMillis(int value) {
+        int64_t scaled = ((int64_t) value) * ((int64_t) iScalar);
+        return iField->getMillis(scaled);
+    }
+    
+    int64_t getMillis(int64_t value) {
+        int64_t scaled = FieldUtils::safeMultiply(value, iScalar);
+        return iField->getMillis(scaled);
+    }
+    
+    int64_t getMillis(int value, int64_t instant) {
+        int64_t scaled = ((int64_t) value) * ((int64_t) iScalar);
+        return iField->getMillis(scaled, instant);
+    }
+    
+    int64_t getMillis(int64_t value, int64_t instant) {
+        int64_t scaled = FieldUtils::safeMultiply(value, iScalar);
+        return iField->getMillis(scaled, instant);
+    }
+    
+    int64_t add(int64_t instant, int value) const {
+        int64_t scaled = ((int64_t) value) * ((int64_t) iScalar);
+        return iField->add(instant, scaled);
+    }
+    
+    int64_t add(int64_t instant, int64_t value) const {
+        int64_t scaled = FieldUtils::safeMultiply(value, iScalar);
+        return iField->add(instant, scaled);
+    }
+    
+    int getDifference(int64_t minuendInstant, int64_t subtrahendInstant) const {
+        return iField->getDifference(minuendInstant, subtrahendInstant) / iScalar;
+    }
+    
+    int64_t getDifferenceAsLong(int64_t minuendInstant, int64_t subtrahendInstant) const {
+        return iField->getDifferenceAsLong(minuendInstant, subtrahendInstant) / iScalar;
+    }
+    
+    int64_t getUnitMillis() const {
+        return iField->getUnitMillis() * iScalar;
+    }
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Returns the scalar applied, in the field's units, to the milliseconds.
+     *
+     * @return the scalar
+     */
+    int getScalar() const {
+        return iScalar;
+    }
+    
+    /**
+     * Compares this duration field to another.
+     * Two fields are equal if of the same type and duration.
+     *
+     * @param obj  the object to compare to
+     * @return if equal
+     */
+    bool equals(const Object *obj) const {
+        
+        if (this == obj) {
+            return true;
+        }
+        
+        const ScaledDurationField *other = dynamic_cast<const ScaledDurationField*>(obj);
+        
+        if (other != 0) {
+            return (iField->equals(other->iField)) &&
+                (getType() == other->getType()) &&
+                (iScalar == other->iScalar);
+        }
+        return false;
+    }
+    
+    /**
+     * Gets a hash code for this instance.
+     *
+     * @return a suitable hashcode
+     */
+    int hashCode() const {
+        int64_t scalar = iScalar;
+        int hash = (int) (scalar ^ (scalar >> 32));
+        hash += getType()->hashCode();
+        hash += iField->hashCode();
+        return hash;
+    }
+    
+};
+
+CODATIME_END
+
+#endif
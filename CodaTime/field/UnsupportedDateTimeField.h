@@ -18,6 +18,7 @@
 #include "Locale.h"
 
 #include <map>
+#include <mutex>
 #include <vector>
 
 using namespace std;
@@ -31,9 +32,6 @@ private:
     /** Serialilzation version */
     static const long long serialVersionUID = -1934618396111902255L;
     
-    /** The cache of unsupported datetime field instances */
-    static map<const DateTimeFieldType*, UnsupportedDateTimeField*> cCache;
-    
     /** The field type */
     const DateTimeFieldType *iType;
     /** The duration of the datetime field */
@@ -77,16 +75,19 @@ public:
      * @return the instance
      * @throws IllegalArgumentException if durationField is NULL
      */
-    // TODO: implement synchronized
     static UnsupportedDateTimeField *getInstance(const DateTimeFieldType *type, const DurationField *durationField) {
-        
-        UnsupportedDateTimeField *field = cCache[type];
+        // the cache is built on first use, as the header has no source file to
+        // define it in, and never destroyed, so exiting runs no destructor
+        static map<const DateTimeFieldType*, UnsupportedDateTimeField*> *const cCache = new map<const DateTimeFieldType*, UnsupportedDateTimeField*>();
+        static mutex *const cCacheLock = new mutex();
+        lock_guard<mutex> lock(*cCacheLock);
+        UnsupportedDateTimeField *field = (*cCache)[type];
         if (field != NULL && field->getDurationField() != durationField) {
             field = NULL;
         }
         if (field == NULL) {
             field = new UnsupportedDateTimeField(type, durationField);
-            cCache[type] = field;
+            (*cCache)[type] = field;
         }
         return field;
     }
@@ -16,6 +16,7 @@
 #include "Exceptions.h"
 
 #include <map>
+#include <mutex>
 
 using namespace std;
 
@@ -28,9 +29,6 @@ private:
     /** Serialization lock. */
     static const long long serialVersionUID = -6390301302770925357L;
     
-    /** The cache of unsupported duration field instances */
-    static map<const DurationFieldType*, UnsupportedDurationfield*> cCache;
-    
     /**
      * Ensure proper singleton serialization
      */
@@ -65,12 +63,16 @@ public:
      * @param type  the type to obtain
      * @return the instance
      */
-    // TODO: synchronized
     static UnsupportedDurationfield *getInstance(const DurationFieldType *type) {
-        UnsupportedDurationfield *field = cCache[type];
+        // the cache is built on first use, as the header has no source file to
+        // define it in, and never destroyed, so exiting runs no destructor
+        static map<const DurationFieldType*, UnsupportedDurationfield*> *const cCache = new map<const DurationFieldType*, UnsupportedDurationfield*>();
+        static mutex *const cCacheLock = new mutex();
+        lock_guard<mutex> lock(*cCacheLock);
+        UnsupportedDurationfield *field = (*cCache)[type];
         if (field == NULL) {
             field = new UnsupportedDurationfield(type);
-            cCache[type] = field;
+            (*cCache)[type] = field;
         }
         return field;
     }
@@ -8,6 +8,8 @@
 
 #include "DateTimeFormat.h"
 
+#include "CodaTimeStats.h"
+#include "CodaTimeTrace.h"
 #include "DateTime.h"
 #include "format/DateTimeFormatter.h"
 //#include "format/DateTimeFormatterBuilder.h"
@@ -15,7 +17,34 @@
 
 CODATIME_BEGIN
 
-const vector<DateTimeFormatter*> DateTimeFormat::STYLE_CACHE = vector<DateTimeFormatter*>(25);
+DateTimeFormatter *DateTimeFormat::STYLE_CACHE[DateTimeFormat::STYLE_CACHE_SIZE];
+
+// the caches and their locks are built on first use, and never destroyed, so
+// that loading the library runs no initializer and exiting runs no destructor
+map<string, DateTimeFormatter*> &DateTimeFormat::getPatternCache() {
+    static map<string, DateTimeFormatter*> *const cCache = new map<string, DateTimeFormatter*>();
+    return *cCache;
+}
+
+mutex &DateTimeFormat::getPatternCacheLock() {
+    static mutex *const cLock = new mutex();
+    return *cLock;
+}
+
+mutex &DateTimeFormat::getStyleCacheLock() {
+    static mutex *const cLock = new mutex();
+    return *cLock;
+}
+
+map<string, DateTimeFormatter*> &DateTimeFormat::StyleFormatter::getCache() {
+    static map<string, DateTimeFormatter*> *const cCache = new map<string, DateTimeFormatter*>();
+    return *cCache;
+}
+
+mutex &DateTimeFormat::StyleFormatter::getCacheLock() {
+    static mutex *const cLock = new mutex();
+    return *cLock;
+}
 
 void DateTimeFormat::appendPatternTo(DateTimeFormatterBuilder *builder, string pattern) {
     parsePatternTo(builder, pattern);
@@ -279,18 +308,20 @@ DateTimeFormatter *DateTimeFormat::createFormatterForPattern(string pattern) {
     if (pattern == NULL || pattern.size() == 0) {
         throw IllegalArgumentException("Invalid pattern specification");
     }
-    DateTimeFormatter *formatter = NULL;
-    // TODO: synchronized
-//    synchronized (PATTERN_CACHE) {
-        formatter = PATTERN_CACHE[pattern];
-        if (formatter == NULL) {
-            DateTimeFormatterBuilder *builder = new DateTimeFormatterBuilder();
-            parsePatternTo(builder, pattern);
-            formatter = builder->toFormatter();
-            
-            PATTERN_CACHE.insert(pair<string, DateTimeFormatter*>(pattern, formatter));
-        }
-//    }
+    lock_guard<mutex> lock(getPatternCacheLock());
+    DateTimeFormatter *formatter = getPatternCache()[pattern];
+    if (formatter == NULL) {
+        CODATIME_TRACE_SPAN(span, PATTERN_COMPILE, 0, pattern);
+        DateTimeFormatterBuilder *builder = new DateTimeFormatterBuilder();
+        parsePatternTo(builder, pattern);
+        formatter = builder->toFormatter();
+        CODATIME_STATS_FORMATTER_COMPILATION();
+        
+        getPatternCache()[pattern] = formatter;
+        CODATIME_STATS_MISS(PATTERN_FORMATTER, sizeof(DateTimeFormatter) + pattern.size());
+    } else {
+        CODATIME_STATS_HIT(PATTERN_FORMATTER);
+    }
     return formatter;
 }
 
@@ -309,18 +340,18 @@ DateTimeFormatter *DateTimeFormat::createFormatterForStyle(string style) {
 DateTimeFormatter *DateTimeFormat::createFormatterForStyleIndex(int dateStyle, int timeStyle) {
     int index = ((dateStyle << 2) + dateStyle) + timeStyle;
     // Should never happen but do a double check...
-    if (index >= STYLE_CACHE.size()) {
+    if (index >= STYLE_CACHE_SIZE) {
         return createDateTimeFormatter(dateStyle, timeStyle);
     }
-    DateTimeFormatter *f = NULL;
-    // TODO synchronized
-//    synchronized (STYLE_CACHE) {
-        f = STYLE_CACHE[index];
-        if (f == NULL) {
-            f = createDateTimeFormatter(dateStyle, timeStyle);
-            STYLE_CACHE[index] = f;
-        }
-//    }
+    lock_guard<mutex> lock(getStyleCacheLock());
+    DateTimeFormatter *f = STYLE_CACHE[index];
+    if (f == NULL) {
+        f = createDateTimeFormatter(dateStyle, timeStyle);
+        STYLE_CACHE[index] = f;
+        CODATIME_STATS_MISS(STYLE_FORMATTER, sizeof(DateTimeFormatter) + sizeof(StyleFormatter));
+    } else {
+        CODATIME_STATS_HIT(STYLE_FORMATTER);
+    }
     return f;
 }
 
@@ -459,15 +490,17 @@ int DateTimeFormat::StyleFormatter::parseInto(DateTimeParserBucket *bucket, stri
 DateTimeFormatter *DateTimeFormat::StyleFormatter::getFormatter(Locale *locale) {
     locale = (locale == NULL ? Locale::getDefault() : locale);
     string key = to_string(iType + (iDateStyle << 4) + (iTimeStyle << 8)) + locale->tostring();
-    DateTimeFormatter *f = NULL;
-//    synchronized (cCache) {
-        f = cCache[key];
-        if (f == NULL) {
-            string pattern = getPattern(locale);
-            f = DateTimeFormat::forPattern(pattern);
-            cCache.insert(pair<string, DateTimeFormatter*>(key, f));
-        }
-//    }
+    lock_guard<mutex> lock(getCacheLock());
+    map<string, DateTimeFormatter*> &cache = getCache();
+    DateTimeFormatter *f = cache[key];
+    if (f == NULL) {
+        string pattern = getPattern(locale);
+        f = DateTimeFormat::forPattern(pattern);
+        cache[key] = f;
+        CODATIME_STATS_MISS(LOCALE_STYLE_FORMATTER, key.size());
+    } else {
+        CODATIME_STATS_HIT(LOCALE_STYLE_FORMATTER);
+    }
     return f;
 }
 
@@ -15,6 +15,7 @@
 #include "format/DateTimeParser.h"
 
 #include <map>
+#include <mutex>
 #include <vector>
 #include <sstream>
 
@@ -151,8 +152,12 @@ private:
     /** Maximum size of the pattern cache. */
     static const int PATTERN_CACHE_SIZE = 500;
     
-    /** maps patterns to formatters via LRU, patterns don't vary by locale. */
-    static const map<string, DateTimeFormatter*> PATTERN_CACHE;// = new LinkedHashmap<string, DateTimeFormatter*>(7) {
+    /**
+     * Gets the map of patterns to formatters, patterns don't vary by locale.
+     *
+     * @return the cache, built on first use
+     */
+    static map<string, DateTimeFormatter*> &getPatternCache();// = new LinkedHashmap<string, DateTimeFormatter*>(7) {
 //        static const int64_t serialVersionUID = 23L;
 //        @Override
 //        protected bool removeEldestEntry(const map.Entry<string, DateTimeFormatter*> eldest) {
@@ -160,8 +165,25 @@ private:
 //        };
 //    };
     
+    /** The number of style pairs, the size of the style cache. */
+    static const int STYLE_CACHE_SIZE = 25;
+    
     /** maps patterns to formatters, patterns don't vary by locale. */
-    static const vector<DateTimeFormatter*> STYLE_CACHE;
+    static DateTimeFormatter *STYLE_CACHE[STYLE_CACHE_SIZE];
+    
+    /**
+     * Gets the lock for the pattern cache.
+     *
+     * @return the lock, built on first use
+     */
+    static mutex &getPatternCacheLock();
+    
+    /**
+     * Gets the lock for the style cache.
+     *
+     * @return the lock, built on first use
+     */
+    static mutex &getStyleCacheLock();
     
     //-----------------------------------------------------------------------
     /**
@@ -253,7 +275,19 @@ private:
         
     public:
         
-        static const map<string, DateTimeFormatter*> cCache;// = new Hashmap<string, DateTimeFormatter*>();  // manual sync
+        /**
+         * Gets the cache of formatters by style, type and locale.
+         *
+         * @return the cache, built on first use
+         */
+        static map<string, DateTimeFormatter*> &getCache();// = new Hashmap<string, DateTimeFormatter*>();  // manual sync
+        
+        /**
+         * Gets the lock for the cache.
+         *
+         * @return the lock, built on first use
+         */
+        static mutex &getCacheLock();
         
         const int iDateStyle;
         const int iTimeStyle;
@@ -209,7 +209,7 @@ Chronology *DateTimeFormatter::getChronology() const {
  * @since 2.0
  */
 DateTimeFormatter *DateTimeFormatter::withZoneUTC() {
-    return withZone(DateTimeZone::UTC);
+    return withZone(DateTimeZone::UTC());
 }
 
 /**
@@ -503,7 +503,7 @@ void DateTimeFormatter::printTo(string &buf, int64_t instant, Chronology *chrono
     int64_t adjustedInstant = instant + offset;
     if ((instant ^ adjustedInstant) < 0 && (instant ^ offset) >= 0) {
         // Time zone offset overflow, so revert to UTC.
-        zone = DateTimeZone::UTC;
+        zone = DateTimeZone::UTC();
         offset = 0;
         adjustedInstant = instant;
     }
@@ -520,7 +520,7 @@ void DateTimeFormatter::printTo(stringstream &buf, int64_t instant, Chronology *
     int64_t adjustedInstant = instant + offset;
     if ((instant ^ adjustedInstant) < 0 && (instant ^ offset) >= 0) {
         // Time zone offset overflow, so revert to UTC.
-        zone = DateTimeZone::UTC;
+        zone = DateTimeZone::UTC();
         offset = 0;
         adjustedInstant = instant;
     }
@@ -9,6 +9,7 @@
 #include "DateTimeParserBucket.h"
 
 #include "Chronology.h"
+#include "CodaTimeTrace.h"
 #include "DateTimeField.h"
 #include "DateTimeFieldType.h"
 #include "DateTimeUtils.h"
@@ -253,6 +254,7 @@ int64_t DateTimeParserBucket::computeMillis(bool resetFields, string text) {
             }
         }
     } catch (IllegalFieldValueException e) {
+        CODATIME_TRACE_EVENT(PARSE_FAILURE, 0, text);
         if (!text.empty()) {
 //            e.prependMessage("Cannot parse \"" + text + '"');
         }
@@ -264,6 +266,7 @@ int64_t DateTimeParserBucket::computeMillis(bool resetFields, string text) {
         int offset = iZone->getOffsetFromLocal(millis);
         millis -= offset;
         if (offset != iZone->getOffset(millis)) {
+            CODATIME_TRACE_EVENT(PARSE_FAILURE, offset, text);
             string message = "Illegal instant due to time zone offset transition (" + iZone->toString() + ")";
             if (!text.empty()) {
                 message = "Cannot parse \"" + text + "\": " + message;
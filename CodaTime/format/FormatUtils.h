@@ -11,6 +11,7 @@
 
 #include "CodaTimeMacros.h"
 
+#include <climits>
 #include <string>
 #include <math.h>
 #include <sstream>
@@ -34,7 +35,8 @@ class FormatUtils {
     
 private:
     
-    static const double LOG_10;
+    /** The natural log of ten, initialized in the class as the header has no source file */
+    static constexpr double LOG_10 = 2.302585092994045684;
     
     /**
      * Restricted constructor.
@@ -269,7 +271,7 @@ public:
             if (value != INT_MIN) {
                 value = -value;
             } else {
-                buf.append(to_string(-(int64_t)LONG_MIN));
+                buf.append(to_string(-(int64_t) INT_MIN));
                 return;
             }
         }
@@ -305,6 +307,28 @@ public:
         }
     }
     
+    /**
+     * Appends a fraction of a second to the given buffer, as a point followed
+     * by three, six or nine digits, whichever is the fewest that is exact.
+     * Nothing is appended for a zero fraction.
+     *
+     * @param buf receives the fraction converted to a string
+     * @param nanos the fraction in nanoseconds, from 0 to 999,999,999
+     */
+    static void appendFractionOfSecond(string &buf, int nanos) {
+        if (nanos == 0) {
+            return;
+        }
+        buf.append(1, '.');
+        if (nanos % 1000000 == 0) {
+            appendPaddedInteger(buf, nanos / 1000000, 3);
+        } else if (nanos % 1000 == 0) {
+            appendPaddedInteger(buf, nanos / 1000, 6);
+        } else {
+            appendPaddedInteger(buf, nanos, 9);
+        }
+    }
+    
     /**
      * Converts an integer to a string, and writes it to the given writer.
      *
@@ -377,8 +401,6 @@ public:
     
 };
 
-const double FormatUtils::LOG_10 = log(10);
-
 CODATIME_END
 
 #endif
@@ -0,0 +1,383 @@
+//
+//  ISOPeriodFormat.cpp
+//  CodaTime
+//
+//  Created by Saul Howard on 12/18/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#include "ISOPeriodFormat.h"
+
+#include "DateTimeConstants.h"
+#include "format/PeriodFormatterBuilder.h"
+#include "MutablePeriod.h"
+#include "PeriodType.h"
+#include "ReadWritablePeriod.h"
+
+#include <climits>
+
+CODATIME_BEGIN
+
+/** Standard field indices, as used by PeriodType::Values */
+static const int YEARS = 0;
+static const int MONTHS = 1;
+static const int WEEKS = 2;
+static const int DAYS = 3;
+static const int HOURS = 4;
+static const int MINUTES = 5;
+static const int SECONDS = 6;
+static const int MILLIS = 7;
+
+/** The mask of the fields printed as the seconds field, S */
+static const int SECONDS_MILLIS_MASK = (1 << SECONDS) | (1 << MILLIS);
+
+/** The designator following each standard field */
+static const char DESIGNATORS[] = { 'Y', 'M', 'W', 'D', 'H', 'M', 'S' };
+
+/**
+ * Reads the period into standard order.
+ *
+ * @return the field mask of the period type
+ */
+static int expand(ReadablePeriod *period, PeriodType::Values &values) {
+    int mask = period->getPeriodType()->getFieldMask();
+    values = PeriodType::Values();
+    for (int i = 0, index = 0, isize = (int) values.size(); i < isize; i++) {
+        if ((mask >> i) & 1) {
+            values[i] = period->getValue(index++);
+        }
+    }
+    return mask;
+}
+
+/**
+ * Writes the decimal digits of a value, with a leading minus if negative.
+ *
+ * @return the position after the last digit
+ */
+static char *appendInteger(char *out, int64_t value) {
+    uint64_t magnitude;
+    if (value < 0) {
+        *out++ = '-';
+        magnitude = 0 - (uint64_t) value;
+    } else {
+        magnitude = (uint64_t) value;
+    }
+    char digits[20];
+    int count = 0;
+    do {
+        digits[count++] = (char) ('0' + (magnitude % 10));
+        magnitude /= 10;
+    } while (magnitude != 0);
+    while (count > 0) {
+        *out++ = digits[--count];
+    }
+    return out;
+}
+
+//-----------------------------------------------------------------------
+int ISOPeriodFormat::StandardPrinterParser::print(ReadablePeriod *period, char *out, int &fieldCount) {
+    PeriodType::Values values;
+    int mask = expand(period, values);
+    
+    // a zero period prints its last field, so that there is always something after the P
+    int zeroField = -1;
+    bool zero = true;
+    for (int i = 0, isize = (int) values.size(); i < isize; i++) {
+        zero = zero && values[i] == 0;
+    }
+    if (zero) {
+        if (mask & SECONDS_MILLIS_MASK) {
+            zeroField = SECONDS;
+        } else {
+            for (int i = MINUTES; i >= YEARS && zeroField == -1; i--) {
+                if ((mask >> i) & 1) {
+                    zeroField = i;
+                }
+            }
+        }
+    }
+    
+    char *pos = out;
+    *pos++ = 'P';
+    fieldCount = 0;
+    for (int i = YEARS; i <= DAYS; i++) {
+        if (((mask >> i) & 1) && (values[i] != 0 || i == zeroField)) {
+            pos = appendInteger(pos, values[i]);
+            *pos++ = DESIGNATORS[i];
+            fieldCount++;
+        }
+    }
+    
+    bool printHours = ((mask >> HOURS) & 1) && (values[HOURS] != 0 || zeroField == HOURS);
+    bool printMinutes = ((mask >> MINUTES) & 1) && (values[MINUTES] != 0 || zeroField == MINUTES);
+    int64_t secondsMillis = values[SECONDS] * (int64_t) DateTimeConstants::MILLIS_PER_SECOND + values[MILLIS];
+    bool printSeconds = (mask & SECONDS_MILLIS_MASK) && (secondsMillis != 0 || zeroField == SECONDS);
+    if (printHours || printMinutes || printSeconds) {
+        *pos++ = 'T';
+    }
+    if (printHours) {
+        pos = appendInteger(pos, values[HOURS]);
+        *pos++ = 'H';
+        fieldCount++;
+    }
+    if (printMinutes) {
+        pos = appendInteger(pos, values[MINUTES]);
+        *pos++ = 'M';
+        fieldCount++;
+    }
+    if (printSeconds) {
+        int64_t seconds = secondsMillis / DateTimeConstants::MILLIS_PER_SECOND;
+        int dp = (int) ((secondsMillis < 0 ? -secondsMillis : secondsMillis) % DateTimeConstants::MILLIS_PER_SECOND);
+        if (secondsMillis < 0 && seconds == 0) {
+            *pos++ = '-';
+        }
+        pos = appendInteger(pos, seconds);
+        if (dp > 0) {
+            *pos++ = '.';
+            *pos++ = (char) ('0' + dp / 100);
+            *pos++ = (char) ('0' + (dp / 10) % 10);
+            *pos++ = (char) ('0' + dp % 10);
+        }
+        *pos++ = 'S';
+        fieldCount++;
+    }
+    return (int) (pos - out);
+}
+
+size_t ISOPeriodFormat::StandardPrinterParser::calculatePrintedLength(ReadablePeriod *period, const Locale *locale) const {
+    char out[MAX_PRINTED_LENGTH];
+    int fieldCount;
+    return print(period, out, fieldCount);
+}
+
+int ISOPeriodFormat::StandardPrinterParser::countFieldsToPrint(ReadablePeriod *period, int stopAt, const Locale *locale) const {
+    if (stopAt <= 0) {
+        return 0;
+    }
+    char out[MAX_PRINTED_LENGTH];
+    int fieldCount;
+    print(period, out, fieldCount);
+    return fieldCount;
+}
+
+void ISOPeriodFormat::StandardPrinterParser::printTo(string &buf, ReadablePeriod *period, const Locale *locale) const {
+    char out[MAX_PRINTED_LENGTH];
+    int fieldCount;
+    int length = print(period, out, fieldCount);
+    buf.append(out, length);
+}
+
+void ISOPeriodFormat::StandardPrinterParser::printTo(stringstream &out, ReadablePeriod *period, const Locale *locale) const {
+    char chars[MAX_PRINTED_LENGTH];
+    int fieldCount;
+    int length = print(period, chars, fieldCount);
+    out.write(chars, length);
+}
+
+//-----------------------------------------------------------------------
+int ISOPeriodFormat::StandardPrinterParser::parseInto(ReadWritablePeriod *period, string periodStr,
+                                                      int position, const Locale *locale) const {
+    const char *text = periodStr.c_str();
+    int length = (int) periodStr.size();
+    if (position >= length || (text[position] != 'P' && text[position] != 'p')) {
+        return ~position;
+    }
+    
+    PeriodType::Values values = PeriodType::Values();
+    int parsed = 0;
+    int next = YEARS;  // fields must appear in order
+    int separator = -1;
+    int pos = position + 1;
+    while (pos < length) {
+        char c = text[pos];
+        if ((c == 'T' || c == 't') && separator < 0) {
+            separator = ++pos;
+            next = HOURS;
+            continue;
+        }
+        
+        // signed whole number, at most ten digits as for the builder
+        int start = pos;
+        bool negative = false;
+        if (c == '-' || c == '+') {
+            negative = (c == '-');
+            pos++;
+        }
+        int64_t value = 0;
+        int digits = 0;
+        while (pos < length && text[pos] >= '0' && text[pos] <= '9' && digits < 10) {
+            value = value * 10 + (text[pos++] - '0');
+            digits++;
+        }
+        if (digits == 0) {
+            if (start == pos) {
+                break;  // not a field, leave the rest to the caller
+            }
+            return ~start;
+        }
+        value = (negative ? -value : value);
+        if (value > INT_MAX || value < INT_MIN) {
+            return ~start;
+        }
+        
+        // fraction, only valid for seconds
+        int fraction = 0;
+        int fractionEnd = pos;
+        if (pos < length && (text[pos] == '.' || text[pos] == ',')) {
+            int scale = 100;
+            fractionEnd++;
+            while (fractionEnd < length && text[fractionEnd] >= '0' && text[fractionEnd] <= '9') {
+                fraction += (text[fractionEnd++] - '0') * scale;
+                scale /= 10;
+            }
+        }
+        
+        int field;
+        switch (fractionEnd < length ? text[fractionEnd] : '\0') {
+            case 'Y': case 'y':
+                field = YEARS;
+                break;
+            case 'M': case 'm':
+                field = (separator < 0 ? MONTHS : MINUTES);
+                break;
+            case 'W': case 'w':
+                field = WEEKS;
+                break;
+            case 'D': case 'd':
+                field = DAYS;
+                break;
+            case 'H': case 'h':
+                field = HOURS;
+                break;
+            case 'S': case 's':
+                field = SECONDS;
+                break;
+            default:
+                return ~fractionEnd;
+        }
+        if (field < next || (field >= HOURS) != (separator >= 0)) {
+            return ~start;
+        }
+        if (fractionEnd > pos && field != SECONDS) {
+            return ~pos;
+        }
+        
+        values[field] = (int) value;
+        parsed |= (1 << field);
+        if (field == SECONDS) {
+            values[MILLIS] = (negative ? -fraction : fraction);
+            parsed |= (1 << MILLIS);
+        }
+        next = field + 1;
+        pos = fractionEnd + 1;
+    }
+    
+    if (separator >= 0 && next == HOURS) {
+        // separator should not have been supplied
+        return ~separator;
+    }
+    
+    MutablePeriod *mutablePeriod = dynamic_cast<MutablePeriod*>(period);
+    if (mutablePeriod != 0) {
+        mutablePeriod->setFields(values, parsed);
+    } else {
+        if (parsed & (1 << YEARS)) period->setYears(values[YEARS]);
+        if (parsed & (1 << MONTHS)) period->setMonths(values[MONTHS]);
+        if (parsed & (1 << WEEKS)) period->setWeeks(values[WEEKS]);
+        if (parsed & (1 << DAYS)) period->setDays(values[DAYS]);
+        if (parsed & (1 << HOURS)) period->setHours(values[HOURS]);
+        if (parsed & (1 << MINUTES)) period->setMinutes(values[MINUTES]);
+        if (parsed & (1 << SECONDS)) period->setSeconds(values[SECONDS]);
+        if (parsed & (1 << MILLIS)) period->setMillis(values[MILLIS]);
+    }
+    return pos;
+}
+
+//-----------------------------------------------------------------------
+PeriodFormatter *ISOPeriodFormat::standard() {
+    // held by pointer, like the formatter, so neither is destroyed at exit
+    static StandardPrinterParser *const cPrinterParser = new StandardPrinterParser();
+    static PeriodFormatter *const cFormatter = new PeriodFormatter(cPrinterParser, cPrinterParser);
+    return cFormatter;
+}
+
+PeriodFormatter *ISOPeriodFormat::alternate() {
+    static PeriodFormatter *const cFormatter = (new PeriodFormatterBuilder())
+        ->appendLiteral("P")
+        ->printZeroAlways()
+        ->minimumPrintedDigits(4)
+        ->appendYears()
+        ->minimumPrintedDigits(2)
+        ->appendMonths()
+        ->appendDays()
+        ->appendSeparatorIfFieldsAfter("T")
+        ->appendHours()
+        ->appendMinutes()
+        ->appendSecondsWithOptionalMillis()
+        ->toFormatter();
+    return cFormatter;
+}
+
+PeriodFormatter *ISOPeriodFormat::alternateExtended() {
+    static PeriodFormatter *const cFormatter = (new PeriodFormatterBuilder())
+        ->appendLiteral("P")
+        ->printZeroAlways()
+        ->minimumPrintedDigits(4)
+        ->appendYears()
+        ->appendSeparator("-")
+        ->minimumPrintedDigits(2)
+        ->appendMonths()
+        ->appendSeparator("-")
+        ->appendDays()
+        ->appendSeparatorIfFieldsAfter("T")
+        ->appendHours()
+        ->appendSeparator(":")
+        ->appendMinutes()
+        ->appendSeparator(":")
+        ->appendSecondsWithOptionalMillis()
+        ->toFormatter();
+    return cFormatter;
+}
+
+PeriodFormatter *ISOPeriodFormat::alternateWithWeeks() {
+    static PeriodFormatter *const cFormatter = (new PeriodFormatterBuilder())
+        ->appendLiteral("P")
+        ->printZeroAlways()
+        ->minimumPrintedDigits(4)
+        ->appendYears()
+        ->minimumPrintedDigits(2)
+        ->appendPrefix("W")
+        ->appendWeeks()
+        ->appendDays()
+        ->appendSeparatorIfFieldsAfter("T")
+        ->appendHours()
+        ->appendMinutes()
+        ->appendSecondsWithOptionalMillis()
+        ->toFormatter();
+    return cFormatter;
+}
+
+PeriodFormatter *ISOPeriodFormat::alternateExtendedWithWeeks() {
+    static PeriodFormatter *const cFormatter = (new PeriodFormatterBuilder())
+        ->appendLiteral("P")
+        ->printZeroAlways()
+        ->minimumPrintedDigits(4)
+        ->appendYears()
+        ->appendSeparator("-")
+        ->minimumPrintedDigits(2)
+        ->appendPrefix("W")
+        ->appendWeeks()
+        ->appendSeparator("-")
+        ->appendDays()
+        ->appendSeparatorIfFieldsAfter("T")
+        ->appendHours()
+        ->appendSeparator(":")
+        ->appendMinutes()
+        ->appendSeparator(":")
+        ->appendSecondsWithOptionalMillis()
+        ->toFormatter();
+    return cFormatter;
+}
+
+CODATIME_END
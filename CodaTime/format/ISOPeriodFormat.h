@@ -12,7 +12,13 @@
 #include "CodaTimeMacros.h"
 
 #include "format/PeriodFormatter.h"
-#include "format/PeriodFormatterBuilder.h"
+#include "format/PeriodParser.h"
+#include "format/PeriodPrinter.h"
+
+#include <sstream>
+#include <string>
+
+using namespace std;
 
 CODATIME_BEGIN
 
@@ -24,7 +30,9 @@ CODATIME_BEGIN
  * The others are {@link PeriodFormat} and {@link PeriodFormatterBuilder}.
  * <p>
  * ISOPeriodFormat is thread-safe and immutable, and the formatters it
- * returns are as well.
+ * returns are as well. Each formatter is built on first use in a
+ * function-local static, so it can be used from the static initializers of
+ * other translation units, and only formats that are used are built.
  *
  * @author Brian S O'Neill
  * @since 1.0
@@ -35,16 +43,44 @@ class ISOPeriodFormat {
     
 private:
     
-    /** Cache of standard format. */
-    static PeriodFormatter *cStandard;
-    /** Cache of alternate months format. */
-    static PeriodFormatter *cAlternate;
-    /** Cache of alternate extended months format. */
-    static PeriodFormatter *cAlternateExtended;
-    /** Cache of alternate weeks format. */
-    static PeriodFormatter *cAlternateWithWeeks;
-    /** Cache of alternate extended weeks format. */
-    static PeriodFormatter *cAlternateExtendedWihWeeks;
+    /**
+     * Prints and parses the standard format in a single pass, without
+     * going through the generic builder printers and parsers.
+     * <p>
+     * Printing writes the whole period into a stack buffer then appends it
+     * once. Parsing reads every field then stores them all in one call.
+     */
+    class StandardPrinterParser : public PeriodPrinter, public PeriodParser {
+        
+    public:
+        
+        virtual ~StandardPrinterParser() {}
+        
+        size_t calculatePrintedLength(ReadablePeriod *period, const Locale *locale) const;
+        
+        int countFieldsToPrint(ReadablePeriod *period, int stopAt, const Locale *locale) const;
+        
+        void printTo(string &buf, ReadablePeriod *period, const Locale *locale) const;
+        
+        void printTo(stringstream &out, ReadablePeriod *period, const Locale *locale) const;
+        
+        int parseInto(ReadWritablePeriod *period, string periodStr, int position, const Locale *locale) const;
+        
+    private:
+        
+        /** The longest output, P and six int fields, T and signed seconds with millis */
+        static const int MAX_PRINTED_LENGTH = 96;
+        
+        /**
+         * Prints the period into the array.
+         *
+         * @param period  the period to print
+         * @param out  the array to print to, at least MAX_PRINTED_LENGTH long
+         * @param fieldCount  set to the number of fields printed
+         * @return the number of characters printed
+         */
+        static int print(ReadablePeriod *period, char *out, int &fieldCount);
+    };
     
 protected:
     
@@ -67,29 +103,7 @@ public:
      *
      * @return the formatter
      */
-    static PeriodFormatter *standard() {
-        if (cStandard == NULL) {
-            cStandard = (new PeriodFormatterBuilder())
-            ->appendLiteral("P")
-            ->appendYears()
-            ->appendSuffix("Y")
-            ->appendMonths()
-            ->appendSuffix("M")
-            ->appendWeeks()
-            ->appendSuffix("W")
-            ->appendDays()
-            ->appendSuffix("D")
-            ->appendSeparatorIfFieldsAfter("T")
-            ->appendHours()
-            ->appendSuffix("H")
-            ->appendMinutes()
-            ->appendSuffix("M")
-            ->appendSecondsWithOptionalMillis()
-            ->appendSuffix("S")
-            ->toFormatter();
-        }
-        return cStandard;
-    }
+    static PeriodFormatter *standard();
     
     /**
      * The alternate ISO format, PyyyymmddThhmmss, which excludes weeks.
@@ -99,24 +113,7 @@ public:
      *
      * @return the formatter
      */
-    static PeriodFormatter *alternate() {
-        if (cAlternate == NULL) {
-            cAlternate = (new PeriodFormatterBuilder())
-            ->appendLiteral("P")
-            ->printZeroAlways()
-            ->minimumPrintedDigits(4)
-            ->appendYears()
-            ->minimumPrintedDigits(2)
-            ->appendMonths()
-            ->appendDays()
-            ->appendSeparatorIfFieldsAfter("T")
-            ->appendHours()
-            ->appendMinutes()
-            ->appendSecondsWithOptionalMillis()
-            ->toFormatter();
-        }
-        return cAlternate;
-    }
+    static PeriodFormatter *alternate();
     
     /**
      * The alternate ISO format, Pyyyy-mm-ddThh:mm:ss, which excludes weeks->
@@ -126,28 +123,7 @@ public:
      *
      * @return the formatter
      */
-    static PeriodFormatter *alternateExtended() {
-        if (cAlternateExtended == NULL) {
-            cAlternateExtended = (new PeriodFormatterBuilder())
-            ->appendLiteral("P")
-            ->printZeroAlways()
-            ->minimumPrintedDigits(4)
-            ->appendYears()
-            ->appendSeparator("-")
-            ->minimumPrintedDigits(2)
-            ->appendMonths()
-            ->appendSeparator("-")
-            ->appendDays()
-            ->appendSeparatorIfFieldsAfter("T")
-            ->appendHours()
-            ->appendSeparator(":")
-            ->appendMinutes()
-            ->appendSeparator(":")
-            ->appendSecondsWithOptionalMillis()
-            ->toFormatter();
-        }
-        return cAlternateExtended;
-    }
+    static PeriodFormatter *alternateExtended();
     
     /**
      * The alternate ISO format, PyyyyWwwddThhmmss, which excludes months.
@@ -157,25 +133,7 @@ public:
      *
      * @return the formatter
      */
-    static PeriodFormatter *alternateWithWeeks() {
-        if (cAlternateWithWeeks == NULL) {
-            cAlternateWithWeeks = (new PeriodFormatterBuilder())
-            ->appendLiteral("P")
-            ->printZeroAlways()
-            ->minimumPrintedDigits(4)
-            ->appendYears()
-            ->minimumPrintedDigits(2)
-            ->appendPrefix("W")
-            ->appendWeeks()
-            ->appendDays()
-            ->appendSeparatorIfFieldsAfter("T")
-            ->appendHours()
-            ->appendMinutes()
-            ->appendSecondsWithOptionalMillis()
-            ->toFormatter();
-        }
-        return cAlternateWithWeeks;
-    }
+    static PeriodFormatter *alternateWithWeeks();
     
     /**
      * The alternate ISO format, Pyyyy-Www-ddThh:mm:ss, which excludes months.
@@ -185,29 +143,7 @@ public:
      *
      * @return the formatter
      */
-    static PeriodFormatter *alternateExtendedWithWeeks() {
-        if (cAlternateExtendedWihWeeks == NULL) {
-            cAlternateExtendedWihWeeks = (new PeriodFormatterBuilder())
-            ->appendLiteral("P")
-            ->printZeroAlways()
-            ->minimumPrintedDigits(4)
-            ->appendYears()
-            ->appendSeparator("-")
-            ->minimumPrintedDigits(2)
-            ->appendPrefix("W")
-            ->appendWeeks()
-            ->appendSeparator("-")
-            ->appendDays()
-            ->appendSeparatorIfFieldsAfter("T")
-            ->appendHours()
-            ->appendSeparator(":")
-            ->appendMinutes()
-            ->appendSeparator(":")
-            ->appendSecondsWithOptionalMillis()
-            ->toFormatter();
-        }
-        return cAlternateExtendedWihWeeks;
-    }
+    static PeriodFormatter *alternateExtendedWithWeeks();
     
 };
 
@@ -243,7 +243,7 @@ public:
      * @param buf  the formatted period is appended to this buffer
      * @param period  the period to format, not NULL
      */
-    void printTo(string buf, ReadablePeriod *period) {
+    void printTo(string &buf, ReadablePeriod *period) {
         checkPrinter();
         checkPeriod(period);
         
@@ -256,7 +256,7 @@ public:
      * @param out  the formatted period is written out
      * @param period  the period to format, not NULL
      */
-    void printTo(stringstream out, ReadablePeriod *period) {
+    void printTo(stringstream &out, ReadablePeriod *period) {
         checkPrinter();
         checkPeriod(period);
         
@@ -329,7 +329,7 @@ public:
     MutablePeriod *parseMutablePeriod(string text) {
         checkParser();
         
-        MutablePeriod *period = new MutablePeriod(0LL, iParseType);
+        MutablePeriod *period = new MutablePeriod((int64_t) 0, iParseType);
         int newPos = getParser()->parseInto(period, text, 0, iLocale);
         if (newPos >= 0) {
             if (newPos >= text.size()) {
@@ -15,11 +15,14 @@
 CODATIME_BEGIN
 
 
-const PeriodFormatterBuilder::Literal *PeriodFormatterBuilder::Literal::EMPTY = new PeriodFormatterBuilder::Literal("");
+const PeriodFormatterBuilder::Literal *PeriodFormatterBuilder::Literal::EMPTY() {
+    static const Literal *const cEmpty = new Literal("");
+    return cEmpty;
+}
 
 PeriodFormatter *PeriodFormatterBuilder::toFormatter() {
     PeriodFormatter *formatter = toFormatter(iElementPairs, iNotPrinter, iNotParser);
-//    iFieldFormatters = (vector<FieldFormatter>) iFieldFormatters.clone();
+    iFieldFormatters = new vector<FieldFormatter*>(*iFieldFormatters);
     return formatter;
 }
 
@@ -47,7 +50,7 @@ void PeriodFormatterBuilder::clear() {
     iElementPairs.clear();
     iNotPrinter = false;
     iNotParser = false;
-    iFieldFormatters.clear();
+    iFieldFormatters = new vector<FieldFormatter*>(MAX_FIELD + 1, (FieldFormatter*) NULL);
 }
 
 PeriodFormatterBuilder *PeriodFormatterBuilder::append(PeriodFormatter *formatter) {
@@ -231,7 +234,7 @@ void PeriodFormatterBuilder::appendField(int type, int minPrinted) {
     FieldFormatter *field = new FieldFormatter(minPrinted, iPrintZeroSetting,
                                               iMaxParsedDigits, iRejectSignedValues, type, iFieldFormatters, iPrefix, NULL);
     append0(field, field);
-    iFieldFormatters[type] = field;
+    (*iFieldFormatters)[type] = field;
     iPrefix = NULL;
 }
 
@@ -257,7 +260,7 @@ PeriodFormatterBuilder *PeriodFormatterBuilder::appendSuffix(PeriodFieldAffix *s
     FieldFormatter *newField = new FieldFormatter(fieldFormatter, suffix);
     iElementPairs[iElementPairs.size() - 2] = newField;
     iElementPairs[iElementPairs.size() - 1] = newField;
-    iFieldFormatters[newField->getFieldType()] = newField;
+    (*iFieldFormatters)[newField->getFieldType()] = newField;
     
     return this;
 }
@@ -273,7 +276,7 @@ PeriodFormatterBuilder *PeriodFormatterBuilder::appendSeparator(string text, str
     if (pairs.size() == 0) {
         if (useAfter && useBefore == false) {
             Separator *separator = new Separator(text, constText, variants,
-                                                Literal::EMPTY, Literal::EMPTY, useBefore, useAfter);
+                                                Literal::EMPTY(), Literal::EMPTY(), useBefore, useAfter);
             append0(separator, separator);
         }
         return this;
@@ -282,24 +285,23 @@ PeriodFormatterBuilder *PeriodFormatterBuilder::appendSeparator(string text, str
     // find the last separator added
     int i;
     const Separator *lastSeparator = NULL;
+    vector<Object*>::iterator first = pairs.begin();
     for (i = (int) pairs.size(); --i >= 0; ) {
         Separator *separator = dynamic_cast<Separator*>(pairs[i]);
         if (separator != 0) {
             lastSeparator = separator;
-            vector<Object*>::const_iterator first = pairs.begin() + i + 1;
-            vector<Object*>::const_iterator last = pairs.end();
-            pairs = vector<Object*>(first, last);
+            first = pairs.begin() + i + 1;
             break;
         }
         i--;  // element pairs
     }
     
     // merge formatters
-    if (lastSeparator != NULL && pairs.size() == 0) {
+    if (lastSeparator != NULL && first == pairs.end()) {
         throw IllegalStateException("Cannot have two adjacent separators");
     } else {
-        vector<Object*> comp = createComposite(pairs);
-        pairs.clear();
+        vector<Object*> comp = createComposite(vector<Object*>(first, pairs.end()));
+        pairs.erase(first, pairs.end());
         Separator *separator = new Separator(text, constText, variants,
                                             dynamic_cast<PeriodPrinter*>(comp[0]),
                                             dynamic_cast<PeriodParser*>(comp[1]),
@@ -361,8 +363,11 @@ PeriodFormatter *PeriodFormatterBuilder::toFormatter(vector<Object*> elementPair
 
 vector<Object*> PeriodFormatterBuilder::createComposite(vector<Object*> elementPairs) {
     switch (elementPairs.size()) {
-        case 0:
-            return {Literal::EMPTY, Literal::EMPTY};
+        case 0: {
+            // as Object pointers, a pair of Literal pointers would be taken as an iterator range
+            Object *empty = const_cast<Literal*>(Literal::EMPTY());
+            return {empty, empty};
+        }
         case 1:
             return {elementPairs[0], elementPairs[1]};
         default:
@@ -371,4 +376,74 @@ vector<Object*> PeriodFormatterBuilder::createComposite(vector<Object*> elementP
     }
 }
 
-CODATIME_END
\ No newline at end of file
+//-----------------------------------------------------------------------
+PeriodFormatterBuilder::PrintPlan::PrintPlan(ReadablePeriod *period, const Locale *locale) :
+    iPeriod(period), iLocale(locale), iMask(period->getPeriodType()->getFieldMask()),
+    iValues(), iZero(true), iLength(0)
+{
+    // the period holds its values in type order, which is standard order less the unsupported fields
+    int index = 0;
+    for (int i = 0, isize = (int) iValues.size(); i < isize; i++) {
+        if ((iMask >> i) & 1) {
+            iValues[i] = period->getValue(index++);
+            iZero = iZero && iValues[i] == 0;
+        }
+    }
+    iSteps.reserve(16);
+}
+
+int PeriodFormatterBuilder::PrintPlan::append(const PeriodPrinter *printer) {
+    const PlannedPrinter *planned = dynamic_cast<const PlannedPrinter*>(printer);
+    if (planned != 0) {
+        return planned->appendTo(*this);
+    }
+    Step step = { NULL, NULL, printer, 0 };
+    iSteps.push_back(step);
+    iLength += printer->calculatePrintedLength(iPeriod, iLocale);
+    return printer->countFieldsToPrint(iPeriod, INT_MAX, iLocale);
+}
+
+void PeriodFormatterBuilder::PrintPlan::appendText(const string *text) {
+    Step step = { text, NULL, NULL, 0 };
+    iSteps.push_back(step);
+    iLength += text->size();
+}
+
+void PeriodFormatterBuilder::PrintPlan::appendField(const FieldFormatter *field, int64_t value) {
+    Step step = { NULL, field, NULL, value };
+    iSteps.push_back(step);
+    iLength += field->calculateValueLength(value);
+}
+
+size_t PeriodFormatterBuilder::PrintPlan::reserveText() {
+    Step step = { NULL, NULL, NULL, 0 };
+    iSteps.push_back(step);
+    return iSteps.size() - 1;
+}
+
+void PeriodFormatterBuilder::PrintPlan::setText(size_t index, const string *text) {
+    iSteps[index].iText = text;
+    iLength += text->size();
+}
+
+void PeriodFormatterBuilder::PrintPlan::printTo(string &buf) const {
+    buf.reserve(buf.size() + iLength);
+    for (size_t i = 0, isize = iSteps.size(); i < isize; i++) {
+        const Step &step = iSteps[i];
+        if (step.iText != NULL) {
+            buf.append(*step.iText);
+        } else if (step.iField != NULL) {
+            step.iField->printValue(buf, step.iValue);
+        } else if (step.iPrinter != NULL) {
+            step.iPrinter->printTo(buf, iPeriod, iLocale);
+        }
+    }
+}
+
+void PeriodFormatterBuilder::PrintPlan::printTo(stringstream &out) const {
+    string buf;
+    printTo(buf);
+    out << buf;
+}
+
+CODATIME_END
@@ -523,9 +523,7 @@ private:
         
         virtual size_t calculatePrintedLength(int value) const = 0;
         
-        virtual void printTo(string buf, int value) const = 0;
-        
-        virtual void printTo(stringstream &out, int value) const = 0;
+        virtual void printTo(string &buf, int value) const = 0;
         
         /**
          * @return new position after parsing affix, or ~position of failure
@@ -557,14 +555,10 @@ private:
             return iText.size();
         }
         
-        void printTo(string buf, int value) const {
+        void printTo(string &buf, int value) const {
             buf.append(iText);
         }
         
-        void printTo(stringstream &out, int value) const {
-            out << iText.c_str();
-        }
-        
         int parse(string periodStr, int position) const {
             string text = iText;
             size_t textLength = text.size();
@@ -618,14 +612,10 @@ private:
             return (value == 1 ? iSingularText : iPluralText).size();
         }
         
-        void printTo(string buf, int value) const {
+        void printTo(string &buf, int value) const {
             buf.append(value == 1 ? iSingularText : iPluralText);
         }
         
-        void printTo(stringstream &out, int value) const {
-            out << (value == 1 ? iSingularText.c_str() : iPluralText.c_str());
-        }
-        
         int parse(string periodStr, int position) const {
             string text1 = iPluralText;
             string text2 = iSingularText;
@@ -695,16 +685,11 @@ private:
             + iRight->calculatePrintedLength(value);
         }
         
-        void printTo(string buf, int value) const {
+        void printTo(string &buf, int value) const {
             iLeft->printTo(buf, value);
             iRight->printTo(buf, value);
         }
         
-        void printTo(stringstream &out, int value) const {
-            iLeft->printTo(out, value);
-            iRight->printTo(out, value);
-        }
-        
         int parse(string periodStr, int position) const {
             position = iLeft->parse(periodStr, position);
             if (position >= 0) {
@@ -722,11 +707,133 @@ private:
         }
     };
     
+    class FieldFormatter;
+    
+    //-----------------------------------------------------------------------
+    /**
+     * The output of a single print, worked out in one pass over the printers.
+     * <p>
+     * The field values of the period are read once, in standard order. Each
+     * printer then appends the text it would print as a step, so separators
+     * can see how many fields follow them without asking the printers again.
+     * The total length is known before anything is written, so the caller's
+     * buffer is grown once.
+     */
+    class PrintPlan {
+        
+    public:
+        
+        PrintPlan(ReadablePeriod *period, const Locale *locale);
+        
+        /**
+         * Appends the steps of a printer, which need not come from this builder.
+         *
+         * @return the number of fields the printer prints
+         */
+        int append(const PeriodPrinter *printer);
+        
+        void appendText(const string *text);
+        
+        void appendField(const FieldFormatter *field, int64_t value);
+        
+        /**
+         * Reserves a step for text that is only known once later steps are planned.
+         *
+         * @return the index to pass to setText
+         */
+        size_t reserveText();
+        
+        void setText(size_t index, const string *text);
+        
+        //-----------------------------------------------------------------------
+        int getValue(int field) const {
+            return iValues[field];
+        }
+        
+        int getFieldMask() const {
+            return iMask;
+        }
+        
+        bool isZero() const {
+            return iZero;
+        }
+        
+        size_t getLength() const {
+            return iLength;
+        }
+        
+        void printTo(string &buf) const;
+        
+        void printTo(stringstream &out) const;
+        
+    private:
+        
+        /** A piece of output: literal text, a field value or a printer from elsewhere */
+        struct Step {
+            const string *iText;
+            const FieldFormatter *iField;
+            const PeriodPrinter *iPrinter;
+            int64_t iValue;
+        };
+        
+        ReadablePeriod *const iPeriod;
+        const Locale *const iLocale;
+        int iMask;
+        PeriodType::Values iValues;
+        bool iZero;
+        vector<Step> iSteps;
+        size_t iLength;
+    };
+    
+    //-----------------------------------------------------------------------
+    /**
+     * Base for the printers created by this builder, which print through a PrintPlan.
+     */
+    class PlannedPrinter : public PeriodPrinter {
+        
+    public:
+        
+        virtual ~PlannedPrinter() {}
+        
+        /**
+         * Appends the output of this printer to the plan.
+         *
+         * @return the number of fields printed
+         */
+        virtual int appendTo(PrintPlan &plan) const = 0;
+        
+        int countFieldsToPrint(ReadablePeriod *period, int stopAt, const Locale *locale) const {
+            if (stopAt <= 0) {
+                return 0;
+            }
+            PrintPlan plan(period, locale);
+            return appendTo(plan);
+        }
+        
+        size_t calculatePrintedLength(ReadablePeriod *period, const Locale *locale) const {
+            PrintPlan plan(period, locale);
+            appendTo(plan);
+            return plan.getLength();
+        }
+        
+        void printTo(string &buf, ReadablePeriod *period, const Locale *locale) const {
+            PrintPlan plan(period, locale);
+            appendTo(plan);
+            plan.printTo(buf);
+        }
+        
+        void printTo(stringstream &out, ReadablePeriod *period, const Locale *locale) const {
+            PrintPlan plan(period, locale);
+            appendTo(plan);
+            plan.printTo(out);
+        }
+    };
+    
     //-----------------------------------------------------------------------
     /**
      * Formats the numeric value of a field, potentially with prefix/suffix.
      */
-    class FieldFormatter : public PeriodPrinter, public PeriodParser {
+    class FieldFormatter : public PlannedPrinter, public PeriodParser {
         
     public:
         
@@ -743,14 +850,14 @@ private:
          * The array of the latest formatter added for each type->
          * This is shared between all the field formatters in a formatter.
          */
-        const vector<FieldFormatter*> iFieldFormatters;
+        const vector<FieldFormatter*> *iFieldFormatters;
         
         const PeriodFieldAffix *iPrefix;
         const PeriodFieldAffix *iSuffix;
         
         FieldFormatter(int minPrintedDigits, int printZeroSetting,
                        int maxParsedDigits, bool rejectSignedValues,
-                       int fieldType, vector<FieldFormatter*> fieldFormatters,
+                       int fieldType, const vector<FieldFormatter*> *fieldFormatters,
                        const PeriodFieldAffix *prefix, PeriodFieldAffix *suffix) :
             iMinPrintedDigits(minPrintedDigits), iPrintZeroSetting(printZeroSetting),
             iMaxParsedDigits(maxParsedDigits), iRejectSignedValues(rejectSignedValues),
@@ -775,22 +882,20 @@ private:
             return suffix;
         }
         
-        int countFieldsToPrint(ReadablePeriod *period, int stopAt, const Locale *locale) const {
-            if (stopAt <= 0) {
-                return 0;
-            }
-            if (iPrintZeroSetting == PRINT_ZERO_ALWAYS || getFieldValue(period) != LLONG_MAX) {
+        int appendTo(PrintPlan &plan) const {
+            int64_t valueLong = getFieldValue(plan);
+            if (valueLong != LLONG_MAX) {
+                plan.appendField(this, valueLong);
                 return 1;
             }
-            return 0;
+            return (iPrintZeroSetting == PRINT_ZERO_ALWAYS ? 1 : 0);
         }
         
-        size_t calculatePrintedLength(ReadablePeriod *period, const Locale *locale) const {
-            int64_t valueLong = getFieldValue(period);
-            if (valueLong == LLONG_MAX) {
-                return 0;
-            }
-            
+        /**
+         * @param valueLong  the value from getFieldValue, not LLONG_MAX
+         * @return the number of characters printValue will append
+         */
+        size_t calculateValueLength(int64_t valueLong) const {
             int sum = max(FormatUtils::calculateDigitCount(valueLong), iMinPrintedDigits);
             if (iFieldType >= SECONDS_MILLIS) {
                 // valueLong contains the seconds and millis fields
@@ -817,11 +922,11 @@ private:
             return sum;
         }
         
-        void printTo(string buf, ReadablePeriod *period, const Locale *locale) const {
-            int64_t valueLong = getFieldValue(period);
-            if (valueLong == LLONG_MAX) {
-                return;
-            }
+        /**
+         * @param buf  the buffer to append to
+         * @param valueLong  the value from getFieldValue, not LLONG_MAX
+         */
+        void printValue(string &buf, int64_t valueLong) const {
             int value = (int) valueLong;
             if (iFieldType >= SECONDS_MILLIS) {
                 value = (int) (valueLong / DateTimeConstants::MILLIS_PER_SECOND);
@@ -852,37 +957,6 @@ private:
             }
         }
         
-        void printTo(stringstream &out, ReadablePeriod *period, const Locale *locale) const {
-            int64_t valueLong = getFieldValue(period);
-            if (valueLong == LLONG_MAX) {
-                return;
-            }
-            int value = (int) valueLong;
-            if (iFieldType >= SECONDS_MILLIS) {
-                value = (int) (valueLong / DateTimeConstants::MILLIS_PER_SECOND);
-            }
-            
-            if (iPrefix != NULL) {
-                iPrefix->printTo(out, value);
-            }
-            int minDigits = iMinPrintedDigits;
-            if (minDigits <= 1) {
-                FormatUtils::writeUnpaddedInteger(out, value);
-            } else {
-                FormatUtils::writePaddedInteger(out, value, minDigits);
-            }
-            if (iFieldType >= SECONDS_MILLIS) {
-                int dp = (int) (abs(valueLong) % DateTimeConstants::MILLIS_PER_SECOND);
-                if (iFieldType == SECONDS_MILLIS || dp > 0) {
-                    out << '.';
-                    FormatUtils::writePaddedInteger(out, dp, 3);
-                }
-            }
-            if (iSuffix != NULL) {
-                iSuffix->printTo(out, value);
-            }
-        }
-        
         int parseInto(ReadWritablePeriod *period, string text,
                              int position, const Locale *locale) const {
             
@@ -1080,52 +1154,22 @@ private:
         /**
          * @return LLONG_MAX if nothing to print, otherwise value
          */
-        int64_t getFieldValue(ReadablePeriod *period) const {
-            const PeriodType *type;
-            if (iPrintZeroSetting == PRINT_ZERO_ALWAYS) {
-                type = NULL; // Don't need to check if supported.
-            } else {
-                type = period->getPeriodType();
-            }
-            if (type != NULL && isSupported(type, iFieldType) == false) {
+        int64_t getFieldValue(const PrintPlan &plan) const {
+            int mask = plan.getFieldMask();
+            if (iPrintZeroSetting != PRINT_ZERO_ALWAYS && isSupported(mask, iFieldType) == false) {
                 return LLONG_MAX;
             }
             
             int64_t value;
             
-            switch (iFieldType) {
-                default:
-                    return LLONG_MAX;
-                case YEARS:
-                    value = period->get(DurationFieldType::years());
-                    break;
-                case MONTHS:
-                    value = period->get(DurationFieldType::months());
-                    break;
-                case WEEKS:
-                    value = period->get(DurationFieldType::weeks());
-                    break;
-                case DAYS:
-                    value = period->get(DurationFieldType::days());
-                    break;
-                case HOURS:
-                    value = period->get(DurationFieldType::hours());
-                    break;
-                case MINUTES:
-                    value = period->get(DurationFieldType::minutes());
-                    break;
-                case SECONDS:
-                    value = period->get(DurationFieldType::seconds());
-                    break;
-                case MILLIS:
-                    value = period->get(DurationFieldType::millis());
-                    break;
-                case SECONDS_MILLIS: // drop through
-                case SECONDS_OPTIONAL_MILLIS:
-                    int seconds = period->get(DurationFieldType::seconds());
-                    int millis = period->get(DurationFieldType::millis());
-                    value = (seconds * (long) DateTimeConstants::MILLIS_PER_SECOND) + millis;
-                    break;
+            if (iFieldType < 0 || iFieldType > MAX_FIELD) {
+                return LLONG_MAX;
+            } else if (iFieldType < SECONDS_MILLIS) {
+                value = plan.getValue(iFieldType);
+            } else {
+                int seconds = plan.getValue(SECONDS);
+                int millis = plan.getValue(MILLIS);
+                value = (seconds * (int64_t) DateTimeConstants::MILLIS_PER_SECOND) + millis;
             }
             
             // determine if period is zero and this is the last field
@@ -1134,9 +1178,9 @@ private:
                     case PRINT_ZERO_NEVER:
                         return LLONG_MAX;
                     case PRINT_ZERO_RARELY_LAST:
-                        if (isZero(period) && iFieldFormatters[iFieldType] == this) {
+                        if (plan.isZero() && (*iFieldFormatters)[iFieldType] == this) {
                             for (int i = iFieldType + 1; i <= MAX_FIELD; i++) {
-                                if (isSupported(type, i) && iFieldFormatters[i] != NULL) {
+                                if (isSupported(mask, i) && (*iFieldFormatters)[i] != NULL) {
                                     return LLONG_MAX;
                                 }
                             }
@@ -1145,11 +1189,11 @@ private:
                         }
                         break;
                     case PRINT_ZERO_RARELY_FIRST:
-                        if (isZero(period) && iFieldFormatters[iFieldType] == this) {
+                        if (plan.isZero() && (*iFieldFormatters)[iFieldType] == this) {
                             int i = min(iFieldType, 8);  // line split out for IBM JDK
                             i--;                              // see bug 1660490
                             for (; i >= 0 && i <= MAX_FIELD; i--) {
-                                if (isSupported(type, i) && iFieldFormatters[i] != NULL) {
+                                if (isSupported(mask, i) && (*iFieldFormatters)[i] != NULL) {
                                     return LLONG_MAX;
                                 }
                             }
@@ -1163,40 +1207,21 @@ private:
             return value;
         }
         
-        bool isZero(ReadablePeriod *period) const {
-            for (int i = 0, isize = period->size(); i < isize; i++) {
-                if (period->getValue(i) != 0) {
-                    return false;
-                }
-            }
-            return true;
+        bool isSupported(const PeriodType *type, int field) const {
+            return isSupported(type->getFieldMask(), field);
         }
         
-        bool isSupported(const PeriodType *type, int field) const {
-            switch (field) {
-                default:
-                    return false;
-                case YEARS:
-                    return type->isSupported(DurationFieldType::years());
-                case MONTHS:
-                    return type->isSupported(DurationFieldType::months());
-                case WEEKS:
-                    return type->isSupported(DurationFieldType::weeks());
-                case DAYS:
-                    return type->isSupported(DurationFieldType::days());
-                case HOURS:
-                    return type->isSupported(DurationFieldType::hours());
-                case MINUTES:
-                    return type->isSupported(DurationFieldType::minutes());
-                case SECONDS:
-                    return type->isSupported(DurationFieldType::seconds());
-                case MILLIS:
-                    return type->isSupported(DurationFieldType::millis());
-                case SECONDS_MILLIS: // drop through
-                case SECONDS_OPTIONAL_MILLIS:
-                    return type->isSupported(DurationFieldType::seconds()) ||
-                    type->isSupported(DurationFieldType::millis());
+        /**
+         * @param mask  the field mask of a period type, bit i set for standard field i
+         */
+        bool isSupported(int mask, int field) const {
+            if (field < 0 || field > MAX_FIELD) {
+                return false;
             }
+            if (field >= SECONDS_MILLIS) {
+                return (mask & ((1 << SECONDS) | (1 << MILLIS))) != 0;
+            }
+            return ((mask >> field) & 1) != 0;
         }
         
         void setFieldValue(ReadWritablePeriod *period, int field, int value) const {
@@ -1239,34 +1264,24 @@ private:
     /**
      * Handles a simple literal piece of text.
      */
-    class Literal : public virtual Object, public PeriodPrinter, public PeriodParser {
+    class Literal : public virtual Object, public PlannedPrinter, public PeriodParser {
         
     public:
         
         virtual ~Literal() {}
         
-        static const Literal *EMPTY;
+        /** Gets the empty literal, created on first use and never destroyed */
+        static const Literal *EMPTY();
         const string iText;
         
         Literal(string text) : iText(text) {
         }
         
-        int countFieldsToPrint(ReadablePeriod *period, int stopAt, const Locale *locale) const {
+        int appendTo(PrintPlan &plan) const {
+            plan.appendText(&iText);
             return 0;
         }
         
-        size_t calculatePrintedLength(ReadablePeriod *period, const Locale *locale) const {
-            return iText.size();
-        }
-        
-        void printTo(string buf, ReadablePeriod *period, const Locale *locale) const {
-            buf.append(iText);
-        }
-        
-        void printTo(stringstream &out, ReadablePeriod *period, const Locale *locale) const {
-            out << iText.c_str();
-        }
-        
         int parseInto(ReadWritablePeriod *period, string periodStr,
                              int position, const Locale *locale) const {
             if (periodStr.compare(position, iText.size(), iText, 0, iText.size()) != 0) {
@@ -1281,7 +1296,7 @@ private:
      * Handles a separator, that splits the fields into multiple parts.
      * For example, the 'T' in the ISO8601 standard.
      */
-    class Separator : public PeriodPrinter, public PeriodParser {
+    class Separator : public PlannedPrinter, public PeriodParser {
         
     public:
         
@@ -1304,8 +1319,9 @@ private:
                   bool useBefore, bool useAfter) :
             iText(text), iFinalText(constText),
             iParsedForms(checkParsedForm(text, constText, variants)),
-            iBeforeParser(beforeParser), iBeforePrinter(beforePrinter),
-            iUseBefore(useBefore), iUseAfter(useAfter)
+            iUseBefore(useBefore), iUseAfter(useAfter),
+            iBeforePrinter(beforePrinter), iAfterPrinter(NULL),
+            iBeforeParser(beforeParser), iAfterParser(NULL)
         {
         }
         
@@ -1324,86 +1340,31 @@ private:
                 }
             }
             
-            vector<string> forms;
-            copy(parsedForms.rbegin(), parsedForms.rend(), forms);
+            vector<string> forms(parsedForms.rbegin(), parsedForms.rend());
             
             return forms;
         }
         
-        int countFieldsToPrint(ReadablePeriod *period, int stopAt, const Locale *locale) const {
-            int sum = iBeforePrinter->countFieldsToPrint(period, stopAt, locale);
-            if (sum < stopAt) {
-                sum += iAfterPrinter->countFieldsToPrint(period, stopAt, locale);
-            }
-            return sum;
-        }
-        
-        size_t calculatePrintedLength(ReadablePeriod *period, const Locale *locale) const {
-            const PeriodPrinter *before = iBeforePrinter;
-            const PeriodPrinter *after = iAfterPrinter;
-            
-            size_t sum = before->calculatePrintedLength(period, locale) + after->calculatePrintedLength(period, locale);
+        int appendTo(PrintPlan &plan) const {
+            int beforeCount = plan.append(iBeforePrinter);
+            size_t separator = plan.reserveText();
+            int afterCount = plan.append(iAfterPrinter);
             
             if (iUseBefore) {
-                if (before->countFieldsToPrint(period, 1, locale) > 0) {
+                if (beforeCount > 0) {
                     if (iUseAfter) {
-                        int afterCount = after->countFieldsToPrint(period, 2, locale);
                         if (afterCount > 0) {
-                            sum += (afterCount > 1 ? iText : iFinalText).size();
+                            plan.setText(separator, afterCount > 1 ? &iText : &iFinalText);
                         }
                     } else {
-                        sum += iText.size();
+                        plan.setText(separator, &iText);
                     }
                 }
-            } else if (iUseAfter && after->countFieldsToPrint(period, 1, locale) > 0) {
-                sum += iText.size();
+            } else if (iUseAfter && afterCount > 0) {
+                plan.setText(separator, &iText);
             }
             
-            return sum;
-        }
-        
-        void printTo(string buf, ReadablePeriod *period, const Locale *locale) const {
-            const PeriodPrinter *before = iBeforePrinter;
-            const PeriodPrinter *after = iAfterPrinter;
-            
-            before->printTo(buf, period, locale);
-            if (iUseBefore) {
-                if (before->countFieldsToPrint(period, 1, locale) > 0) {
-                    if (iUseAfter) {
-                        int afterCount = after->countFieldsToPrint(period, 2, locale);
-                        if (afterCount > 0) {
-                            buf.append(afterCount > 1 ? iText : iFinalText);
-                        }
-                    } else {
-                        buf.append(iText);
-                    }
-                }
-            } else if (iUseAfter && after->countFieldsToPrint(period, 1, locale) > 0) {
-                buf.append(iText);
-            }
-            after->printTo(buf, period, locale);
-        }
-        
-        void printTo(stringstream &out, ReadablePeriod *period, const Locale *locale) const {
-            const PeriodPrinter *before = iBeforePrinter;
-            const PeriodPrinter *after = iAfterPrinter;
-            
-            before->printTo(out, period, locale);
-            if (iUseBefore) {
-                if (before->countFieldsToPrint(period, 1, locale) > 0) {
-                    if (iUseAfter) {
-                        int afterCount = after->countFieldsToPrint(period, 2, locale);
-                        if (afterCount > 0) {
-                            out << (afterCount > 1 ? iText : iFinalText);
-                        }
-                    } else {
-                        out << iText;
-                    }
-                }
-            } else if (iUseAfter && after->countFieldsToPrint(period, 1, locale) > 0) {
-                out << iText;
-            }
-            after->printTo(out, period, locale);
+            return beforeCount + afterCount;
         }
         
         int parseInto(ReadWritablePeriod *period, string periodStr,
@@ -1465,7 +1426,7 @@ private:
     /**
      * Composite implementation that merges other fields to create a full pattern.
      */
-    class Composite : public PeriodPrinter, public PeriodParser {
+    class Composite : public PlannedPrinter, public PeriodParser {
         
     public:
         
@@ -1489,34 +1450,13 @@ private:
             }
         }
         
-        int countFieldsToPrint(ReadablePeriod *period, int stopAt, const Locale *locale) const {
-            int sum = 0;
-            for (int i = (int) iPrinters.size(); sum < stopAt && --i >= 0; ) {
-                sum += iPrinters[i]->countFieldsToPrint(period, INT_MAX, locale);
-            }
-            return sum;
-        }
-        
-        size_t calculatePrintedLength(ReadablePeriod *period, const Locale *locale) const {
+        int appendTo(PrintPlan &plan) const {
             int sum = 0;
-            for (int i = (int) iPrinters.size(); --i >= 0; ) {
-                sum += iPrinters[i]->calculatePrintedLength(period, locale);
-            }
-            return sum;
-        }
-        
-        void printTo(string buf, ReadablePeriod *period, const Locale *locale) const {
-            size_t len = iPrinters.size();
-            for (int i=0; i<len; i++) {
-                iPrinters[i]->printTo(buf, period, locale);
-            }
-        }
-        
-        void printTo(stringstream &out, ReadablePeriod *period, const Locale *locale) const {
             size_t len = iPrinters.size();
             for (int i=0; i<len; i++) {
-                iPrinters[i]->printTo(out, period, locale);
+                sum += plan.append(iPrinters[i]);
             }
+            return sum;
         }
         
         int parseInto(ReadWritablePeriod *period, string periodStr,
@@ -1600,7 +1540,7 @@ private:
     bool iNotParser;
     
     // Last PeriodFormatter appended of each field type->
-    vector<FieldFormatter*> iFieldFormatters;
+    vector<FieldFormatter*> *iFieldFormatters;
     
     /**
      * Append a field prefix which applies only to the next appended field-> If
@@ -73,7 +73,7 @@ public:
      * @param period  the period to format
      * @param locale  the locale to use
      */
-    virtual void printTo(string buf, ReadablePeriod *period, const Locale *locale) const = 0;
+    virtual void printTo(string &buf, ReadablePeriod *period, const Locale *locale) const = 0;
     
     /**
      * Prints a ReadablePeriod to a Writer.
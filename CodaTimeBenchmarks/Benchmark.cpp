@@ -0,0 +1,207 @@
+//
+//  Benchmark.cpp
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#include "Benchmark.h"
+
+#include "Exceptions.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+CODATIME_BEGIN
+
+static atomic<int64_t> cKept(0);
+
+void keepValue(int64_t value) {
+    cKept.fetch_xor(value, memory_order_relaxed);
+}
+
+//-----------------------------------------------------------------------
+BenchmarkRunner::BenchmarkRunner(int64_t minNanos, int repetitions, string filter) :
+    iMinNanos(minNanos), iRepetitions(repetitions < 1 ? 1 : repetitions), iFilter(filter) {
+}
+
+double BenchmarkRunner::time(Benchmark *benchmark, int64_t iterations) {
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    keepValue(benchmark->run(iterations));
+    chrono::steady_clock::time_point end = chrono::steady_clock::now();
+    return (double) chrono::duration_cast<chrono::nanoseconds>(end - start).count();
+}
+
+vector<BenchmarkResult> BenchmarkRunner::run(const vector<Benchmark*> &benchmarks) {
+    vector<BenchmarkResult> results;
+    for (size_t b = 0; b < benchmarks.size(); b++) {
+        Benchmark *benchmark = benchmarks[b];
+        if (benchmark->getName().find(iFilter) == string::npos) {
+            continue;
+        }
+        benchmark->setUp();
+
+        // grow the iteration count until one run is long enough to time
+        int64_t iterations = 1;
+        double nanos = time(benchmark, iterations);
+        while (nanos < iMinNanos && iterations < (INT64_C(1) << 40)) {
+            double scale = (nanos <= 0 ? 100.0 : min(100.0, max(2.0, 1.2 * iMinNanos / nanos)));
+            iterations = (int64_t) (iterations * scale);
+            nanos = time(benchmark, iterations);
+        }
+
+        vector<double> perOp;
+        for (int r = 0; r < iRepetitions; r++) {
+            perOp.push_back(time(benchmark, iterations) / iterations);
+        }
+        sort(perOp.begin(), perOp.end());
+
+        BenchmarkResult result;
+        result.name = benchmark->getName();
+        result.iterations = iterations;
+        result.median = (perOp[(perOp.size() - 1) / 2] + perOp[perOp.size() / 2]) / 2;
+        result.min = perOp[0];
+        results.push_back(result);
+        cerr << left << setw(40) << result.name << right << setw(14) << fixed << setprecision(2)
+             << result.median << " ns/op" << endl;
+    }
+    return results;
+}
+
+//-----------------------------------------------------------------------
+void BenchmarkRunner::write(ostream &out, const vector<BenchmarkResult> &results) {
+    out << "benchmark,iterations,median_ns,min_ns" << endl;
+    for (size_t i = 0; i < results.size(); i++) {
+        const BenchmarkResult &result = results[i];
+        out << result.name << ',' << result.iterations << ','
+            << fixed << setprecision(3) << result.median << ',' << result.min << endl;
+    }
+}
+
+void BenchmarkRunner::read(istream &in, map<string, double> &medians) {
+    string line;
+    if (!getline(in, line) || line.compare(0, 10, "benchmark,") != 0) {
+        throw IllegalArgumentException("The baseline must start with the benchmark,iterations,median_ns,min_ns header");
+    }
+    while (getline(in, line)) {
+        if (line.empty()) {
+            continue;
+        }
+        size_t first = line.find(',');
+        size_t second = (first == string::npos ? string::npos : line.find(',', first + 1));
+        size_t third = (second == string::npos ? string::npos : line.find(',', second + 1));
+        if (third == string::npos) {
+            string err("Invalid baseline line: ");
+            err.append(line);
+            throw IllegalArgumentException(err);
+        }
+        medians[line.substr(0, first)] = strtod(line.substr(second + 1, third - second - 1).c_str(), NULL);
+    }
+}
+
+int BenchmarkRunner::compare(ostream &out, const vector<BenchmarkResult> &results,
+                             const map<string, double> &baseline, double threshold) {
+    int regressions = 0;
+    out << "benchmark,baseline_ns,median_ns,change_percent,status" << endl;
+    for (size_t i = 0; i < results.size(); i++) {
+        const BenchmarkResult &result = results[i];
+        map<string, double>::const_iterator it = baseline.find(result.name);
+        out << result.name << ',';
+        if (it == baseline.end() || it->second <= 0) {
+            out << ',' << fixed << setprecision(3) << result.median << ",,new" << endl;
+            continue;
+        }
+        double change = (result.median - it->second) / it->second;
+        const char *status = "same";
+        if (change > threshold) {
+            status = "slower";
+            regressions++;
+        } else if (change < -threshold) {
+            status = "faster";
+        }
+        out << fixed << setprecision(3) << it->second << ',' << result.median << ','
+            << setprecision(1) << change * 100 << ',' << status << endl;
+    }
+    return regressions;
+}
+
+//-----------------------------------------------------------------------
+static int usage(const string &message) {
+    cerr << message << endl;
+    cerr << "usage: [--filter TEXT] [--quick] [--repetitions N] [--output FILE]"
+            " [--baseline FILE] [--threshold PERCENT]" << endl;
+    return 2;
+}
+
+int runBenchmarks(int argc, char **argv, const vector<Benchmark*> &benchmarks) {
+    string filter;
+    string output;
+    string baselineFile;
+    int64_t minNanos = 200000000;
+    int repetitions = 5;
+    double threshold = 0.1;
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+        if (arg == "--quick") {
+            minNanos = 1000000;
+            repetitions = 1;
+        } else if (arg == "--filter" && hasValue) {
+            filter = argv[++i];
+        } else if (arg == "--repetitions" && hasValue) {
+            repetitions = atoi(argv[++i]);
+        } else if (arg == "--output" && hasValue) {
+            output = argv[++i];
+        } else if (arg == "--baseline" && hasValue) {
+            baselineFile = argv[++i];
+        } else if (arg == "--threshold" && hasValue) {
+            threshold = atof(argv[++i]) / 100;
+        } else {
+            return usage("Unknown or incomplete option: " + arg);
+        }
+    }
+
+    map<string, double> baseline;
+    if (!baselineFile.empty()) {
+        ifstream in(baselineFile.c_str());
+        if (!in) {
+            return usage("Cannot read the baseline: " + baselineFile);
+        }
+        try {
+            BenchmarkRunner::read(in, baseline);
+        } catch (IllegalArgumentException &e) {
+            return usage(e.what());
+        }
+    }
+
+    BenchmarkRunner runner(minNanos, repetitions, filter);
+    vector<BenchmarkResult> results = runner.run(benchmarks);
+    for (size_t i = 0; i < benchmarks.size(); i++) {
+        delete benchmarks[i];
+    }
+
+    BenchmarkRunner::write(cout, results);
+    if (!output.empty()) {
+        ofstream out(output.c_str());
+        BenchmarkRunner::write(out, results);
+    }
+    if (!baselineFile.empty()) {
+        cout << endl;
+        int regressions = BenchmarkRunner::compare(cout, results, baseline, threshold);
+        if (regressions > 0) {
+            cerr << regressions << " benchmark(s) slower than the baseline by more than "
+                 << threshold * 100 << "%" << endl;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+CODATIME_END
@@ -0,0 +1,184 @@
+//
+//  Benchmark.h
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#ifndef __CodaTime__Benchmark__
+#define __CodaTime__Benchmark__
+
+#include "CodaTimeMacros.h"
+
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+CODATIME_BEGIN
+
+/**
+ * Benchmark is one timed operation.
+ * <p>
+ * The runner calls {@link #setUp()} once, then {@link #run(int64_t)} with
+ * increasing iteration counts until a run takes long enough to time. Each
+ * run returns a value derived from every result, which the runner keeps, so
+ * that the compiler cannot remove the work being measured.
+ */
+class Benchmark {
+
+private:
+
+    string iName;
+
+public:
+
+    /**
+     * Constructor.
+     *
+     * @param name  the name, such as "periodBatch/sum", used in the results
+     */
+    Benchmark(string name) : iName(name) {
+    }
+
+    virtual ~Benchmark() {
+    }
+
+    const string &getName() const {
+        return iName;
+    }
+
+    /**
+     * Prepares the input, outside of the timed runs.
+     */
+    virtual void setUp() {
+    }
+
+    /**
+     * Performs the operation a number of times.
+     *
+     * @param iterations  the number of operations
+     * @return a value derived from the results
+     */
+    virtual int64_t run(int64_t iterations) = 0;
+
+};
+
+/**
+ * The timing of one benchmark, in nanoseconds per operation.
+ */
+struct BenchmarkResult {
+    string name;
+    int64_t iterations;
+    double median;
+    double min;
+};
+
+/**
+ * BenchmarkRunner times benchmarks and reads and writes their results.
+ * <p>
+ * Results are written as CSV with a header line, one benchmark per line:
+ * <pre>
+ * benchmark,iterations,median_ns,min_ns
+ * periodBatch/sum,2048,812.5,790.1
+ * </pre>
+ * A file written by one run can be given as the baseline of a later run,
+ * which then reports the change of each median and fails if any benchmark
+ * is slower by more than the threshold.
+ */
+class BenchmarkRunner {
+
+private:
+
+    int64_t iMinNanos;
+    int iRepetitions;
+    string iFilter;
+
+    double time(Benchmark *benchmark, int64_t iterations);
+
+public:
+
+    /**
+     * Constructor.
+     *
+     * @param minNanos  the shortest time to run each repetition for
+     * @param repetitions  the number of timed repetitions, at least one
+     * @param filter  run only benchmarks whose name contains this, empty for all
+     */
+    BenchmarkRunner(int64_t minNanos, int repetitions, string filter);
+
+    /**
+     * Runs the benchmarks that match the filter.
+     *
+     * @param benchmarks  the benchmarks
+     * @return the results, in the order run
+     */
+    vector<BenchmarkResult> run(const vector<Benchmark*> &benchmarks);
+
+    //-----------------------------------------------------------------------
+    /**
+     * Writes results as CSV.
+     *
+     * @param out  the stream to write to
+     * @param results  the results
+     */
+    static void write(ostream &out, const vector<BenchmarkResult> &results);
+
+    /**
+     * Reads the medians from results written by {@link #write}.
+     *
+     * @param in  the stream to read
+     * @param medians  the map to populate with the median of each benchmark
+     * @throws IllegalArgumentException if the header or a line is malformed
+     */
+    static void read(istream &in, map<string, double> &medians);
+
+    /**
+     * Compares results to a baseline, writing the change of each benchmark
+     * as CSV. A benchmark missing from the baseline is reported as new.
+     *
+     * @param out  the stream to write to
+     * @param results  the current results
+     * @param baseline  the baseline medians
+     * @param threshold  the largest slowdown allowed, 0.1 for ten percent
+     * @return the number of benchmarks slower than the threshold allows
+     */
+    static int compare(ostream &out, const vector<BenchmarkResult> &results,
+                       const map<string, double> &baseline, double threshold);
+
+};
+
+/**
+ * Runs a benchmark program from its command line.
+ * <p>
+ * The options are:
+ * <ul>
+ * <li><code>--filter TEXT</code> runs only benchmarks whose name contains TEXT
+ * <li><code>--quick</code> runs each benchmark briefly, to check that it works
+ * <li><code>--repetitions N</code> sets the number of timed repetitions
+ * <li><code>--output FILE</code> writes the results to FILE as well as stdout
+ * <li><code>--baseline FILE</code> compares the results to FILE
+ * <li><code>--threshold PERCENT</code> sets the slowdown allowed, default 10
+ * </ul>
+ *
+ * @param argc  the argument count
+ * @param argv  the arguments
+ * @param benchmarks  the benchmarks, deleted before returning
+ * @return the exit status, 1 if a benchmark regressed and 2 for a usage error
+ */
+int runBenchmarks(int argc, char **argv, const vector<Benchmark*> &benchmarks);
+
+/**
+ * Keeps a value, so that the work producing it cannot be optimized away.
+ *
+ * @param value  the value
+ */
+void keepValue(int64_t value);
+
+CODATIME_END
+
+#endif /* defined(__CodaTime__Benchmark__) */
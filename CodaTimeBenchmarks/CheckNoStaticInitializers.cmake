@@ -0,0 +1,17 @@
+# Fails if the library has a dynamic static initializer, which compilers
+# emit as a function whose symbol contains _GLOBAL__sub_I_.
+#
+# cmake -DNM=<nm> -DLIBRARY=<archive> -P CheckNoStaticInitializers.cmake
+
+execute_process(COMMAND ${NM} ${LIBRARY}
+    OUTPUT_VARIABLE symbols
+    RESULT_VARIABLE result)
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "Cannot list the symbols of ${LIBRARY}")
+endif()
+
+string(REGEX MATCHALL "[^\n]*_GLOBAL__sub_I_[^\n]*" initializers "${symbols}")
+if(initializers)
+    string(REPLACE ";" "\n" initializers "${initializers}")
+    message(FATAL_ERROR "${LIBRARY} runs static initializers when loaded:\n${initializers}")
+endif()
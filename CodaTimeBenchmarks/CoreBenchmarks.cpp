@@ -0,0 +1,509 @@
+//
+//  CoreBenchmarks.cpp
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#include "CoreBenchmarks.h"
+
+#include "DateTimeConstants.h"
+#include "DateTimeFieldType.h"
+#include "DurationFieldType.h"
+#include "IntervalIndex.h"
+#include "PackedLocalDate.h"
+#include "PackedLocalTime.h"
+#include "PeriodBatch.h"
+#include "PeriodType.h"
+#include "field/DividedDateTimeField.h"
+#include "field/OffsetDateTimeField.h"
+#include "field/PreciseDateTimeField.h"
+#include "field/PreciseDurationField.h"
+#include "field/RemainderDateTimeField.h"
+
+#include <cstring>
+
+CODATIME_BEGIN
+
+/**
+ * A linear congruential generator, so that every run sees the same input.
+ */
+class BenchmarkRandom {
+
+private:
+
+    uint64_t iState;
+
+public:
+
+    BenchmarkRandom(uint64_t seed) : iState(seed) {
+    }
+
+    int nextInt(int low, int high) {
+        iState = iState * UINT64_C(6364136223846793005) + UINT64_C(1442695040888963407);
+        return low + (int) ((iState >> 33) % (uint64_t) (high - low + 1));
+    }
+
+};
+
+//-----------------------------------------------------------------------
+/**
+ * Times one PeriodBatch operation over a batch of periods.
+ */
+class PeriodBatchBenchmark : public Benchmark {
+
+public:
+
+    enum Operation { SUM, SCALE, TO_STANDARD_MILLIS, NORMALIZED_STANDARD };
+
+    static const size_t BATCH_SIZE = 1024;
+
+private:
+
+    // the positions of the fields in standard order
+    static const int YEARS = 0;
+    static const int MONTHS = 1;
+    static const int MILLIS = 7;
+
+    Operation iOperation;
+    vector<PeriodType::Values> iInput;
+    vector<PeriodType::Values> iWork;
+    vector<int64_t> iMillis;
+
+public:
+
+    PeriodBatchBenchmark(string name, Operation operation) : Benchmark(name), iOperation(operation) {
+    }
+
+    void setUp() {
+        BenchmarkRandom random(BATCH_SIZE);
+        iInput.resize(BATCH_SIZE);
+        for (size_t i = 0; i < BATCH_SIZE; i++) {
+            for (size_t f = 0; f < iInput[i].size(); f++) {
+                iInput[i][f] = random.nextInt(-1000, 1000);
+            }
+            if (iOperation == TO_STANDARD_MILLIS) {
+                // years and months have no standard length
+                iInput[i][YEARS] = 0;
+                iInput[i][MONTHS] = 0;
+            }
+        }
+        iWork = iInput;
+        iMillis.resize(BATCH_SIZE);
+    }
+
+    int64_t run(int64_t iterations) {
+        int64_t kept = 0;
+        for (int64_t i = 0; i < iterations; i++) {
+            switch (iOperation) {
+                case SUM:
+                    kept += PeriodBatch::sum(&iInput[0], BATCH_SIZE)[MILLIS];
+                    break;
+                case SCALE:
+                    // alternating the sign keeps the values in range
+                    PeriodBatch::scale(&iWork[0], BATCH_SIZE, -1);
+                    kept += iWork[0][MILLIS];
+                    break;
+                case TO_STANDARD_MILLIS:
+                    PeriodBatch::toStandardMillis(&iInput[0], BATCH_SIZE, &iMillis[0]);
+                    kept += iMillis[BATCH_SIZE - 1];
+                    break;
+                case NORMALIZED_STANDARD:
+                    // normalizing is idempotent, so each run starts from the raw input
+                    memcpy(&iWork[0], &iInput[0], BATCH_SIZE * sizeof(PeriodType::Values));
+                    PeriodBatch::normalizedStandard(&iWork[0], BATCH_SIZE, NULL);
+                    kept += iWork[BATCH_SIZE - 1][MILLIS];
+                    break;
+            }
+        }
+        return kept;
+    }
+
+};
+
+//-----------------------------------------------------------------------
+/**
+ * Times building and querying an IntervalIndex of random intervals.
+ */
+class IntervalIndexBenchmark : public Benchmark {
+
+public:
+
+    enum Operation { BUILD, FIND_CONTAINING, FIND_OVERLAPPING, OVERLAPS_ANY, FIND_NEAREST_GAPS };
+
+    static const size_t INTERVAL_COUNT = 10000;
+    static const size_t QUERY_COUNT = 1024;
+
+private:
+
+    Operation iOperation;
+    vector<int64_t> iStarts;
+    vector<int64_t> iEnds;
+    vector<int64_t> iQueries;
+    IntervalIndex *iIndex;
+    vector<size_t> iPositions;
+    vector<IntervalIndex::Gap> iGaps;
+
+public:
+
+    IntervalIndexBenchmark(string name, Operation operation) :
+        Benchmark(name), iOperation(operation), iIndex(NULL) {
+    }
+
+    ~IntervalIndexBenchmark() {
+        delete iIndex;
+    }
+
+    void setUp() {
+        BenchmarkRandom random(INTERVAL_COUNT);
+        iStarts.resize(INTERVAL_COUNT);
+        iEnds.resize(INTERVAL_COUNT);
+        for (size_t i = 0; i < INTERVAL_COUNT; i++) {
+            // about one instant in ten falls in a gap
+            iStarts[i] = ((int64_t) random.nextInt(0, 1000000)) * 1000;
+            iEnds[i] = iStarts[i] + ((int64_t) random.nextInt(0, 460)) * 1000;
+        }
+        iQueries.resize(QUERY_COUNT);
+        for (size_t i = 0; i < QUERY_COUNT; i++) {
+            iQueries[i] = ((int64_t) random.nextInt(0, 1000000)) * 1000;
+        }
+        delete iIndex;
+        iIndex = new IntervalIndex(&iStarts[0], &iEnds[0], INTERVAL_COUNT);
+    }
+
+    int64_t run(int64_t iterations) {
+        int64_t kept = 0;
+        for (int64_t i = 0; i < iterations; i++) {
+            int64_t query = iQueries[i % QUERY_COUNT];
+            switch (iOperation) {
+                case BUILD: {
+                    IntervalIndex index(&iStarts[0], &iEnds[0], INTERVAL_COUNT);
+                    kept += index.getGaps().size();
+                    break;
+                }
+                case FIND_CONTAINING:
+                    iPositions.clear();
+                    kept += iIndex->findContaining(query, iPositions);
+                    break;
+                case FIND_OVERLAPPING:
+                    iPositions.clear();
+                    kept += iIndex->findOverlapping(query, query + 60000, iPositions);
+                    break;
+                case OVERLAPS_ANY:
+                    kept += iIndex->overlapsAny(query, query + 60000);
+                    break;
+                case FIND_NEAREST_GAPS:
+                    iGaps.clear();
+                    kept += iIndex->findNearestGaps(query, 8, iGaps);
+                    break;
+            }
+        }
+        return kept;
+    }
+
+};
+
+//-----------------------------------------------------------------------
+/**
+ * Times PackedLocalDate over random dates.
+ */
+class PackedLocalDateBenchmark : public Benchmark {
+
+public:
+
+    enum Operation { OF, FIELDS, PLUS_DAYS, TO_STRING };
+
+    static const size_t DATE_COUNT = 1024;
+
+private:
+
+    Operation iOperation;
+    vector<int> iYears;
+    vector<int> iMonths;
+    vector<int> iDays;
+    vector<PackedLocalDate> iDates;
+
+public:
+
+    PackedLocalDateBenchmark(string name, Operation operation) : Benchmark(name), iOperation(operation) {
+    }
+
+    void setUp() {
+        BenchmarkRandom random(DATE_COUNT);
+        iYears.resize(DATE_COUNT);
+        iMonths.resize(DATE_COUNT);
+        iDays.resize(DATE_COUNT);
+        iDates.resize(DATE_COUNT);
+        for (size_t i = 0; i < DATE_COUNT; i++) {
+            iYears[i] = random.nextInt(1600, 2400);
+            iMonths[i] = random.nextInt(1, 12);
+            iDays[i] = random.nextInt(1, 28);
+            iDates[i] = PackedLocalDate::of(iYears[i], iMonths[i], iDays[i]);
+        }
+    }
+
+    int64_t run(int64_t iterations) {
+        int64_t kept = 0;
+        for (int64_t i = 0; i < iterations; i++) {
+            size_t n = (size_t) (i % DATE_COUNT);
+            switch (iOperation) {
+                case OF:
+                    kept += PackedLocalDate::of(iYears[n], iMonths[n], iDays[n]).getEpochDay();
+                    break;
+                case FIELDS:
+                    kept += iDates[n].getYear() + iDates[n].getMonthOfYear() + iDates[n].getDayOfMonth();
+                    break;
+                case PLUS_DAYS:
+                    kept += iDates[n].plusDays(iDays[n] * 100).getEpochDay();
+                    break;
+                case TO_STRING:
+                    kept += iDates[n].toString().size();
+                    break;
+            }
+        }
+        return kept;
+    }
+
+};
+
+//-----------------------------------------------------------------------
+/**
+ * Times PackedLocalTime over random times.
+ */
+class PackedLocalTimeBenchmark : public Benchmark {
+
+public:
+
+    enum Operation { OF, FIELDS, PLUS_MILLIS };
+
+    static const size_t TIME_COUNT = 1024;
+
+private:
+
+    Operation iOperation;
+    vector<int> iMillisOfDay;
+    vector<PackedLocalTime> iTimes;
+
+public:
+
+    PackedLocalTimeBenchmark(string name, Operation operation) : Benchmark(name), iOperation(operation) {
+    }
+
+    void setUp() {
+        BenchmarkRandom random(TIME_COUNT);
+        iMillisOfDay.resize(TIME_COUNT);
+        iTimes.resize(TIME_COUNT);
+        for (size_t i = 0; i < TIME_COUNT; i++) {
+            iMillisOfDay[i] = random.nextInt(0, 86399999);
+            iTimes[i] = PackedLocalTime::fromMillisOfDay(iMillisOfDay[i]);
+        }
+    }
+
+    int64_t run(int64_t iterations) {
+        int64_t kept = 0;
+        for (int64_t i = 0; i < iterations; i++) {
+            size_t n = (size_t) (i % TIME_COUNT);
+            int millis = iMillisOfDay[n];
+            switch (iOperation) {
+                case OF:
+                    kept += PackedLocalTime::of(millis / 3600000, millis / 60000 % 60,
+                                                millis / 1000 % 60, millis % 1000).getMillisOfDay();
+                    break;
+                case FIELDS:
+                    kept += iTimes[n].getHourOfDay() + iTimes[n].getMinuteOfHour() +
+                        iTimes[n].getSecondOfMinute() + iTimes[n].getMillisOfSecond();
+                    break;
+                case PLUS_MILLIS:
+                    kept += iTimes[n].plusMillis(millis).getMillisOfDay();
+                    break;
+            }
+        }
+        return kept;
+    }
+
+};
+
+//-----------------------------------------------------------------------
+/**
+ * Times FieldDivisor against the native division it replaces, so that a
+ * compiler which divides by a runtime constant quickly shows up as such.
+ */
+class FieldDivisorBenchmark : public Benchmark {
+
+public:
+
+    enum Operation { DIVIDE, REMAINDER, NATIVE_DIVIDE };
+
+    static const size_t VALUE_COUNT = 1024;
+
+private:
+
+    Operation iOperation;
+    vector<int> iValues;
+    FieldDivisor iDivisor;
+    int iNativeDivisor;
+
+public:
+
+    FieldDivisorBenchmark(string name, Operation operation, int divisor) :
+        Benchmark(name), iOperation(operation), iDivisor(divisor), iNativeDivisor(divisor) {
+    }
+
+    void setUp() {
+        BenchmarkRandom random(VALUE_COUNT);
+        iValues.resize(VALUE_COUNT);
+        for (size_t i = 0; i < VALUE_COUNT; i++) {
+            iValues[i] = random.nextInt(-100000, 100000);
+        }
+    }
+
+    int64_t run(int64_t iterations) {
+        int64_t kept = 0;
+        for (int64_t i = 0; i < iterations; i++) {
+            int value = iValues[i % VALUE_COUNT];
+            switch (iOperation) {
+                case DIVIDE:
+                    kept += iDivisor.divide(value);
+                    break;
+                case REMAINDER:
+                    kept += iDivisor.remainder(value);
+                    break;
+                case NATIVE_DIVIDE: {
+                    // floor division, as DividedDateTimeField did before FieldDivisor
+                    int quotient = value / iNativeDivisor;
+                    kept += (value % iNativeDivisor < 0 ? quotient - 1 : quotient);
+                    break;
+                }
+            }
+        }
+        return kept;
+    }
+
+};
+
+//-----------------------------------------------------------------------
+/**
+ * Times get, set and roundFloor of a date-time field over random instants.
+ */
+class DateTimeFieldBenchmark : public Benchmark {
+
+public:
+
+    enum Operation { GET, SET, ROUND_FLOOR };
+
+    static const size_t INSTANT_COUNT = 1024;
+
+private:
+
+    Operation iOperation;
+    const DateTimeField *iField;
+    vector<int64_t> iInstants;
+    vector<int> iValues;
+
+public:
+
+    /**
+     * Constructor.
+     *
+     * @param name  the name of the benchmark
+     * @param operation  the operation to time
+     * @param field  the field to time, which must outlive the benchmark
+     */
+    DateTimeFieldBenchmark(string name, Operation operation, const DateTimeField *field) :
+        Benchmark(name), iOperation(operation), iField(field) {
+    }
+
+    void setUp() {
+        BenchmarkRandom random(INSTANT_COUNT);
+        iInstants.resize(INSTANT_COUNT);
+        iValues.resize(INSTANT_COUNT);
+        for (size_t i = 0; i < INSTANT_COUNT; i++) {
+            // about a century either side of the epoch, so both signs are covered
+            iInstants[i] = ((int64_t) random.nextInt(-1600000000, 1600000000)) * 2000 + random.nextInt(0, 1999);
+            // the value already there, as not every value in the range of a
+            // divided field can be set at every instant
+            iValues[i] = iField->get(iInstants[i]);
+        }
+    }
+
+    int64_t run(int64_t iterations) {
+        int64_t kept = 0;
+        for (int64_t i = 0; i < iterations; i++) {
+            size_t n = (size_t) (i % INSTANT_COUNT);
+            switch (iOperation) {
+                case GET:
+                    kept += iField->get(iInstants[n]);
+                    break;
+                case SET:
+                    kept += iField->set(iInstants[n], iValues[n]);
+                    break;
+                case ROUND_FLOOR:
+                    kept += iField->roundFloor(iInstants[n]);
+                    break;
+            }
+        }
+        return kept;
+    }
+
+};
+
+/**
+ * Adds the get, set and roundFloor benchmarks of a field.
+ */
+static void addFieldBenchmarks(vector<Benchmark*> &benchmarks, string name, const DateTimeField *field) {
+    benchmarks.push_back(new DateTimeFieldBenchmark("dateTimeField/" + name + "/get", DateTimeFieldBenchmark::GET, field));
+    benchmarks.push_back(new DateTimeFieldBenchmark("dateTimeField/" + name + "/set", DateTimeFieldBenchmark::SET, field));
+    benchmarks.push_back(new DateTimeFieldBenchmark("dateTimeField/" + name + "/roundFloor", DateTimeFieldBenchmark::ROUND_FLOOR, field));
+}
+
+//-----------------------------------------------------------------------
+void addCoreBenchmarks(vector<Benchmark*> &benchmarks) {
+    benchmarks.push_back(new PeriodBatchBenchmark("periodBatch/sum/1024", PeriodBatchBenchmark::SUM));
+    benchmarks.push_back(new PeriodBatchBenchmark("periodBatch/scale/1024", PeriodBatchBenchmark::SCALE));
+    benchmarks.push_back(new PeriodBatchBenchmark("periodBatch/toStandardMillis/1024", PeriodBatchBenchmark::TO_STANDARD_MILLIS));
+    benchmarks.push_back(new PeriodBatchBenchmark("periodBatch/normalizedStandard/1024", PeriodBatchBenchmark::NORMALIZED_STANDARD));
+
+    benchmarks.push_back(new IntervalIndexBenchmark("intervalIndex/build/10000", IntervalIndexBenchmark::BUILD));
+    benchmarks.push_back(new IntervalIndexBenchmark("intervalIndex/findContaining", IntervalIndexBenchmark::FIND_CONTAINING));
+    benchmarks.push_back(new IntervalIndexBenchmark("intervalIndex/findOverlapping", IntervalIndexBenchmark::FIND_OVERLAPPING));
+    benchmarks.push_back(new IntervalIndexBenchmark("intervalIndex/overlapsAny", IntervalIndexBenchmark::OVERLAPS_ANY));
+    benchmarks.push_back(new IntervalIndexBenchmark("intervalIndex/findNearestGaps", IntervalIndexBenchmark::FIND_NEAREST_GAPS));
+
+    benchmarks.push_back(new PackedLocalDateBenchmark("packedLocalDate/of", PackedLocalDateBenchmark::OF));
+    benchmarks.push_back(new PackedLocalDateBenchmark("packedLocalDate/fields", PackedLocalDateBenchmark::FIELDS));
+    benchmarks.push_back(new PackedLocalDateBenchmark("packedLocalDate/plusDays", PackedLocalDateBenchmark::PLUS_DAYS));
+    benchmarks.push_back(new PackedLocalDateBenchmark("packedLocalDate/toString", PackedLocalDateBenchmark::TO_STRING));
+
+    benchmarks.push_back(new PackedLocalTimeBenchmark("packedLocalTime/of", PackedLocalTimeBenchmark::OF));
+    benchmarks.push_back(new PackedLocalTimeBenchmark("packedLocalTime/fields", PackedLocalTimeBenchmark::FIELDS));
+    benchmarks.push_back(new PackedLocalTimeBenchmark("packedLocalTime/plusMillis", PackedLocalTimeBenchmark::PLUS_MILLIS));
+
+    // the time of day fields of BasicChronology, built alike, as the chronologies
+    // cannot be built outside Xcode; they live as long as the program
+    const DurationField *millis = new PreciseDurationField(DurationFieldType::millis(), 1);
+    const DurationField *minutes = new PreciseDurationField(DurationFieldType::minutes(), DateTimeConstants::MILLIS_PER_MINUTE);
+    const DurationField *hours = new PreciseDurationField(DurationFieldType::hours(), DateTimeConstants::MILLIS_PER_HOUR);
+    const DurationField *days = new PreciseDurationField(DurationFieldType::days(), DateTimeConstants::MILLIS_PER_DAY);
+    addFieldBenchmarks(benchmarks, "millisOfDay", new PreciseDateTimeField(DateTimeFieldType::millisOfDay(), millis, days));
+    addFieldBenchmarks(benchmarks, "minuteOfHour", new PreciseDateTimeField(DateTimeFieldType::minuteOfHour(), minutes, hours));
+    addFieldBenchmarks(benchmarks, "hourOfDay", new PreciseDateTimeField(DateTimeFieldType::hourOfDay(), hours, days));
+
+    // the century of era and year of century, divided from the year of era as
+    // ISOChronology divides them, over a precise stand-in for the year of era;
+    // its years start at 2000, so that the first century is whole and every
+    // century can be rounded to
+    const DurationField *years = new PreciseDurationField(DurationFieldType::years(), (int64_t) DateTimeConstants::MILLIS_PER_DAY * 3652425 / 10000);
+    const DurationField *eras = new PreciseDurationField(DurationFieldType::eras(), years->getUnitMillis() * 10000);
+    const DateTimeField *yearOfEra = new OffsetDateTimeField(new PreciseDateTimeField(DateTimeFieldType::yearOfEra(), years, eras), 2000);
+    const DividedDateTimeField *centuryOfEra = new DividedDateTimeField(yearOfEra, DateTimeFieldType::centuryOfEra(), 100);
+    addFieldBenchmarks(benchmarks, "yearOfEra", yearOfEra);
+    addFieldBenchmarks(benchmarks, "centuryOfEra", centuryOfEra);
+    addFieldBenchmarks(benchmarks, "yearOfCentury", new RemainderDateTimeField(centuryOfEra, DateTimeFieldType::yearOfCentury()));
+
+    benchmarks.push_back(new FieldDivisorBenchmark("fieldDivisor/divide/100", FieldDivisorBenchmark::DIVIDE, 100));
+    benchmarks.push_back(new FieldDivisorBenchmark("fieldDivisor/remainder/100", FieldDivisorBenchmark::REMAINDER, 100));
+    benchmarks.push_back(new FieldDivisorBenchmark("fieldDivisor/nativeDivide/100", FieldDivisorBenchmark::NATIVE_DIVIDE, 100));
+}
+
+CODATIME_END
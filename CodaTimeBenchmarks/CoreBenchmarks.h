@@ -0,0 +1,33 @@
+//
+//  CoreBenchmarks.h
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#ifndef __CodaTime__CoreBenchmarks__
+#define __CodaTime__CoreBenchmarks__
+
+#include "CodaTimeMacros.h"
+
+#include "Benchmark.h"
+
+#include <vector>
+
+using namespace std;
+
+CODATIME_BEGIN
+
+/**
+ * Adds the benchmarks of PeriodBatch, IntervalIndex, PackedLocalDate,
+ * PackedLocalTime, FieldDivisor and the precise, offset, divided and
+ * remainder date-time fields.
+ *
+ * @param benchmarks  the vector to add to
+ */
+void addCoreBenchmarks(vector<Benchmark*> &benchmarks);
+
+CODATIME_END
+
+#endif /* defined(__CodaTime__CoreBenchmarks__) */
@@ -0,0 +1,49 @@
+//
+//  DateTimeUtilsStandIn.cpp
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#include "DateTimeUtils.h"
+
+#include "Exceptions.h"
+#include "PeriodType.h"
+
+CODATIME_BEGIN
+
+// DateTimeUtils.cpp defaults to the ISO chronology, which cannot be built
+// outside Xcode until the zoned chronology and the converters are ported.
+// The benchmarked sources only reach these methods with non-null arguments,
+// except for the period type, whose default needs no chronology.
+
+const int64_t DateTimeUtils::getInstantMillis(ReadableInstant *instant) {
+    if (instant == NULL) {
+        throw UnsupportedOperationException("The current time is not available to the benchmarks");
+    }
+    return instant->getMillis();
+}
+
+ReadableInterval *DateTimeUtils::getReadableInterval(ReadableInterval *interval) {
+    if (interval == NULL) {
+        throw UnsupportedOperationException("The current time is not available to the benchmarks");
+    }
+    return interval;
+}
+
+Chronology *DateTimeUtils::getChronology(Chronology *chrono) {
+    if (chrono == NULL) {
+        throw UnsupportedOperationException("The ISO chronology is not available to the benchmarks");
+    }
+    return chrono;
+}
+
+const PeriodType *DateTimeUtils::getPeriodType(const PeriodType *type) {
+    if (type == NULL) {
+        return PeriodType::standard();
+    }
+    return type;
+}
+
+CODATIME_END
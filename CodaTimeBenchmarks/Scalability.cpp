@@ -0,0 +1,370 @@
+//
+//  Scalability.cpp
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#include "Benchmark.h"
+
+#include "CodaTimeStats.h"
+#include "CodaTimeTrace.h"
+#include "DateTimeFieldType.h"
+#include "DurationFieldType.h"
+#include "IntervalIndex.h"
+#include "PackedLocalDate.h"
+#include "PeriodType.h"
+#include "WorkerThreads.h"
+#include "field/UnsupportedDateTimeField.h"
+#include "field/UnsupportedDurationfield.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+using namespace codatime;
+
+// Runs workloads over the shared caches on 1 to N threads at once, and
+// reports how the throughput scales and the latency of the slowest calls.
+// A workload whose efficiency, its speedup divided by its threads, falls
+// below the limit is flagged as contended.
+//
+// The chronology, zone and formatter caches cannot be built outside Xcode
+// until the zoned chronology and the converters are ported, so they are not
+// covered yet. The caches covered are the period types, the unsupported
+// fields and the stats and trace registries, alone and mixed with queries
+// of shared immutable data.
+
+/** The operations timed together, so that the clock does not dominate. */
+static const int BATCH_SIZE = 16;
+
+/** A workload, run by every thread on its own random input. */
+class Workload {
+
+private:
+
+    string iName;
+
+public:
+
+    Workload(string name) : iName(name) {
+    }
+
+    virtual ~Workload() {
+    }
+
+    const string &getName() const {
+        return iName;
+    }
+
+    /**
+     * Performs one operation.
+     *
+     * @param random  a random value, different for each call
+     * @return a value derived from the result
+     */
+    virtual int64_t run(uint64_t random) = 0;
+
+};
+
+static const DurationFieldType *durationFieldType(uint64_t random) {
+    switch (random % 8) {
+        case 0: return DurationFieldType::years();
+        case 1: return DurationFieldType::months();
+        case 2: return DurationFieldType::weeks();
+        case 3: return DurationFieldType::days();
+        case 4: return DurationFieldType::hours();
+        case 5: return DurationFieldType::minutes();
+        case 6: return DurationFieldType::seconds();
+        default: return DurationFieldType::millis();
+    }
+}
+
+static const DateTimeFieldType *dateTimeFieldType(uint64_t random) {
+    switch (random % 4) {
+        case 0: return DateTimeFieldType::year();
+        case 1: return DateTimeFieldType::monthOfYear();
+        case 2: return DateTimeFieldType::dayOfMonth();
+        default: return DateTimeFieldType::hourOfDay();
+    }
+}
+
+/** Looks up a period type by its fields, in the shared table of types. */
+class PeriodTypeWorkload : public Workload {
+
+public:
+
+    PeriodTypeWorkload() : Workload("periodType/forFields") {
+    }
+
+    int64_t run(uint64_t random) {
+        vector<const DurationFieldType*> types;
+        // always millis, as a type must have a field
+        for (int f = 0; f < 8; f++) {
+            if (((random >> f) & 1) || f == 7) {
+                types.push_back(durationFieldType(f));
+            }
+        }
+        return PeriodType::forFields(types)->size();
+    }
+
+};
+
+/** Gets the cached unsupported field of a type. */
+class UnsupportedFieldWorkload : public Workload {
+
+public:
+
+    UnsupportedFieldWorkload() : Workload("unsupportedField/getInstance") {
+    }
+
+    int64_t run(uint64_t random) {
+        UnsupportedDurationfield *duration = UnsupportedDurationfield::getInstance(durationFieldType(random));
+        UnsupportedDateTimeField *field = UnsupportedDateTimeField::getInstance(dateTimeFieldType(random >> 3), duration);
+        return (int64_t) (intptr_t) field;
+    }
+
+};
+
+/** Records cache activity, reading the totals now and then. */
+class StatsWorkload : public Workload {
+
+public:
+
+    StatsWorkload() : Workload("stats/record") {
+    }
+
+    int64_t run(uint64_t random) {
+        CodaTimeStats::Cache cache = (CodaTimeStats::Cache) (random % CodaTimeStats::CACHE_COUNT);
+        if ((random & 0xFF) == 0) {
+            return CodaTimeStats::getCacheStats(cache).hits;
+        }
+        CodaTimeStats::recordHit(cache);
+        return 0;
+    }
+
+};
+
+/** Records trace events, reading every thread's ring now and then. */
+class TraceWorkload : public Workload {
+
+public:
+
+    TraceWorkload() : Workload("trace/record") {
+    }
+
+    int64_t run(uint64_t random) {
+        if ((random & 0x3FF) == 0) {
+            return CodaTimeTrace::snapshot().size();
+        }
+        CodaTimeTrace::record(CodaTimeTrace::YEAR_INFO_MISS, (int64_t) (random % 4000), "");
+        return 0;
+    }
+
+};
+
+/** Mixes the cache workloads with queries of shared immutable data. */
+class MixedWorkload : public Workload {
+
+private:
+
+    vector<Workload*> iWorkloads;
+    IntervalIndex *iIndex;
+
+public:
+
+    MixedWorkload(const vector<Workload*> &workloads) : Workload("mixed"), iWorkloads(workloads) {
+        vector<int64_t> starts;
+        vector<int64_t> ends;
+        for (int64_t i = 0; i < 4096; i++) {
+            starts.push_back(i * 1000);
+            ends.push_back(i * 1000 + 500 + (i % 7) * 100);
+        }
+        iIndex = new IntervalIndex(&starts[0], &ends[0], starts.size());
+    }
+
+    ~MixedWorkload() {
+        delete iIndex;
+    }
+
+    int64_t run(uint64_t random) {
+        switch (random % (iWorkloads.size() + 2)) {
+            case 0:
+                return iIndex->overlapsAny((int64_t) (random % 4096000), (int64_t) (random % 4096000) + 250);
+            case 1:
+                return PackedLocalDate::fromEpochDay((int32_t) (random % 200000)).plusDays(30).getYear();
+            default:
+                return iWorkloads[random % (iWorkloads.size() + 2) - 2]->run(random >> 8);
+        }
+    }
+
+};
+
+//-----------------------------------------------------------------------
+/** The results of one workload on one number of threads. */
+struct ScalingResult {
+    int64_t operations;
+    double seconds;
+    double p50;
+    double p99;
+};
+
+static void runThread(Workload *workload, int index, atomic<int> *ready, const atomic<bool> *stop,
+                      int64_t *operations, vector<double> *latencies) {
+    uint64_t random = UINT64_C(0x9E3779B97F4A7C15) * (index + 1);
+    int64_t kept = 0;
+    ready->fetch_add(1);
+    while (ready->load() >= 0) {
+        this_thread::yield();
+    }
+    while (!stop->load(memory_order_relaxed)) {
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        for (int i = 0; i < BATCH_SIZE; i++) {
+            random = random * UINT64_C(6364136223846793005) + UINT64_C(1442695040888963407);
+            kept += workload->run(random >> 16);
+        }
+        double nanos = (double) chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count();
+        latencies->push_back(nanos / BATCH_SIZE);
+        *operations += BATCH_SIZE;
+    }
+    keepValue(kept);
+}
+
+static ScalingResult runWorkload(Workload *workload, int threads, int millis) {
+    atomic<int> ready(0);
+    atomic<bool> stop(false);
+    vector<int64_t> operations(threads, 0);
+    vector<vector<double> > latencies(threads);
+    chrono::steady_clock::time_point start;
+    {
+        WorkerThreads workers(threads);
+        for (int t = 0; t < threads; t++) {
+            workers.start(runThread, workload, t, &ready, &stop, &operations[t], &latencies[t]);
+        }
+        while (ready.load() < threads) {
+            this_thread::yield();
+        }
+        // releases every thread at once
+        start = chrono::steady_clock::now();
+        ready.store(-1);
+        this_thread::sleep_for(chrono::milliseconds(millis));
+        stop.store(true);
+        workers.join();
+    }
+    ScalingResult result;
+    result.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    result.operations = 0;
+    vector<double> all;
+    for (int t = 0; t < threads; t++) {
+        result.operations += operations[t];
+        all.insert(all.end(), latencies[t].begin(), latencies[t].end());
+    }
+    sort(all.begin(), all.end());
+    result.p50 = (all.empty() ? 0 : all[all.size() / 2]);
+    result.p99 = (all.empty() ? 0 : all[all.size() * 99 / 100]);
+    return result;
+}
+
+static int usage(const string &message) {
+    cerr << message << endl;
+    cerr << "usage: [--filter TEXT] [--threads N] [--millis N] [--efficiency LIMIT] [--cold] [--output FILE]" << endl;
+    return 2;
+}
+
+int main(int argc, char **argv) {
+    string filter;
+    string output;
+    int maxThreads = max(1, (int) thread::hardware_concurrency());
+    int millis = 200;
+    double limit = 0.5;
+    bool cold = false;
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+        if (arg == "--filter" && hasValue) {
+            filter = argv[++i];
+        } else if (arg == "--threads" && hasValue) {
+            maxThreads = max(1, atoi(argv[++i]));
+        } else if (arg == "--millis" && hasValue) {
+            millis = max(1, atoi(argv[++i]));
+        } else if (arg == "--efficiency" && hasValue) {
+            limit = atof(argv[++i]);
+        } else if (arg == "--output" && hasValue) {
+            output = argv[++i];
+        } else if (arg == "--cold") {
+            cold = true;
+        } else {
+            return usage("Unknown or incomplete option: " + arg);
+        }
+    }
+
+    vector<Workload*> workloads;
+    workloads.push_back(new PeriodTypeWorkload());
+    workloads.push_back(new UnsupportedFieldWorkload());
+    workloads.push_back(new StatsWorkload());
+    workloads.push_back(new TraceWorkload());
+    vector<Workload*> mixed(workloads);
+    workloads.push_back(new MixedWorkload(mixed));
+
+    // 1, 2, 4 and so on, ending at the maximum; when cold, only the maximum,
+    // so that every cache is first used by all of the threads at once
+    vector<int> threadCounts;
+    for (int threads = 1; threads < maxThreads && !cold; threads *= 2) {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(maxThreads);
+
+    ofstream file;
+    if (!output.empty()) {
+        file.open(output.c_str());
+    }
+    ostream &out = (output.empty() ? cout : file);
+    out << "workload,threads,ops_per_sec,speedup,efficiency,p50_ns,p99_ns,status" << endl;
+    vector<string> hotspots;
+    for (size_t w = 0; w < workloads.size(); w++) {
+        Workload *workload = workloads[w];
+        if (workload->getName().find(filter) == string::npos) {
+            continue;
+        }
+        double single = 0;
+        for (size_t c = 0; c < threadCounts.size(); c++) {
+            int threads = threadCounts[c];
+            ScalingResult result = runWorkload(workload, threads, millis);
+            double throughput = result.operations / result.seconds;
+            if (threads == 1) {
+                single = throughput;
+            }
+            double speedup = (single > 0 ? throughput / single : 0);
+            double efficiency = speedup / threads;
+            const char *status = "ok";
+            if (threads > 1 && single > 0 && efficiency < limit) {
+                status = "contended";
+                if (find(hotspots.begin(), hotspots.end(), workload->getName()) == hotspots.end()) {
+                    hotspots.push_back(workload->getName());
+                }
+            }
+            out << workload->getName() << ',' << threads << ','
+                << fixed << setprecision(0) << throughput << ',' << setprecision(2);
+            if (single > 0) {
+                out << speedup << ',' << efficiency;
+            } else {
+                out << ',';
+            }
+            out << ',' << setprecision(1) << result.p50 << ',' << result.p99 << ',' << status << endl;
+        }
+    }
+    for (size_t w = 0; w < workloads.size(); w++) {
+        delete workloads[w];
+    }
+
+    for (size_t h = 0; h < hotspots.size(); h++) {
+        cerr << "Contention: " << hotspots[h] << " scales below " << limit << " efficiency" << endl;
+    }
+    return 0;
+}
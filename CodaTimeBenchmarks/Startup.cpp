@@ -0,0 +1,158 @@
+//
+//  Startup.cpp
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#include "Benchmark.h"
+
+#include "DateTimeFieldType.h"
+#include "DurationFieldType.h"
+#include "Exceptions.h"
+#include "PeriodType.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+using namespace codatime;
+
+// Measures the cost of starting a program that links the library: the time
+// spent in static initializers before main, and the cost of building each
+// lazily created singleton on its first use. Both happen once per process,
+// so the program runs itself repeatedly with --child and reports the median
+// and minimum of each measurement, in the format of the other benchmarks.
+
+static chrono::steady_clock::time_point cFirstInitializer;
+
+// runs before any initializer of default priority, which covers all of those
+// in the library, so the time from here to main is the time they take; the
+// standard streams are set up first, so that their cost is not counted
+__attribute__((constructor(101)))
+static void recordFirstInitializer() {
+    static ios_base::Init cStreams;
+    cFirstInitializer = chrono::steady_clock::now();
+}
+
+static int64_t nanosSince(chrono::steady_clock::time_point start) {
+    return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count();
+}
+
+template<class Function>
+static int64_t timeOnce(Function function) {
+    chrono::steady_clock::time_point start = chrono::steady_clock::now();
+    keepValue((int64_t) (intptr_t) function());
+    return nanosSince(start);
+}
+
+static int runChild() {
+    int64_t initializers = nanosSince(cFirstInitializer);
+    cout << "startup/staticInitializers," << initializers << endl;
+    cout << "startup/firstUse/durationFieldType," << timeOnce(DurationFieldType::years) << endl;
+    cout << "startup/laterUse/durationFieldType," << timeOnce(DurationFieldType::years) << endl;
+    cout << "startup/firstUse/dateTimeFieldType," << timeOnce(DateTimeFieldType::monthOfYear) << endl;
+    cout << "startup/laterUse/dateTimeFieldType," << timeOnce(DateTimeFieldType::monthOfYear) << endl;
+    cout << "startup/firstUse/periodType," << timeOnce(PeriodType::standard) << endl;
+    cout << "startup/laterUse/periodType," << timeOnce(PeriodType::standard) << endl;
+    return 0;
+}
+
+static int usage(const string &message) {
+    cerr << message << endl;
+    cerr << "usage: [--runs N] [--output FILE] [--baseline FILE] [--threshold PERCENT]" << endl;
+    return 2;
+}
+
+int main(int argc, char **argv) {
+    int runs = 21;
+    string output;
+    string baselineFile;
+    double threshold = 0.1;
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+        if (arg == "--child") {
+            return runChild();
+        } else if (arg == "--runs" && hasValue) {
+            runs = max(1, atoi(argv[++i]));
+        } else if (arg == "--output" && hasValue) {
+            output = argv[++i];
+        } else if (arg == "--baseline" && hasValue) {
+            baselineFile = argv[++i];
+        } else if (arg == "--threshold" && hasValue) {
+            threshold = atof(argv[++i]) / 100;
+        } else {
+            return usage("Unknown or incomplete option: " + arg);
+        }
+    }
+
+    map<string, double> baseline;
+    if (!baselineFile.empty()) {
+        ifstream in(baselineFile.c_str());
+        if (!in) {
+            return usage("Cannot read the baseline: " + baselineFile);
+        }
+        try {
+            BenchmarkRunner::read(in, baseline);
+        } catch (IllegalArgumentException &e) {
+            return usage(e.what());
+        }
+    }
+
+    // every run is a new process, so each first use is really the first
+    string command = string("'") + argv[0] + "' --child";
+    vector<string> names;
+    map<string, vector<double> > samples;
+    for (int r = 0; r < runs; r++) {
+        FILE *child = popen(command.c_str(), "r");
+        if (child == NULL) {
+            return usage("Cannot run " + command);
+        }
+        char line[256];
+        while (fgets(line, sizeof(line), child) != NULL) {
+            string text(line);
+            size_t comma = text.find(',');
+            if (comma == string::npos) {
+                continue;
+            }
+            string name = text.substr(0, comma);
+            if (samples.find(name) == samples.end()) {
+                names.push_back(name);
+            }
+            samples[name].push_back(strtod(text.c_str() + comma + 1, NULL));
+        }
+        if (pclose(child) != 0) {
+            return usage("The child process failed: " + command);
+        }
+    }
+
+    vector<BenchmarkResult> results;
+    for (size_t n = 0; n < names.size(); n++) {
+        vector<double> &nanos = samples[names[n]];
+        sort(nanos.begin(), nanos.end());
+        BenchmarkResult result;
+        result.name = names[n];
+        result.iterations = (int64_t) nanos.size();
+        result.median = (nanos[(nanos.size() - 1) / 2] + nanos[nanos.size() / 2]) / 2;
+        result.min = nanos[0];
+        results.push_back(result);
+    }
+
+    BenchmarkRunner::write(cout, results);
+    if (!output.empty()) {
+        ofstream out(output.c_str());
+        BenchmarkRunner::write(out, results);
+    }
+    if (!baselineFile.empty()) {
+        cout << endl;
+        if (BenchmarkRunner::compare(cout, results, baseline, threshold) > 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,18 @@
+//
+//  main.cpp
+//  CodaTime
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#include "Benchmark.h"
+#include "CoreBenchmarks.h"
+
+using namespace codatime;
+
+int main(int argc, char **argv) {
+    vector<Benchmark*> benchmarks;
+    addCoreBenchmarks(benchmarks);
+    return runBenchmarks(argc, argv, benchmarks);
+}
@@ -0,0 +1,196 @@
+//
+//  AllocationCounterTests.cpp
+//  CodaTimeTests
+//
+//  Created by Saul Howard on 12/20/13.
+//  Copyright (c) 2013 Saul Howard. All rights reserved.
+//
+
+#include "AllocationCounter.h"
+
+#include "Exceptions.h"
+
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+
+using namespace codatime;
+
+// Built once with CODATIME_COUNT_ALLOCATIONS and once without, so each test
+// states what it expects in both builds.
+
+static int cFailures = 0;
+
+static void expect(bool condition, const char *test, const char *message) {
+    if (!condition) {
+        cerr << "FAIL " << test << ": " << message << endl;
+        cFailures++;
+    }
+}
+
+// calls the allocation functions directly, as new expressions may be elided
+static void allocate(int count) {
+    for (int i = 0; i < count; i++) {
+        ::operator delete(::operator new(24));
+    }
+}
+
+static void testIsEnabled() {
+#ifdef CODATIME_COUNT_ALLOCATIONS
+    expect(AllocationCounter::isEnabled(), "isEnabled", "counting should be enabled");
+#else
+    expect(!AllocationCounter::isEnabled(), "isEnabled", "counting should be disabled");
+#endif
+}
+
+static void testCounterIncrements() {
+    int64_t allocations = AllocationCounter::getAllocations();
+    int64_t bytes = AllocationCounter::getBytes();
+    allocate(3);
+    int64_t counted = AllocationCounter::getAllocations() - allocations;
+    int64_t countedBytes = AllocationCounter::getBytes() - bytes;
+#ifdef CODATIME_COUNT_ALLOCATIONS
+    expect(counted == 3, "counterIncrements", "three allocations should be counted");
+    expect(countedBytes == 72, "counterIncrements", "72 bytes should be counted");
+#else
+    expect(counted == 0, "counterIncrements", "nothing should be counted");
+    expect(countedBytes == 0, "counterIncrements", "no bytes should be counted");
+#endif
+}
+
+static void testCounterIsPerThread() {
+    int64_t allocations = AllocationCounter::getAllocations();
+    thread other(allocate, 5);
+    other.join();
+    // starting the thread may allocate on this one, but not five times
+    expect(AllocationCounter::getAllocations() - allocations < 5, "counterIsPerThread",
+           "allocations of another thread should not be counted");
+}
+
+static void testWithinBudget() {
+    try {
+        AssertNoAllocations scope("withinBudget", 2);
+        allocate(2);
+        scope.check();
+        int64_t expected = (AllocationCounter::isEnabled() ? 2 : 0);
+        expect(scope.getAllocations() == expected, "withinBudget", "the scope should count its allocations");
+    } catch (IllegalStateException &e) {
+        expect(false, "withinBudget", e.what());
+    }
+    try {
+        AssertNoAllocations scope("noAllocations");
+    } catch (IllegalStateException &e) {
+        expect(false, "withinBudget", e.what());
+    }
+}
+
+static void testCheckThrowsOverBudget() {
+    bool thrown = false;
+    string message;
+    try {
+        AssertNoAllocations scope("overBudget", 2);
+        allocate(3);
+        try {
+            scope.check();
+        } catch (IllegalStateException &e) {
+            thrown = true;
+            message = e.what();
+        }
+    } catch (IllegalStateException &e) {
+        // the destructor checks again
+    }
+#ifdef CODATIME_COUNT_ALLOCATIONS
+    expect(thrown, "checkThrowsOverBudget", "check() should throw");
+    expect(message == "overBudget made 3 allocations, the budget is 2", "checkThrowsOverBudget", message.c_str());
+#else
+    expect(!thrown, "checkThrowsOverBudget", "check() should not throw");
+#endif
+}
+
+static void testDestructorThrowsOverBudget() {
+    bool thrown = false;
+    try {
+        AssertNoAllocations scope("destructor");
+        allocate(1);
+    } catch (IllegalStateException &e) {
+        thrown = true;
+    }
+#ifdef CODATIME_COUNT_ALLOCATIONS
+    expect(thrown, "destructorThrowsOverBudget", "the destructor should throw");
+#else
+    expect(!thrown, "destructorThrowsOverBudget", "the destructor should not throw");
+#endif
+}
+
+static void testNoThrowWhileUnwinding() {
+    bool caught = false;
+    try {
+        AssertNoAllocations scope("unwinding");
+        allocate(1);
+        throw runtime_error("leaving the scope");
+    } catch (runtime_error &e) {
+        caught = true;
+    } catch (IllegalStateException &e) {
+        expect(false, "noThrowWhileUnwinding", "the destructor should not throw while unwinding");
+    }
+    expect(caught, "noThrowWhileUnwinding", "the original exception should propagate");
+}
+
+#if __cplusplus >= 201703L
+/** Opens a scope in its destructor, so while an exception unwinds past it. */
+struct ScopeInDestructor {
+    bool *iThrown;
+
+    ~ScopeInDestructor() {
+        try {
+            AssertNoAllocations scope("inDestructor");
+            allocate(1);
+        } catch (IllegalStateException &e) {
+            *iThrown = true;
+        }
+    }
+};
+
+static void testScopeOpenedWhileUnwinding() {
+    bool thrown = false;
+    try {
+        ScopeInDestructor guard = { &thrown };
+        throw runtime_error("unwinding");
+    } catch (runtime_error &e) {
+    }
+#ifdef CODATIME_COUNT_ALLOCATIONS
+    expect(thrown, "scopeOpenedWhileUnwinding", "a scope opened while unwinding should still be checked");
+#else
+    expect(!thrown, "scopeOpenedWhileUnwinding", "the destructor should not throw");
+#endif
+}
+#endif
+
+static void testNegativeBudget() {
+    bool thrown = false;
+    try {
+        AssertNoAllocations scope("negative", -1);
+    } catch (IllegalArgumentException &e) {
+        thrown = true;
+    }
+    expect(thrown, "negativeBudget", "a negative budget should be rejected");
+}
+
+int main() {
+    testIsEnabled();
+    testCounterIncrements();
+    testCounterIsPerThread();
+    testWithinBudget();
+    testCheckThrowsOverBudget();
+    testDestructorThrowsOverBudget();
+    testNoThrowWhileUnwinding();
+#if __cplusplus >= 201703L
+    testScopeOpenedWhileUnwinding();
+#endif
+    testNegativeBudget();
+    if (cFailures > 0) {
+        cerr << cFailures << " failure(s)" << endl;
+        return 1;
+    }
+    return 0;
+}